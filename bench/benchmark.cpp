@@ -0,0 +1,838 @@
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "GUI/GUI.hpp"
+
+// Measures the hot paths of the library. Each result is printed as one JSON object per line, so
+// that results can be compared across releases:
+// {"benchmark":"draw","variant":"batched","elements":1000,"iterations":4096,"ns_per_op":1234.5}
+//
+// Usage: SIFL3_benchmark [filter], where only the benchmarks whose name contains `filter` are run.
+// Like the example, it must be run from a folder next to `assets/`, which holds the default font.
+// Interfaces are drawn into a `sf::RenderTexture`: the window is only needed to create them.
+
+#ifndef SIFL_VERSION
+#define SIFL_VERSION "unknown"
+#endif
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+/// Minimum duration of a measure. The number of iterations doubles until it is reached.
+constexpr std::chrono::milliseconds s_minimumDuration{ 200 };
+
+/// Only the benchmarks whose name contains it are run.
+std::string_view s_filter{};
+
+
+void report(std::string_view benchmark, std::string_view variant, size_t elements, size_t iterations, std::chrono::nanoseconds duration)
+{
+	const double nsPerOp{ static_cast<double>(duration.count()) / static_cast<double>(iterations) };
+
+	std::printf("{\"benchmark\":\"%.*s\",\"variant\":\"%.*s\",\"elements\":%zu,\"iterations\":%zu,\"ns_per_op\":%.1f}\n",
+		static_cast<int>(benchmark.size()), benchmark.data(), static_cast<int>(variant.size()), variant.data(), elements, iterations, nsPerOp);
+	std::fflush(stdout);
+}
+
+bool isSelected(std::string_view benchmark) noexcept
+{
+	return benchmark.find(s_filter) != std::string_view::npos;
+}
+
+/**
+ * \brief Calls `operation` until the minimum duration is reached, then reports the mean duration.
+ */
+void run(std::string_view benchmark, std::string_view variant, size_t elements, const std::function<void()>& operation)
+{
+	operation(); // Warm up: lazy loading, first rebuilds...
+
+	size_t iterations{ 1 };
+	while (true)
+	{
+		const Clock::time_point start{ Clock::now() };
+		for (size_t i{ 0 }; i < iterations; ++i)
+			operation();
+		const std::chrono::nanoseconds duration{ Clock::now() - start };
+
+		if (duration >= s_minimumDuration || iterations >= (size_t{ 1 } << 30))
+		{
+			report(benchmark, variant, elements, iterations, duration);
+			return;
+		}
+
+		iterations *= 2;
+	}
+}
+
+
+void populate(gui::BasicInterface& gui, size_t nbOfElements)
+{
+	for (size_t i{ 0 }; i < nbOfElements; ++i)
+	{
+		const sf::Vector2f pos{ static_cast<float>(i % 100) * 10.f, static_cast<float>((i / 100) % 100) * 10.f };
+
+		if (i % 2 == 0)
+			gui.addSprite("benchmark", pos, sf::Vector2f{ 0.5f, 0.5f });
+		else
+			gui.addText("text", pos, 12u);
+	}
+}
+
+void benchmarkDraw(sf::RenderWindow& window, sf::RenderTexture& target)
+{
+	if (!isSelected("draw"))
+		return;
+
+	for (const size_t nbOfElements : { size_t{ 10 }, size_t{ 1'000 }, size_t{ 100'000 } })
+	{
+		for (const std::string_view variant : { "unlocked", "locked", "batched", "static_layer" })
+		{
+			BGUI gui{ &window, 1080 };
+			populate(gui, nbOfElements);
+
+			if (variant == "locked")
+				gui.lockInterface();
+			else if (variant == "batched")
+				gui.lockInterface(true, true);
+			else if (variant == "static_layer")
+			{
+				gui.lockInterface();
+				gui.setStaticLayerCaching(true);
+			}
+
+			run("draw", variant, nbOfElements, [&gui, &target]()
+			{
+				target.clear();
+				gui.draw(target);
+				target.display();
+			});
+		}
+	}
+}
+
+void benchmarkHover(sf::RenderWindow& window)
+{
+	if (!isSelected("eventUpdateHovered"))
+		return;
+
+	for (const size_t nbOfInteractives : { size_t{ 10 }, size_t{ 1'000 }, size_t{ 10'000 } })
+	{
+		IGUI gui{ &window, 1080 };
+		for (size_t i{ 0 }; i < nbOfInteractives; ++i)
+		{
+			const std::string identifier{ "button" + std::to_string(i) };
+			gui.addDynamicText(identifier, "button", sf::Vector2f{ static_cast<float>(i % 100) * 10.f, static_cast<float>(i / 100) * 10.f }, 8u);
+			gui.addInteractive(identifier);
+		}
+		gui.lockInterface();
+
+		const sf::Vector2f first{ gui.getDynamicText("button0")->getGlobalBounds().getCenter() };
+		const sf::Vector2f last{ gui.getDynamicText("button" + std::to_string(nbOfInteractives - 1))->getGlobalBounds().getCenter() };
+		const sf::Vector2f outside{ -1'000.f, -1'000.f };
+
+		run("eventUpdateHovered", "same_hit", nbOfInteractives, [&gui, first]() { (void)gui.eventUpdateHovered(first); });
+
+		bool alternate{ false };
+		run("eventUpdateHovered", "new_hit", nbOfInteractives, [&gui, first, last, &alternate]()
+		{
+			alternate = !alternate;
+			(void)gui.eventUpdateHovered(alternate ? first : last);
+		});
+
+		run("eventUpdateHovered", "miss", nbOfInteractives, [&gui, outside]() { (void)gui.eventUpdateHovered(outside); });
+	}
+}
+
+void benchmarkInputDispatch(sf::RenderWindow& window)
+{
+	if (!isSelected("inputDispatch"))
+		return;
+
+	constexpr size_t nbOfInteractives{ 1'000 };
+	constexpr size_t nbOfMovesPerFrame{ 8 }; // A 1000 Hz mouse polled at 120 fps.
+
+	IGUI gui{ &window, 1080 };
+	for (size_t i{ 0 }; i < nbOfInteractives; ++i)
+	{
+		const std::string identifier{ "button" + std::to_string(i) };
+		gui.addDynamicText(identifier, "button", sf::Vector2f{ static_cast<float>(i % 100) * 10.f, static_cast<float>(i / 100) * 10.f }, 8u);
+		gui.addInteractive(identifier);
+	}
+	gui.lockInterface();
+
+	// The cursor sweeps over the buttons: each move is likely to hover a new one.
+	int x{ 0 };
+	const auto nextPosition{ [&x]() { x = (x + 7) % 1'000; return sf::Vector2i{ x, 50 }; } };
+
+	run("inputDispatch", "per_event", nbOfInteractives, [&gui, &window, &nextPosition]()
+	{
+		for (size_t i{ 0 }; i < nbOfMovesPerFrame; ++i)
+			(void)gui.eventUpdateHovered(window.mapPixelToCoords(nextPosition()));
+	});
+
+	gui::InputDispatcher input{ &window };
+	run("inputDispatch", "coalesced", nbOfInteractives, [&gui, &input, &nextPosition]()
+	{
+		for (size_t i{ 0 }; i < nbOfMovesPerFrame; ++i)
+			input.handleEvent(sf::Event{ sf::Event::MouseMoved{ nextPosition() } });
+		(void)input.dispatch(&gui);
+	});
+}
+
+/**
+ * \brief A row of buttons, for `benchmarkStaticInterface`.
+ */
+struct ButtonRow
+{
+	static constexpr size_t s_nbOfButtons{ 16 };
+	static constexpr std::array<std::string_view, s_nbOfButtons> s_identifiers{ "b0", "b1", "b2", "b3", "b4", "b5", "b6", "b7", "b8", "b9", "b10", "b11", "b12", "b13", "b14", "b15" };
+
+	static constexpr std::array<gui::StaticText, s_nbOfButtons> texts{ []()
+	{
+		std::array<gui::StaticText, s_nbOfButtons> texts{};
+		for (size_t i{ 0 }; i < s_nbOfButtons; ++i)
+			texts[i] = gui::StaticText{ .identifier = s_identifiers[i], .content = "button", .pos = { static_cast<float>(i) * 60.f + 30.f, 50.f }, .characterSize = 8u };
+		return texts;
+	}() };
+
+	static constexpr std::array<gui::StaticButton<size_t>, s_nbOfButtons> buttons{ []()
+	{
+		std::array<gui::StaticButton<size_t>, s_nbOfButtons> buttons{};
+		for (size_t i{ 0 }; i < s_nbOfButtons; ++i)
+			buttons[i] = gui::StaticButton<size_t>{ s_identifiers[i], [](size_t& nbOfPresses) { ++nbOfPresses; } };
+		return buttons;
+	}() };
+};
+
+void benchmarkStaticInterface(sf::RenderWindow& window)
+{
+	if (!isSelected("staticInterface"))
+		return;
+
+	IGUI gui{ &window, 1080 };
+	size_t nbOfPresses{ 0 };
+	for (const gui::StaticText& text : ButtonRow::texts)
+	{
+		gui.addDynamicText(std::string{ text.identifier }, text.content, text.pos, text.characterSize);
+		gui.addInteractive(std::string{ text.identifier }, [&nbOfPresses](IGUI*) { ++nbOfPresses; });
+	}
+	gui.lockInterface();
+
+	gui::StaticInterface<ButtonRow> staticGui{ &window, 1080 };
+
+	// The cursor sweeps over the buttons, and presses each one it hovers.
+	int x{ 0 };
+	const auto nextPosition{ [&x, &window]() { x = (x + 7) % 960; return window.mapPixelToCoords(sf::Vector2i{ x, 50 }); } };
+
+	run("staticInterface", "interactive", ButtonRow::s_nbOfButtons, [&gui, &nextPosition]()
+	{
+		(void)gui.eventUpdateHovered(nextPosition());
+		gui.eventPressed();
+	});
+
+	run("staticInterface", "static", ButtonRow::s_nbOfButtons, [&staticGui, &nbOfPresses, &nextPosition]()
+	{
+		(void)staticGui.eventUpdateHovered(nextPosition());
+		staticGui.eventPressed(nbOfPresses);
+	});
+
+	if (nbOfPresses == 42) // Keeps the presses from being optimized away.
+		std::fputc(' ', stderr);
+}
+
+/**
+ * \brief Exposes the swap used internally by removals.
+ */
+class ChurnInterface : public MGUI
+{
+public:
+
+	using MGUI::MGUI;
+
+	void swapTexts(size_t index1, size_t index2) noexcept
+	{
+		swapElement(index1, index2, m_texts, m_textElements, m_indexesForEachDynamicTexts);
+	}
+};
+
+void benchmarkChurn(sf::RenderWindow& window)
+{
+	if (!isSelected("churn"))
+		return;
+
+	for (const size_t nbOfElements : { size_t{ 10 }, size_t{ 1'000 }, size_t{ 100'000 } })
+	{
+		ChurnInterface gui{ &window, 1080 };
+		for (size_t i{ 0 }; i < nbOfElements; ++i)
+			gui.addDynamicText("text" + std::to_string(i), "text", sf::Vector2f{ 0.f, 0.f });
+
+		size_t next{ 0 };
+		run("churn", "remove_add", nbOfElements, [&gui, &next, nbOfElements]()
+		{
+			const std::string identifier{ "text" + std::to_string(next) };
+			gui.removeDynamicText(identifier);
+			gui.addDynamicText(identifier, "text", sf::Vector2f{ 0.f, 0.f });
+			next = (next + 1) % nbOfElements;
+		});
+
+		run("churn", "swap", nbOfElements, [&gui, &next, nbOfElements]()
+		{
+			gui.swapTexts(next, nbOfElements - 1 - next);
+			next = (next + 1) % nbOfElements;
+		});
+	}
+}
+
+void benchmarkAddInteractive(sf::RenderWindow& window)
+{
+	if (!isSelected("addInteractive"))
+		return;
+
+	for (const size_t nbOfInteractives : { size_t{ 10 }, size_t{ 1'000 }, size_t{ 100'000 } })
+	{
+		IGUI gui{ &window, 1080 };
+		for (size_t i{ 0 }; i < nbOfInteractives; ++i)
+		{
+			const std::string identifier{ "button" + std::to_string(i) };
+			gui.addDynamicText(identifier, "button", sf::Vector2f{ 0.f, 0.f });
+			gui.addInteractive(identifier);
+		}
+
+		// Only `addInteractive` is timed: the text is created and removed outside of the measure.
+		size_t iterations{ 0 };
+		std::chrono::nanoseconds duration{ 0 };
+		while (duration < s_minimumDuration)
+		{
+			gui.addDynamicText("extra", "button", sf::Vector2f{ 0.f, 0.f });
+
+			const Clock::time_point start{ Clock::now() };
+			gui.addInteractive("extra");
+			duration += Clock::now() - start;
+
+			gui.removeDynamicText("extra");
+			++iterations;
+		}
+
+		report("addInteractive", "full_interface", nbOfInteractives, iterations, duration);
+	}
+}
+
+void benchmarkSetContent(sf::RenderWindow& window)
+{
+	if (!isSelected("setContent"))
+		return;
+
+	MGUI gui{ &window, 1080 };
+	gui.addDynamicText("text", 0, sf::Vector2f{ 0.f, 0.f });
+	gui::TextWrapper& text{ *gui.getDynamicText("text") };
+
+	int counter{ 0 };
+	run("setContent", "int", 1, [&text, &counter]() { text.setContent(++counter); });
+	run("setContent", "float", 1, [&text, &counter]() { text.setContent(static_cast<float>(++counter) / 7.f); });
+	run("setContent", "string_view", 1, [&text, &counter]() { text.setContent((++counter % 2 == 0) ? std::string_view{ "even" } : std::string_view{ "odd" }); });
+	run("setContent", "unchanged", 1, [&text]() { text.setContent(std::string_view{ "unchanged" }); });
+}
+
+void benchmarkAnimation(sf::RenderWindow& window)
+{
+	if (!isSelected("animation"))
+		return;
+
+	constexpr size_t nbOfSprites{ 500 };
+	const sf::Time frameDuration{ sf::milliseconds(100) }, elapsed{ sf::milliseconds(16) };
+
+	gui::SpriteWrapper::createTexture("benchmark_sheet", sf::Texture{ sf::Image{ sf::Vector2u{ 128, 32 }, sf::Color::White } }, gui::SpriteWrapper::Reserved::No);
+	MGUI gui{ &window, 1080 };
+	gui.reserve(0, nbOfSprites);
+	for (size_t i{ 0 }; i < nbOfSprites; ++i)
+		gui.addDynamicSprite(std::to_string(i), "benchmark_sheet", sf::Vector2f{ static_cast<float>(i % 100) * 10.f, 0.f }, sf::Vector2f{ 1.f, 1.f }, sf::IntRect{ { 0, 0 }, { 32, 32 } });
+	gui.lockInterface(); // The sprites won't move anymore.
+
+	std::vector<gui::SpriteWrapper*> sprites{};
+	for (size_t i{ 0 }; i < nbOfSprites; ++i)
+	{
+		gui::SpriteWrapper& sprite{ *gui.getDynamicSprite(std::to_string(i)) };
+		sprite.addTexture("benchmark_sheet", sf::IntRect{ { 32, 0 }, { 32, 32 } }, sf::IntRect{ { 64, 0 }, { 32, 32 } }, sf::IntRect{ { 96, 0 }, { 32, 32 } });
+		sprites.push_back(&sprite);
+	}
+
+	// What user code does without an animator: a clock per sprite, and a switch once it is over.
+	std::vector<sf::Time> clocks(nbOfSprites, sf::Time::Zero);
+	run("animation", "manual_switch", nbOfSprites, [&]()
+	{
+		for (size_t i{ 0 }; i < nbOfSprites; ++i)
+		{
+			clocks[i] += elapsed;
+			if (clocks[i] >= frameDuration)
+			{
+				clocks[i] -= frameDuration;
+				sprites[i]->switchToNextTexture();
+			}
+		}
+	});
+
+	gui::SpriteAnimator animator{};
+	const gui::AnimationFrame frames[]{ { 0, frameDuration }, { 1, frameDuration }, { 2, frameDuration }, { 3, frameDuration } };
+	const auto clip{ animator.createClip(frames, gui::PlayMode::Loop) };
+	for (size_t i{ 0 }; i < nbOfSprites; ++i)
+		animator.play(gui, gui.getSpriteHandle(std::to_string(i)), clip);
+
+	run("animation", "animator", nbOfSprites, [&animator, elapsed]() { animator.update(elapsed); });
+}
+
+void benchmarkTween(sf::RenderWindow& window)
+{
+	if (!isSelected("tween"))
+		return;
+
+	constexpr size_t nbOfSprites{ 500 };
+	const sf::Time duration{ sf::seconds(100'000) }, elapsed{ sf::milliseconds(16) }; // Never over while measured.
+
+	MGUI gui{ &window, 1080 };
+	gui.reserve(0, nbOfSprites);
+	for (size_t i{ 0 }; i < nbOfSprites; ++i)
+		gui.addDynamicSprite(std::to_string(i), "benchmark", sf::Vector2f{ static_cast<float>(i % 100) * 10.f, 0.f });
+	gui.lockInterface(); // The sprites won't move anymore.
+
+	std::vector<gui::SpriteWrapper*> sprites{};
+	for (size_t i{ 0 }; i < nbOfSprites; ++i)
+		sprites.push_back(gui.getDynamicSprite(std::to_string(i)));
+
+	// What user code does without an engine: a clock per sprite, and an eased value computed from it.
+	std::vector<sf::Time> clocks(nbOfSprites, sf::Time::Zero);
+	std::vector<sf::Vector2f> starts{};
+	for (const gui::SpriteWrapper* sprite : sprites)
+		starts.push_back(sprite->getPosition());
+
+	run("tween", "manual_lerp", nbOfSprites, [&]()
+	{
+		for (size_t i{ 0 }; i < nbOfSprites; ++i)
+		{
+			clocks[i] += elapsed;
+			const float progress{ gui::computeEasing(gui::Easing::QuadOut, std::min(clocks[i] / duration, 1.f)) };
+			sprites[i]->setPosition(starts[i] + (sf::Vector2f{ 500.f, 1000.f } - starts[i]) * progress);
+		}
+	});
+
+	gui::TweenEngine tweens{};
+	for (size_t i{ 0 }; i < nbOfSprites; ++i)
+		tweens.moveTo(gui, gui.getSpriteHandle(std::to_string(i)), sf::Vector2f{ 500.f, 1000.f }, duration, gui::Easing::QuadOut);
+
+	run("tween", "engine", nbOfSprites, [&tweens, elapsed]() { tweens.update(elapsed); });
+}
+
+void benchmarkScrollList(sf::RenderWindow& window)
+{
+	if (!isSelected("scrollList"))
+		return;
+
+	constexpr size_t nbOfItems{ 100'000 };
+	constexpr float rowHeight{ 40.f };
+
+	MGUI gui{ &window, 1080 };
+	gui::ScrollList list{ &gui, "benchmark", sf::FloatRect{ { 100.f, 100.f }, { 600.f, 800.f } }, rowHeight };
+	list.setItems(nbOfItems, [](size_t item, gui::TextWrapper& text, gui::SpriteWrapper*) { text.setContent(item); });
+	gui.lockInterface();
+
+	// Smooth scrolling: a row enters the viewport every 4 frames. Bounces at the end of the list.
+	float delta{ rowHeight / 4.f };
+	run("scrollList", "scroll", nbOfItems, [&list, &delta]()
+	{
+		if (list.getOffset() + delta > list.getMaxOffset() || list.getOffset() + delta < 0.f) [[unlikely]]
+			delta = -delta;
+		list.scroll(delta);
+	});
+
+	// Jumps to an unrelated page each time: the whole viewport is refilled.
+	size_t item{ 0 };
+	run("scrollList", "jump", nbOfItems, [&list, &item]()
+	{
+		item = (item + 7'919) % nbOfItems;
+		list.scrollToItem(item);
+	});
+
+	run("scrollList", "draw", nbOfItems, [&gui]() { gui.draw(); });
+}
+
+void benchmarkResize(sf::RenderWindow& window, sf::RenderTexture& target)
+{
+	if (!isSelected("proportionKeeper"))
+		return;
+
+	for (const size_t nbOfInterfaces : { size_t{ 10 }, size_t{ 100 }, size_t{ 1'000 } })
+	{
+		std::list<BGUI> interfaces{}; // Interfaces can't be moved once registered to their window.
+		for (size_t i{ 0 }; i < nbOfInterfaces; ++i)
+			populate(interfaces.emplace_back(&window, 1080), 100);
+
+		// The window keeps its size: the previous view alternates instead, so the elements are
+		// rescaled back and forth. Drawing applies the deferred rescaling.
+		sf::View view{ window.getView() };
+		const sf::Vector2f windowSize{ window.getSize() };
+		bool alternate{ false };
+
+		run("proportionKeeper", "resize_then_draw", nbOfInterfaces, [&]()
+		{
+			alternate = !alternate;
+			view.setSize(alternate ? windowSize * 1.25f : windowSize * 0.8f);
+
+			BGUI::windowResized(&window, view);
+			for (const BGUI& gui : interfaces)
+				gui.draw(target);
+		});
+	}
+}
+
+void benchmarkTextureLoading()
+{
+	if (!isSelected("createTexture"))
+		return;
+
+	// Textures are loaded from the assets folder, where a temporary one is written.
+	const std::string fileName{ "sifl_benchmark.png" };
+	const std::filesystem::path path{ std::filesystem::path{ "../assets/" } / fileName };
+	const std::string packFileName{ "sifl_benchmark.siflpack" };
+	const std::filesystem::path packPath{ std::filesystem::path{ "../assets/" } / packFileName };
+
+	for (const unsigned int size : { 64u, 512u, 2048u })
+	{
+		if (!sf::Image{ sf::Vector2u{ size, size }, sf::Color::Red }.saveToFile(path))
+		{
+			std::fprintf(stderr, "Could not write %s\n", path.string().c_str());
+			return;
+		}
+
+		size_t loads{ 0 };
+		try
+		{
+			run("createTexture", "create_then_load", static_cast<size_t>(size) * size, [&fileName, &loads]()
+			{
+				const std::string name{ "lazy" + std::to_string(loads++) };
+				gui::SpriteWrapper::createTexture(name, fileName); // Lazy: only loaded below.
+				(void)gui::SpriteWrapper::loadTexture(name);
+				gui::SpriteWrapper::removeTexture(name);
+			});
+		}
+		catch (const gui::LoadingGraphicalResourceFailure& error)
+		{
+			std::fprintf(stderr, "%s", error.what());
+			break;
+		}
+
+		// The same image from an asset pack: as the file, and decoded ahead of time.
+		std::ostringstream errorMessage{};
+		std::vector<gui::AssetPack::Source> sources{};
+		for (const gui::AssetPack::Format format : { gui::AssetPack::Format::Encoded, gui::AssetPack::Format::Rgba })
+			if (auto source{ gui::AssetPack::readSource(errorMessage, (format == gui::AssetPack::Format::Rgba) ? "rgba" : "encoded", path, gui::AssetPack::Kind::Texture, format) })
+				sources.push_back(std::move(source.value()));
+
+		const bool isSaved{ sources.size() == 2 && gui::AssetPack::save(errorMessage, packPath, std::move(sources)) };
+		const std::shared_ptr<const gui::AssetPack> pack{ isSaved ? gui::AssetPack::open(errorMessage, packFileName) : nullptr };
+		if (pack == nullptr)
+		{
+			std::fprintf(stderr, "%s", errorMessage.str().c_str());
+			break;
+		}
+
+		for (const std::string_view entry : { "encoded", "rgba" })
+		{
+			run("createTexture", (entry == "rgba") ? "pack_rgba" : "pack_encoded", static_cast<size_t>(size) * size, [&pack, entry, &loads]()
+			{
+				const std::string name{ "lazy" + std::to_string(loads++) };
+				gui::SpriteWrapper::createTexture(name, pack, std::string{ entry });
+				(void)gui::SpriteWrapper::loadTexture(name);
+				gui::SpriteWrapper::removeTexture(name);
+			});
+		}
+	}
+
+	std::filesystem::remove(path);
+	std::filesystem::remove(packPath);
+}
+
+void benchmarkProceduralTexture()
+{
+	if (!isSelected("proceduralTexture"))
+		return;
+
+	const auto makeRectangle{ []()
+	{
+		sf::RectangleShape shape{ sf::Vector2f{ 200.f, 20.f } };
+		shape.setFillColor(sf::Color{ 20, 20, 20 });
+		shape.setOutlineColor(sf::Color{ 80, 80, 80 });
+		shape.setOutlineThickness(2.f);
+		return shape;
+	} };
+
+	for (const bool isAtlasEnabled : { false, true })
+	{
+		gui::SpriteWrapper::enableAtlas(isAtlasEnabled);
+		const std::string_view suffix{ isAtlasEnabled ? "_atlas" : "" };
+
+		size_t textures{ 0 };
+		run("proceduralTexture", std::string{ "unshared" } + std::string{ suffix }, 1, [&makeRectangle, &textures]()
+		{
+			const std::string name{ "procedural" + std::to_string(textures++) };
+			gui::SpriteWrapper::createTexture(name, gui::createTextureFromDrawables(makeRectangle()), gui::SpriteWrapper::Reserved::No);
+			gui::SpriteWrapper::removeTexture(name);
+		});
+
+		run("proceduralTexture", std::string{ "shared_miss" } + std::string{ suffix }, 1, [&makeRectangle]()
+		{
+			gui::SpriteWrapper::removeTexture(gui::createSharedTextureFromDrawables(makeRectangle()));
+		});
+
+		run("proceduralTexture", std::string{ "shared_hit" } + std::string{ suffix }, 1, [&makeRectangle]()
+		{
+			(void)gui::createSharedTextureFromDrawables(makeRectangle());
+		});
+	}
+
+	gui::SpriteWrapper::enableAtlas(false);
+}
+
+void benchmarkFramePreparation(sf::RenderTexture& target)
+{
+	if (!isSelected("framePreparation"))
+		return;
+
+	// Here, `elements` is the number of windows. Each window has a batched interface whose sprites all
+	// change color every frame, so that all their vertices are built again. In the `_texts` variants,
+	// all texts also display a new number every frame, so that they are laid out again.
+	constexpr size_t nbOfSpritesPerWindow{ 10'000 };
+	constexpr size_t nbOfTextsPerWindow{ 100 };
+
+	for (const size_t nbOfWindows : { size_t{ 1 }, size_t{ 2 }, size_t{ 4 }, size_t{ 8 } })
+	{
+		std::vector<std::unique_ptr<sf::RenderWindow>> windows{};
+		std::vector<std::unique_ptr<MGUI>> guis{}; // Destroyed before their windows.
+		std::vector<std::vector<gui::SpriteWrapper*>> sprites(nbOfWindows);
+		std::vector<std::vector<gui::TextWrapper*>> texts(nbOfWindows);
+
+		for (size_t w{ 0 }; w < nbOfWindows; ++w)
+		{
+			windows.push_back(std::make_unique<sf::RenderWindow>(sf::VideoMode{ { 1080, 1080 } }, "SIFL benchmark", sf::Style::None));
+			windows.back()->setVisible(false);
+
+			MGUI& gui{ *guis.emplace_back(std::make_unique<MGUI>(windows.back().get(), 1080)) };
+			gui.reserve(nbOfTextsPerWindow, nbOfSpritesPerWindow);
+			for (size_t i{ 0 }; i < nbOfSpritesPerWindow; ++i)
+				gui.addDynamicSprite(std::to_string(i), "benchmark", sf::Vector2f{ static_cast<float>(i % 100) * 10.f, static_cast<float>((i / 100) % 100) * 10.f }, sf::Vector2f{ 0.25f, 0.25f });
+			for (size_t i{ 0 }; i < nbOfTextsPerWindow; ++i)
+				gui.addDynamicText("text" + std::to_string(i), 0, sf::Vector2f{ static_cast<float>(i % 10) * 100.f, static_cast<float>(i / 10) * 100.f }, 12u);
+			gui.lockInterface(true, true);
+
+			for (size_t i{ 0 }; i < nbOfSpritesPerWindow; ++i)
+				sprites[w].push_back(gui.getDynamicSprite(std::to_string(i)));
+			for (size_t i{ 0 }; i < nbOfTextsPerWindow; ++i)
+				texts[w].push_back(gui.getDynamicText("text" + std::to_string(i)));
+		}
+
+		size_t frame{ 0 };
+		bool areTextsChanging{ false };
+		const auto update{ [&sprites, &texts, &frame, &areTextsChanging](size_t window)
+		{
+			const sf::Color color{ (frame % 2 == 0) ? sf::Color::White : sf::Color::Red };
+			for (gui::SpriteWrapper* sprite : sprites[window])
+				sprite->setColor(color);
+
+			if (areTextsChanging)
+				for (gui::TextWrapper* text : texts[window])
+					text->setContent(frame);
+		} };
+
+		gui::FramePreparer preparer{};
+		std::vector<gui::BasicInterface*> drawnInterfaces{};
+		for (size_t w{ 0 }; w < nbOfWindows; ++w)
+		{
+			preparer.setUpdate(windows[w].get(), [&update, w]() { update(w); });
+			drawnInterfaces.push_back(guis[w].get());
+		}
+
+		for (const bool isTextVariant : { false, true })
+		{
+			areTextsChanging = isTextVariant;
+			const std::string suffix{ isTextVariant ? "_texts" : "" };
+
+			run("framePreparation", "serial" + suffix, nbOfWindows, [&]()
+			{
+				++frame;
+				for (size_t w{ 0 }; w < nbOfWindows; ++w)
+				{
+					update(w);
+					target.clear();
+					guis[w]->draw(target);
+					target.display();
+				}
+			});
+
+			run("framePreparation", "parallel" + suffix, nbOfWindows, [&]()
+			{
+				++frame;
+				preparer.prepare(drawnInterfaces);
+				for (size_t w{ 0 }; w < nbOfWindows; ++w)
+				{
+					target.clear();
+					guis[w]->draw(target);
+					target.display();
+				}
+			});
+		}
+	}
+}
+
+/**
+ * \brief The hash used before `TransparentHash` read strings by blocks: one mix per character.
+ */
+constexpr std::uint64_t bytewiseMix(std::uint64_t a, std::uint64_t b) noexcept
+{
+	a ^= b;
+	a ^= (a >> 32);
+	a *= 0xd6e8feb86659fd93ull;
+	a ^= (a >> 32);
+	a *= 0xd6e8feb86659fd93ull;
+	a ^= (a >> 32);
+	return a;
+}
+
+constexpr size_t bytewiseHash(std::string_view s) noexcept
+{
+	std::uint64_t hash{ s.size() * 0xa0761d6478bd642full };
+
+	for (const char c : s)
+		hash = bytewiseMix(hash ^ static_cast<unsigned char>(c), 0xe7037ed1a0b428dbull);
+
+	return static_cast<size_t>(bytewiseMix(hash, static_cast<std::uint64_t>(s.size())));
+}
+
+/**
+ * \brief Reports how well a hash spreads identifiers shaped like those of the library.
+ *
+ * - collisions: full 64 bits collisions, which should be 0.
+ * - chi_square_ratio: chi-square of the low bits, used as bucket indexes, over its expected value;
+ *   close to 1 for a uniform hash.
+ * - avalanche: mean number of output bits flipped when one input bit is flipped; 32 is ideal.
+ */
+template<typename Hash>
+void reportQuality(std::string_view variant, const Hash& hash)
+{
+	constexpr size_t nbOfKeys{ 1 << 20 };
+	constexpr size_t nbOfBuckets{ 1 << 16 };
+
+	std::vector<size_t> hashes{};
+	std::vector<size_t> buckets(nbOfBuckets, 0);
+	hashes.reserve(nbOfKeys);
+
+	for (size_t i{ 0 }; i < nbOfKeys; ++i)
+	{	// Sequential suffixes, like the boxes of multiple question boxes.
+		const std::string key{ "_mqb_" + std::to_string(i % 1024) + '_' + std::to_string(i / 1024) };
+		hashes.push_back(hash(key));
+		++buckets[hashes.back() % nbOfBuckets];
+	}
+
+	std::sort(hashes.begin(), hashes.end());
+	const size_t collisions{ static_cast<size_t>(hashes.end() - std::unique(hashes.begin(), hashes.end())) };
+
+	const double expected{ static_cast<double>(nbOfKeys) / nbOfBuckets };
+	double chiSquare{ 0. };
+	for (const size_t count : buckets)
+		chiSquare += (static_cast<double>(count) - expected) * (static_cast<double>(count) - expected) / expected;
+
+	size_t flippedBits{ 0 }, nbOfFlips{ 0 };
+	for (size_t i{ 0 }; i < 4096; ++i)
+	{
+		std::string key{ "texture" + std::to_string(i) };
+		const size_t original{ hash(key) };
+
+		for (size_t bit{ 0 }; bit < key.size() * 8; ++bit, ++nbOfFlips)
+		{
+			key[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+			flippedBits += static_cast<size_t>(std::popcount(static_cast<std::uint64_t>(original ^ hash(key))));
+			key[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+		}
+	}
+
+	std::printf("{\"benchmark\":\"TransparentHash\",\"variant\":\"quality_%.*s\",\"elements\":%zu,\"collisions\":%zu,\"chi_square_ratio\":%.3f,\"avalanche\":%.2f}\n",
+		static_cast<int>(variant.size()), variant.data(), nbOfKeys, collisions, chiSquare / static_cast<double>(nbOfBuckets - 1), static_cast<double>(flippedBits) / static_cast<double>(nbOfFlips));
+	std::fflush(stdout);
+}
+
+void benchmarkHash()
+{
+	if (!isSelected("TransparentHash"))
+		return;
+
+	// Every registry of the library is keyed by strings: text, sprite, button, font and texture names.
+	constexpr gui::TransparentHash hash{};
+	static_assert(hash(std::string_view{ "defaultFont" }) != hash(std::string_view{ "defaultFonT" }), "TransparentHash must remain usable at compile time");
+
+	// The number of elements is the length of the hashed strings.
+	for (const size_t length : { size_t{ 4 }, size_t{ 8 }, size_t{ 16 }, size_t{ 24 }, size_t{ 64 }, size_t{ 256 } })
+	{
+		std::vector<std::string> keys{};
+		for (size_t i{ 0 }; i < 256; ++i)
+		{
+			std::string key{ "_mqb_" + std::to_string(i) + '_' };
+			key.resize(length, static_cast<char>('a' + i % 26));
+			keys.push_back(std::move(key));
+		}
+
+		size_t next{ 0 }, sink{ 0 };
+		run("TransparentHash", "block", length, [&]() { sink += hash(std::string_view{ keys[next++ % keys.size()] }); });
+		run("TransparentHash", "bytewise", length, [&]() { sink += bytewiseHash(keys[next++ % keys.size()]); });
+
+		if (sink == 42) // Keeps the hashes from being optimized away.
+			std::fputc(' ', stderr);
+	}
+
+	reportQuality("block", [&hash](std::string_view key) { return hash(key); });
+	reportQuality("bytewise", [](std::string_view key) { return bytewiseHash(key); });
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+	if (argc > 1)
+		s_filter = argv[1];
+
+	std::printf("{\"library\":\"SIFL\",\"version\":\"%s\",\"build\":\"%s\"}\n", SIFL_VERSION, gui::Profiler::s_isEnabled ? "debug" : "release");
+
+	sf::RenderWindow window{ sf::VideoMode{ { 1080, 1080 } }, "SIFL benchmark", sf::Style::None };
+	window.setVisible(false);
+
+	sf::RenderTexture target{ window.getSize() };
+	gui::SpriteWrapper::createTexture("benchmark", sf::Texture{ sf::Image{ sf::Vector2u{ 32, 32 }, sf::Color::White } }, gui::SpriteWrapper::Reserved::No);
+
+	benchmarkDraw(window, target);
+	benchmarkHover(window);
+	benchmarkInputDispatch(window);
+	benchmarkStaticInterface(window);
+	benchmarkChurn(window);
+	benchmarkAddInteractive(window);
+	benchmarkSetContent(window);
+	benchmarkResize(window, target);
+	benchmarkAnimation(window);
+	benchmarkTween(window);
+	benchmarkScrollList(window);
+	benchmarkTextureLoading();
+	benchmarkProceduralTexture();
+	benchmarkFramePreparation(target);
+	benchmarkHash();
+
+	return 0;
+}
@@ -0,0 +1,146 @@
+/*******************************************************************
+ * \file   ArenaAllocator.hpp
+ * \brief  Declare an allocator drawing from a memory resource, through which interfaces allocate their elements.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note This file only depends on the standard library.
+ *********************************************************************/
+
+#ifndef ARENAALLOCATOR_HPP
+#define ARENAALLOCATOR_HPP
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gui
+{
+
+/**
+ * \brief Allocates from a `std::pmr::memory_resource`, or from the global heap if there is none.
+ *
+ * Unlike `std::pmr::polymorphic_allocator`, the allocator follows the storage when a container is move
+ * assigned or swapped: interfaces swap their containers when they are moved, which would otherwise be
+ * undefined behavior between two arenas. Elements that accept an allocator, such as `ArenaString` or
+ * `SpriteWrapper`, are given the one of their container when it constructs them.
+ *
+ * A default constructed allocator has no resource: it costs as much as `std::allocator`.
+ *
+ * \see `BasicInterface`, which owns the arena its elements are allocated from.
+ */
+template<typename T = std::byte>
+class ArenaAllocator
+{
+public:
+
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::false_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+	using is_always_equal = std::false_type;
+
+
+	constexpr ArenaAllocator() noexcept
+		: m_resource{ nullptr }
+	{}
+
+	/**
+	 * \param[in] resource Where the memory comes from, or nullptr for the global heap. It must outlive
+	 *					   the allocations.
+	 */
+	constexpr ArenaAllocator(std::pmr::memory_resource* resource) noexcept
+		: m_resource{ resource }
+	{}
+
+	template<typename U>
+	constexpr ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+		: m_resource{ other.getResource() }
+	{}
+
+
+	/**
+	 * \brief Allocates room for n elements, without constructing them.
+	 * \complexity The one of the resource.
+	 *
+	 * \throw std::bad_array_new_length, std::bad_alloc, or what the resource throws. Strong exception guarantee.
+	 */
+	[[nodiscard]] inline T* allocate(size_t n)
+	{
+		if (m_resource == nullptr)
+			return std::allocator<T>{}.allocate(n);
+
+		if (n > std::numeric_limits<size_t>::max() / sizeof(T)) [[unlikely]]
+			throw std::bad_array_new_length{};
+
+		return static_cast<T*>(m_resource->allocate(n * sizeof(T), alignof(T)));
+	}
+
+	inline void deallocate(T* pointer, size_t n) noexcept
+	{
+		if (m_resource == nullptr)
+			std::allocator<T>{}.deallocate(pointer, n);
+		else
+			m_resource->deallocate(pointer, n * sizeof(T), alignof(T));
+	}
+
+	/**
+	 * \brief Constructs an element, and gives it this allocator if it accepts one.
+	 * \throw What the constructor of the element throws.
+	 */
+	template<typename U, typename... Args>
+	inline void construct(U* pointer, Args&&... args)
+	{
+		std::uninitialized_construct_using_allocator(pointer, *this, std::forward<Args>(args)...);
+	}
+
+	/**
+	 * \brief Copies of containers allocate from the global heap, like `std::pmr::polymorphic_allocator`
+	 *		  copies allocate from the default resource.
+	 */
+	[[nodiscard]] constexpr ArenaAllocator select_on_container_copy_construction() const noexcept
+	{
+		return ArenaAllocator{};
+	}
+
+	/**
+	 * \brief Returns the resource, or nullptr if the memory comes from the global heap.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] constexpr std::pmr::memory_resource* getResource() const noexcept
+	{
+		return m_resource;
+	}
+
+	template<typename U>
+	[[nodiscard]] inline bool operator==(const ArenaAllocator<U>& other) const noexcept
+	{
+		if (m_resource == other.getResource())
+			return true;
+
+		return m_resource != nullptr && other.getResource() != nullptr && m_resource->is_equal(*other.getResource());
+	}
+
+private:
+
+	/// Where the memory comes from, or nullptr for the global heap.
+	std::pmr::memory_resource* m_resource;
+};
+
+/// A string allocated from an arena. Converts to `std::string_view` for lookups.
+using ArenaString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+
+/// A vector allocated from an arena.
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+} // gui namespace
+
+#endif // ARENAALLOCATOR_HPP
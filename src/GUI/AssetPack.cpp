@@ -0,0 +1,441 @@
+#include "AssetPack.hpp"
+#include "GraphicalResources.hpp"
+#include "Profiler.hpp"
+#include <algorithm>
+#include <fstream>
+#include <cstring>
+#include <bit>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif // WIN32_LEAN_AND_MEAN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif // NOMINMAX
+#include <windows.h>
+#else // _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+namespace gui
+{
+
+static_assert(std::endian::native == std::endian::little, "Asset packs are read in place: they are stored little-endian");
+
+namespace
+{
+
+constexpr char s_magic[8]{ 'S', 'I', 'F', 'L', 'P', 'A', 'C', 'K' };
+constexpr std::uint32_t s_version{ 1 };
+constexpr size_t s_payloadAlignment{ 16 }; // Lets the pixels be read with aligned loads.
+
+/// The first bytes of a pack.
+struct Header
+{
+	char magic[8];
+	std::uint32_t version;
+	std::uint32_t nbOfEntries;
+	std::uint64_t indexOffset;
+	std::uint64_t namesOffset;
+};
+static_assert(sizeof(Header) == 32);
+
+/// An entry of the index. The name offset is relative to the names.
+struct Record
+{
+	std::uint64_t dataOffset;
+	std::uint64_t dataSize;
+	std::uint32_t nameOffset;
+	std::uint32_t nameSize;
+	std::uint32_t width;
+	std::uint32_t height;
+	std::uint8_t kind;
+	std::uint8_t format;
+	std::uint8_t padding[6];
+};
+static_assert(sizeof(Record) == 40);
+
+/**
+ * \brief Reads a trivially copyable value from the mapped memory, which may not be aligned for it.
+ */
+template<typename T>
+[[nodiscard]] T readAt(const std::byte* data, size_t offset) noexcept
+{
+	T value;
+	std::memcpy(&value, data + offset, sizeof(T));
+	return value;
+}
+
+[[nodiscard]] constexpr size_t alignUp(size_t offset, size_t alignment) noexcept
+{
+	return (offset + alignment - 1) / alignment * alignment;
+}
+
+} // anonymous namespace
+
+
+AssetPack::~AssetPack() noexcept
+{
+	if (m_data == nullptr)
+		return;
+
+#ifdef _WIN32
+	UnmapViewOfFile(m_data);
+#else // _WIN32
+	munmap(const_cast<std::byte*>(m_data), m_size);
+#endif // _WIN32
+}
+
+std::shared_ptr<const AssetPack> AssetPack::open(std::ostringstream& errorMessage, std::string_view fileName, std::string_view path) noexcept
+{
+	try
+	{
+		const std::filesystem::path completePath{ std::filesystem::path(path) / fileName };
+		std::shared_ptr<AssetPack> pack{ new AssetPack{} }; // Unmaps the file if the pack is invalid.
+
+#ifdef _WIN32
+		const HANDLE file{ CreateFileW(completePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+		if (file == INVALID_HANDLE_VALUE) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "Asset pack does not exist: " + completePath.string() + '\n' };
+
+		LARGE_INTEGER fileSize{};
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(Header))) [[unlikely]]
+		{
+			CloseHandle(file);
+			throw LoadingGraphicalResourceFailure{ "Asset pack is too small: " + completePath.string() + '\n' };
+		}
+
+		const HANDLE mapping{ CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr) };
+		CloseHandle(file); // The mapping keeps the file open.
+		if (mapping == nullptr) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "Failed to map the asset pack " + completePath.string() + '\n' };
+
+		const void* const address{ MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) };
+		CloseHandle(mapping); // The view keeps the mapping.
+		if (address == nullptr) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "Failed to map the asset pack " + completePath.string() + '\n' };
+
+		pack->m_data = static_cast<const std::byte*>(address);
+		pack->m_size = static_cast<size_t>(fileSize.QuadPart);
+#else // _WIN32
+		const int file{ ::open(completePath.c_str(), O_RDONLY) };
+		if (file < 0) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "Asset pack does not exist: " + completePath.string() + '\n' };
+
+		struct stat status{};
+		if (fstat(file, &status) != 0 || status.st_size < static_cast<off_t>(sizeof(Header))) [[unlikely]]
+		{
+			close(file);
+			throw LoadingGraphicalResourceFailure{ "Asset pack is too small: " + completePath.string() + '\n' };
+		}
+
+		void* const address{ mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0) };
+		close(file); // The mapping keeps the file open.
+		if (address == MAP_FAILED) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "Failed to map the asset pack " + completePath.string() + '\n' };
+
+		pack->m_data = static_cast<const std::byte*>(address);
+		pack->m_size = static_cast<size_t>(status.st_size);
+#endif // _WIN32
+
+		// The whole index is checked once, so that entries are read without any check afterward.
+		const Header header{ readAt<Header>(pack->m_data, 0) };
+		if (std::memcmp(header.magic, s_magic, sizeof(s_magic)) != 0 || header.version != s_version) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "Not an asset pack, or of another version: " + completePath.string() + '\n' };
+
+		const size_t size{ pack->m_size };
+		if (header.namesOffset > header.indexOffset || header.indexOffset > size || header.nbOfEntries > (size - header.indexOffset) / sizeof(Record)) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "Corrupted index in the asset pack " + completePath.string() + '\n' };
+
+		pack->m_nbOfEntries = header.nbOfEntries;
+		pack->m_indexOffset = static_cast<size_t>(header.indexOffset);
+		pack->m_namesOffset = static_cast<size_t>(header.namesOffset);
+
+		const size_t namesSize{ pack->m_indexOffset - pack->m_namesOffset };
+		std::string_view previousName{};
+
+		for (size_t i{ 0 }; i < pack->m_nbOfEntries; ++i)
+		{
+			const Record record{ readAt<Record>(pack->m_data, pack->m_indexOffset + i * sizeof(Record)) };
+
+			const bool isInFile{ record.dataOffset <= size && record.dataSize <= size - record.dataOffset && record.nameOffset <= namesSize && record.nameSize <= namesSize - record.nameOffset };
+			const bool isKnown{ record.kind <= static_cast<std::uint8_t>(Kind::Font) && record.format <= static_cast<std::uint8_t>(Format::Rgba) };
+			const bool isRgba{ record.format == static_cast<std::uint8_t>(Format::Rgba) };
+			const bool hasPixels{ !isRgba || (record.kind == static_cast<std::uint8_t>(Kind::Texture) && record.dataSize == std::uint64_t{ record.width } * record.height * 4) };
+
+			if (!isInFile || !isKnown || !hasPixels) [[unlikely]]
+				throw LoadingGraphicalResourceFailure{ "Corrupted entry " + std::to_string(i) + " in the asset pack " + completePath.string() + '\n' };
+
+			const std::string_view name{ reinterpret_cast<const char*>(pack->m_data + pack->m_namesOffset + record.nameOffset), record.nameSize };
+			if (i != 0 && !(previousName < name)) [[unlikely]]
+				throw LoadingGraphicalResourceFailure{ "Unsorted index in the asset pack " + completePath.string() + '\n' };
+
+			previousName = name;
+		}
+
+		return pack;
+	}
+	catch (const LoadingGraphicalResourceFailure& error)
+	{
+		errorMessage << error.what();
+		errorMessage << "The resources of this pack cannot be displayed\n";
+		return nullptr;
+	}
+	catch (const std::exception& error)
+	{
+		errorMessage << "Failed to open an asset pack: " << error.what() << '\n';
+		return nullptr;
+	}
+}
+
+bool AssetPack::save(std::ostringstream& errorMessage, const std::filesystem::path& file, std::vector<Source> sources) noexcept
+{
+	try
+	{
+		std::sort(sources.begin(), sources.end(), [](const Source& a, const Source& b) { return a.name < b.name; });
+
+		for (size_t i{ 0 }; i < sources.size(); ++i)
+		{
+			const Source& source{ sources[i] };
+
+			if (i != 0 && source.name == sources[i - 1].name) [[unlikely]]
+				throw LoadingGraphicalResourceFailure{ "Two entries are named " + source.name + '\n' };
+			if (source.format == Format::Rgba && (source.kind != Kind::Texture || source.data.size() != size_t{ source.size.x } * source.size.y * 4)) [[unlikely]]
+				throw LoadingGraphicalResourceFailure{ "The entry " + source.name + " is not made of 4 bytes per pixel\n" };
+		}
+
+		// Payloads first, then names, then the index.
+		std::vector<Record> index(sources.size());
+		size_t offset{ sizeof(Header) };
+		size_t namesSize{ 0 };
+
+		for (size_t i{ 0 }; i < sources.size(); ++i)
+		{
+			const Source& source{ sources[i] };
+			offset = alignUp(offset, s_payloadAlignment);
+
+			index[i] = Record{ .dataOffset = offset, .dataSize = source.data.size(), .nameOffset = static_cast<std::uint32_t>(namesSize), .nameSize = static_cast<std::uint32_t>(source.name.size()),
+				.width = source.size.x, .height = source.size.y, .kind = static_cast<std::uint8_t>(source.kind), .format = static_cast<std::uint8_t>(source.format), .padding = {} };
+
+			offset += source.data.size();
+			namesSize += source.name.size();
+		}
+
+		const size_t namesOffset{ offset };
+		const size_t indexOffset{ alignUp(namesOffset + namesSize, alignof(std::uint64_t)) };
+		Header header{ .magic = {}, .version = s_version, .nbOfEntries = static_cast<std::uint32_t>(sources.size()), .indexOffset = indexOffset, .namesOffset = namesOffset };
+		std::memcpy(header.magic, s_magic, sizeof(s_magic));
+
+		std::ofstream output{ file, std::ios::binary | std::ios::trunc };
+		if (!output) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "Failed to create the asset pack " + file.string() + '\n' };
+
+		const auto writePadding{ [&output](size_t from, size_t to) { for (; from < to; ++from) output.put('\0'); } };
+
+		output.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+		for (size_t i{ 0 }; i < sources.size(); ++i)
+		{
+			const size_t end{ (i == 0) ? sizeof(Header) : static_cast<size_t>(index[i - 1].dataOffset + index[i - 1].dataSize) };
+			writePadding(end, static_cast<size_t>(index[i].dataOffset));
+			output.write(reinterpret_cast<const char*>(sources[i].data.data()), static_cast<std::streamsize>(sources[i].data.size()));
+		}
+
+		for (const Source& source : sources)
+			output.write(source.name.data(), static_cast<std::streamsize>(source.name.size()));
+
+		writePadding(namesOffset + namesSize, indexOffset);
+		output.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size() * sizeof(Record)));
+
+		output.flush();
+		if (!output) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "Failed to write the asset pack " + file.string() + '\n' };
+
+		return true;
+	}
+	catch (const LoadingGraphicalResourceFailure& error)
+	{
+		errorMessage << error.what();
+		return false;
+	}
+	catch (const std::exception& error)
+	{
+		errorMessage << "Failed to write the asset pack " << file.string() << ": " << error.what() << '\n';
+		return false;
+	}
+}
+
+std::optional<AssetPack::Source> AssetPack::readSource(std::ostringstream& errorMessage, std::string name, const std::filesystem::path& file, Kind kind, Format format) noexcept
+{
+	try
+	{
+		if (!std::filesystem::exists(file)) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "File does not exist: " + file.string() + '\n' };
+
+		Source source{ .name = std::move(name), .kind = kind, .format = format, .size = {}, .data = {} };
+
+		if (format == Format::Rgba)
+		{
+			if (kind != Kind::Texture) [[unlikely]]
+				throw LoadingGraphicalResourceFailure{ "Only textures can be decoded ahead of time: " + file.string() + '\n' };
+
+			sf::Image image{};
+			if (!image.loadFromFile(file)) [[unlikely]]
+				throw LoadingGraphicalResourceFailure{ "Failed to load image from file " + file.string() + '\n' };
+
+			source.size = image.getSize();
+			const std::byte* const pixels{ reinterpret_cast<const std::byte*>(image.getPixelsPtr()) };
+			source.data.assign(pixels, pixels + size_t{ source.size.x } * source.size.y * 4);
+			return source;
+		}
+
+		std::ifstream input{ file, std::ios::binary };
+		source.data.resize(static_cast<size_t>(std::filesystem::file_size(file)));
+		if (!input.read(reinterpret_cast<char*>(source.data.data()), static_cast<std::streamsize>(source.data.size()))) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "Failed to read the file " + file.string() + '\n' };
+
+		return source;
+	}
+	catch (const LoadingGraphicalResourceFailure& error)
+	{
+		errorMessage << error.what();
+		return std::nullopt;
+	}
+	catch (const std::exception& error)
+	{
+		errorMessage << "Failed to read the file " << file.string() << ": " << error.what() << '\n';
+		return std::nullopt;
+	}
+}
+
+std::optional<AssetPack::Entry> AssetPack::find(std::string_view name) const noexcept
+{
+	size_t first{ 0 };
+	size_t count{ m_nbOfEntries };
+
+	while (count > 0)
+	{	// Lower bound among the sorted names.
+		const size_t half{ count / 2 };
+		if (getEntry(first + half).name < name)
+		{
+			first += half + 1;
+			count -= half + 1;
+		}
+		else
+		{
+			count = half;
+		}
+	}
+
+	if (first == m_nbOfEntries)
+		return std::nullopt;
+
+	const Entry entry{ getEntry(first) };
+	return (entry.name == name) ? std::optional<Entry>{ entry } : std::nullopt;
+}
+
+std::optional<sf::Texture> AssetPack::loadTexture(std::ostringstream& errorMessage, std::string_view name) const noexcept
+{
+	PROFILE_SCOPE(textureLoadTime);
+
+	try
+	{
+		const std::optional<Entry> entry{ find(name) };
+		if (!entry.has_value() || entry->kind != Kind::Texture) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "No texture named " + std::string{ name } + " in the asset pack\n" };
+
+		sf::Texture texture{};
+		if (entry->format == Format::Encoded)
+		{
+			if (!texture.loadFromMemory(entry->data.data(), entry->data.size())) [[unlikely]]
+				throw LoadingGraphicalResourceFailure{ "Failed to load texture " + std::string{ name } + " from the asset pack\n" };
+		}
+		else
+		{	// Pre-decoded: uploaded straight from the mapped memory.
+			if (!texture.resize(entry->size)) [[unlikely]]
+				throw LoadingGraphicalResourceFailure{ "Failed to create texture " + std::string{ name } + " from the asset pack\n" };
+
+			texture.update(reinterpret_cast<const std::uint8_t*>(entry->data.data()));
+		}
+
+		texture.setSmooth(true);
+		PROFILE_COUNT(textureLoads, 1);
+		PROFILE_COUNT(textureLoadBytes, static_cast<size_t>(texture.getSize().x) * texture.getSize().y * 4);
+		return std::make_optional(std::move(texture));
+	}
+	catch (const LoadingGraphicalResourceFailure& error)
+	{
+		errorMessage << error.what();
+		errorMessage << "This texture cannot be displayed\n";
+		return std::nullopt;
+	}
+}
+
+std::optional<sf::Image> AssetPack::loadImage(std::ostringstream& errorMessage, std::string_view name) const noexcept
+{
+	try
+	{
+		const std::optional<Entry> entry{ find(name) };
+		if (!entry.has_value() || entry->kind != Kind::Texture) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "No texture named " + std::string{ name } + " in the asset pack\n" };
+
+		if (entry->format == Format::Rgba)
+			return std::make_optional(sf::Image{ entry->size, reinterpret_cast<const std::uint8_t*>(entry->data.data()) });
+
+		sf::Image image{};
+		if (!image.loadFromMemory(entry->data.data(), entry->data.size())) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "Failed to load image " + std::string{ name } + " from the asset pack\n" };
+
+		return std::make_optional(std::move(image));
+	}
+	catch (const LoadingGraphicalResourceFailure& error)
+	{
+		errorMessage << error.what();
+		errorMessage << "This texture cannot be displayed\n";
+		return std::nullopt;
+	}
+}
+
+std::optional<sf::Font> AssetPack::openFont(std::ostringstream& errorMessage, std::string_view name) const noexcept
+{
+	PROFILE_SCOPE(fontLoadTime);
+	PROFILE_COUNT(fontLoads, 1);
+
+	try
+	{
+		const std::optional<Entry> entry{ find(name) };
+		if (!entry.has_value() || entry->kind != Kind::Font) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "No font named " + std::string{ name } + " in the asset pack\n" };
+
+		sf::Font font{};
+		if (!font.openFromMemory(entry->data.data(), entry->data.size())) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "Failed to load font " + std::string{ name } + " from the asset pack\n" };
+
+		font.setSmooth(true);
+		return font;
+	}
+	catch (const LoadingGraphicalResourceFailure& error)
+	{
+		errorMessage << error.what();
+		errorMessage << "This font cannot be displayed\n";
+		return std::nullopt;
+	}
+}
+
+AssetPack::Entry AssetPack::getEntry(size_t index) const noexcept
+{
+	const Record record{ readAt<Record>(m_data, m_indexOffset + index * sizeof(Record)) };
+
+	return Entry{
+		.name = std::string_view{ reinterpret_cast<const char*>(m_data + m_namesOffset + record.nameOffset), record.nameSize },
+		.kind = static_cast<Kind>(record.kind),
+		.format = static_cast<Format>(record.format),
+		.size = sf::Vector2u{ record.width, record.height },
+		.data = std::span<const std::byte>{ m_data + record.dataOffset, static_cast<size_t>(record.dataSize) }
+	};
+}
+
+} // gui namespace
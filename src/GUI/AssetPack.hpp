@@ -0,0 +1,254 @@
+/*******************************************************************
+ * \file   AssetPack.hpp, AssetPack.cpp
+ * \brief  Declare a pack file that holds many textures and fonts, mapped in memory once and read
+ *		   without any other file access.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note These files depend on the SFML library.
+ * \note The pack is memory-mapped with `mmap` on POSIX systems, and with `MapViewOfFile` on Windows.
+ *********************************************************************/
+
+#ifndef ASSETPACK_HPP
+#define ASSETPACK_HPP
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <string_view>
+#include <filesystem>
+#include <optional>
+#include <sstream>
+#include <memory>
+#include <vector>
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+namespace gui
+{
+
+/**
+ * \brief A read-only pack of textures and fonts, found with their name.
+ *
+ * Loading hundreds of files means hundreds of metadata calls, opens and reads, and as many PNG
+ * decodings. Instead, the files are packed ahead of time by the packer tool (`SIFL_BUILD_TOOLS`), or
+ * by `save`. The pack is mapped in memory once: its index is read in place, and the resources are
+ * created straight from the mapped bytes.
+ *
+ * Textures are stored either as their original file (png, jpg...), decoded when loaded, or as
+ * pre-decoded RGBA pixels, which are uploaded without any decoding at the cost of a larger pack.
+ * Fonts are stored as their original file.
+ *
+ * Packs are shared: `SpriteWrapper::createTexture` and `TextWrapper::createFont` accept a pack and an
+ * entry name instead of a file name, and keep the pack alive as long as their resources need it.
+ * Textures created from a pack can be unloaded, evicted and streamed like those created from a file.
+ *
+ * Format, little-endian:
+ * - A header: the magic `SIFLPACK`, the version, the number of entries, and the offsets of the index
+ *	 and of the names.
+ * - The payloads, each aligned on 16 bytes.
+ * - The names, one after the other, without terminating character.
+ * - The index: one fixed-size record per entry, sorted by name, so that entries are found with a
+ *	 binary search without building anything at opening.
+ *
+ * \note GPU-compressed payloads are not supported: SFML textures can only be created from pixels or
+ *		 from an encoded image.
+ * \note All functions are const, and can be called from any thread, except the ones creating a
+ *		 `sf::Texture`: see `loadTextureFromFile`.
+ *
+ * \code
+ * // Once, at build time: SIFL3_packer ui.siflpack button.png --rgba hero.png font.ttf
+ * std::ostringstream errorMessage{};
+ * const std::shared_ptr<const gui::AssetPack> pack{ gui::AssetPack::open(errorMessage, "ui.siflpack") };
+ * if (pack == nullptr)
+ *		showErrorsUsingWindow("Missing pack", errorMessage);
+ *
+ * gui::SpriteWrapper::createTexture("button", pack, "button.png", gui::SpriteWrapper::Reserved::No);
+ * gui::TextWrapper::createFont("__default", pack, "font.ttf");
+ * \endcode
+ *
+ * \see `SpriteWrapper::createTexture`, `TextWrapper::createFont`.
+ */
+class AssetPack
+{
+public:
+
+	/**
+	 * \brief What an entry is.
+	 */
+	enum class Kind : std::uint8_t { Texture, Font };
+
+	/**
+	 * \brief How the payload of an entry is stored.
+	 * `Encoded` is the original file. `Rgba` is 4 bytes per pixel, row after row: textures only.
+	 */
+	enum class Format : std::uint8_t { Encoded, Rgba };
+
+	/**
+	 * \brief An entry of the pack. Views the mapped memory: valid as long as the pack exists.
+	 */
+	struct Entry
+	{
+		std::string_view name;
+		Kind kind;
+		Format format;
+		sf::Vector2u size; // The size in pixels of `Rgba` textures, 0 otherwise.
+		std::span<const std::byte> data;
+	};
+
+	/**
+	 * \brief An entry to write into a pack with `save`.
+	 */
+	struct Source
+	{
+		std::string name;
+		Kind kind;
+		Format format;
+		sf::Vector2u size; // The size in pixels of `Rgba` textures, 0 otherwise.
+		std::vector<std::byte> data;
+	};
+
+
+	AssetPack(const AssetPack&) noexcept = delete;
+	AssetPack(AssetPack&&) noexcept = delete;
+	AssetPack& operator=(const AssetPack&) noexcept = delete;
+	AssetPack& operator=(AssetPack&&) noexcept = delete;
+	~AssetPack() noexcept;
+
+
+	/**
+	 * \brief Maps a pack in memory, and checks its index.
+	 * \complexity O(N), where N is the number of entries. The payloads are not read.
+	 *
+	 * \param[out] errorMessage Will add the error message to this stream if the opening fails.
+	 * \param[in]  fileName The name of the pack.
+	 * \param[in]  path The path to this file.
+	 *
+	 * \return The pack, or nullptr if it does not exist or is not a valid pack.
+	 *
+	 * \note A message is added to the stream only if the function returns nullptr.
+	 */
+	[[nodiscard]] static std::shared_ptr<const AssetPack> open(std::ostringstream& errorMessage, std::string_view fileName, std::string_view path = "../assets/") noexcept;
+
+	/**
+	 * \brief Writes a pack.
+	 * \complexity O(N log N + S), where N is the number of entries and S the size of their payloads.
+	 *
+	 * \param[out] errorMessage Will add the error message to this stream if the writing fails.
+	 * \param[in]  file The complete path of the pack.
+	 * \param[in]  sources The entries, in any order.
+	 *
+	 * \return `true` if the pack was written.
+	 *
+	 * \pre The names must be unique, and `Rgba` payloads must hold 4 bytes per pixel.
+	 * \note A message is added to the stream only if the function returns `false`.
+	 */
+	[[nodiscard]] static bool save(std::ostringstream& errorMessage, const std::filesystem::path& file, std::vector<Source> sources) noexcept;
+
+	/**
+	 * \brief Reads a file into an entry, ready to be saved.
+	 * \complexity O(S), where S is the size of the file, plus its decoding for `Rgba` textures.
+	 *
+	 * \param[out] errorMessage Will add the error message to this stream if the reading fails.
+	 * \param[in]  name The name of the entry.
+	 * \param[in]  file The complete path of the file.
+	 * \param[in]  kind What the file is.
+	 * \param[in]  format How to store it: `Rgba` textures are decoded now.
+	 *
+	 * \return The entry, or nothing if the file could not be read.
+	 */
+	[[nodiscard]] static std::optional<Source> readSource(std::ostringstream& errorMessage, std::string name, const std::filesystem::path& file, Kind kind, Format format) noexcept;
+
+
+	/**
+	 * \brief Returns an entry, or nothing if there is none with this name.
+	 * \complexity O(log N), where N is the number of entries.
+	 */
+	[[nodiscard]] std::optional<Entry> find(std::string_view name) const noexcept;
+
+	/**
+	 * \brief Creates a texture from a texture entry.
+	 * \complexity O(S), where S is the size of the payload, plus its decoding if it is `Encoded`.
+	 *
+	 * \param[out] errorMessage Will add the error message to this stream if the loading fails.
+	 * \param[in]  name The name of the entry.
+	 *
+	 * \return a sf::Texture if the loading was successful, std::nullopt otherwise.
+	 *
+	 * \see `loadTextureFromFile`.
+	 */
+	[[nodiscard]] std::optional<sf::Texture> loadTexture(std::ostringstream& errorMessage, std::string_view name) const noexcept;
+
+	/**
+	 * \brief Creates an image from a texture entry, without creating any graphical resource.
+	 * \complexity O(S), as `loadTexture`.
+	 *
+	 * \note Unlike `loadTexture`, it can be called from any thread.
+	 *
+	 * \see `loadImageFromFile`.
+	 */
+	[[nodiscard]] std::optional<sf::Image> loadImage(std::ostringstream& errorMessage, std::string_view name) const noexcept;
+
+	/**
+	 * \brief Opens a font from a font entry.
+	 * \complexity O(1): the font reads the mapped memory when glyphs are rasterized.
+	 *
+	 * \return a sf::Font if the opening was successful, std::nullopt otherwise.
+	 *
+	 * \warning The font reads the pack: the pack must outlive it. `TextWrapper::createFont` does so.
+	 *
+	 * \see `loadFontFromFile`.
+	 */
+	[[nodiscard]] std::optional<sf::Font> openFont(std::ostringstream& errorMessage, std::string_view name) const noexcept;
+
+	/**
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t getNbOfEntries() const noexcept
+	{
+		return m_nbOfEntries;
+	}
+
+	/**
+	 * \brief Returns the size of the mapped file, in bytes.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t getSize() const noexcept
+	{
+		return m_size;
+	}
+
+private:
+
+	/**
+	 * \brief Constructs an empty pack, mapped by `open`.
+	 * \complexity O(1).
+	 */
+	inline AssetPack() noexcept
+		: m_data{ nullptr }, m_size{ 0 }, m_nbOfEntries{ 0 }, m_indexOffset{ 0 }, m_namesOffset{ 0 }
+	{}
+
+	/**
+	 * \brief Returns the entry at a position within the index.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] Entry getEntry(size_t index) const noexcept;
+
+
+	/// The mapped file.
+	const std::byte* m_data;
+	/// The size of the mapped file, in bytes.
+	size_t m_size;
+
+	/// The number of entries.
+	size_t m_nbOfEntries;
+	/// Where the index starts within the file.
+	size_t m_indexOffset;
+	/// Where the names start within the file.
+	size_t m_namesOffset;
+};
+
+} // gui namespace
+
+#endif // ASSETPACK_HPP
@@ -4,23 +4,24 @@
 namespace gui
 {
 
-BasicInterface::BasicInterface(sf::RenderWindow* window, unsigned int relativeScalingDefinition) noexcept
-	: m_window{ window }, m_texts{}, m_sprites{}, m_relativeScalingDefinition{ relativeScalingDefinition }, m_lockState{ false }
+BasicInterface::BasicInterface(sf::RenderWindow* window, unsigned int relativeScalingDefinition, std::pmr::memory_resource* resource) noexcept
+	: m_window{ window }, m_ownedArena{ (resource == nullptr) ? std::make_unique<std::pmr::unsynchronized_pool_resource>() : nullptr },
+	  m_texts{ (resource == nullptr) ? m_ownedArena.get() : resource }, m_sprites{ m_texts.get_allocator() }, m_hiddenTexts{ m_texts.get_allocator() }, m_hiddenSprites{ m_texts.get_allocator() }, m_relativeScalingDefinition{ relativeScalingDefinition }, m_lockState{ false }, m_batchedDrawing{ false }, m_renderBatch{}, m_staticLayer{}, m_pendingPositionFactor{ 1.f, 1.f }, m_pendingScaleFactor{ 1.f }, m_isResizePending{ false }, m_positionFactor{ 1.f, 1.f }, m_context{ &ResourceContext::current() }
 {
 	ENSURE_SFML_WINDOW_VALIDITY(m_window, "Precondition violated; the window is invalid when the constructor of BasicInterface was called");
 
 	// Add this interface to the collection.
-	auto& interfaces{ s_allInterfaces[window] };
+	auto& interfaces{ m_context->m_interfaces[window] };
 	interfaces.push_back(this);
 } 
 
 BasicInterface::BasicInterface(BasicInterface&& other) noexcept
-	: m_window{ other.m_window }, m_texts{ std::move(other.m_texts) }, m_sprites{ std::move(other.m_sprites) }, m_relativeScalingDefinition{ other.m_relativeScalingDefinition }, m_lockState{ other.m_lockState }
+	: m_window{ other.m_window }, m_ownedArena{ std::move(other.m_ownedArena) }, m_texts{ std::move(other.m_texts) }, m_sprites{ std::move(other.m_sprites) }, m_hiddenTexts{ m_texts.get_allocator() }, m_hiddenSprites{ m_texts.get_allocator() }, m_relativeScalingDefinition{ other.m_relativeScalingDefinition }, m_lockState{ other.m_lockState }, m_batchedDrawing{ false }, m_renderBatch{}, m_staticLayer{}, m_pendingPositionFactor{ other.m_pendingPositionFactor }, m_pendingScaleFactor{ other.m_pendingScaleFactor }, m_isResizePending{ other.m_isResizePending }, m_positionFactor{ other.m_positionFactor }, m_context{ other.m_context }
 {
 	assert((!other.m_lockState) && "Precondition violated; the moved-from interface is locked when the move constructor of BasicInterface was called");
 
 	// Replacing the moved-from object by the new object in the collection anymore.
-	auto& interfaces{ s_allInterfaces.find(other.m_window)->second };
+	auto& interfaces{ m_context->m_interfaces.find(other.m_window)->second };
 	auto it = std::find_if(interfaces.begin(), interfaces.end(), [&other](BasicInterface* x) { return x == &other; });
 	*it = this;
 
@@ -34,28 +35,28 @@ BasicInterface& BasicInterface::operator=(BasicInterface&& other) noexcept
 	assert((!m_lockState) && "Precondition violated; the current interface is locked when the move assignment operator of BasicInterface was called");
 
 	// If the two interfaces are associated with different windows,
-	// we need to update the global static collection s_allInterfaces accordingly.
-	if (other.m_window != m_window)
+	// or different contexts, we need to update the collections of the contexts accordingly.
+	if (other.m_window != m_window || other.m_context != m_context)
 	{
-		// 1. Reassign the mapping of `other` in s_allInterfaces:
+		// 1. Reassign the mapping of `other` in its context:
 		//    - We're about to move `other` into `*this`, so the pointer to `other`
-		//      in s_allInterfaces should now point to `this`.
-		auto& interfacesOther{ s_allInterfaces.find(other.m_window)->second };
+		//      in the collection should now point to `this`.
+		auto& interfacesOther{ other.m_context->m_interfaces.find(other.m_window)->second };
 		auto itOther = std::find_if(interfacesOther.begin(), interfacesOther.end(), [&other](BasicInterface* x) { return x == &other; });
 		*itOther = this;
 
-		// As they have different windows, we do not need to worry about collision between those two loops
+		// As they have different windows or contexts, we do not need to worry about collision between those two loops
 
-		// 2. Reassign the mapping of `this` in s_allInterfaces:
+		// 2. Reassign the mapping of `this` in its context:
 		//    - After the move, `other` will hold the old state of `*this`.
-		//      So the entry in s_allInterfaces that previously pointed to `this`
+		//      So the entry in the collection that previously pointed to `this`
 		//      under m_window should now point to `other`.
-		auto& interfacesThis{ s_allInterfaces.find(this->m_window)->second };
+		auto& interfacesThis{ m_context->m_interfaces.find(this->m_window)->second };
 		auto itThis = std::find_if(interfacesThis.begin(), interfacesThis.end(), [this](BasicInterface* x) { return x == this; });
 		*itThis = &other;
 	}
 
-	// Else: If both `this` and `other` share the same window, we dont update s_allInterfaces.
+	// Else: If both `this` and `other` share the same window and context, we dont update the collection.
 	// Why?
 	// - Each pointer (`this` and `other`) stays associated with the same window after the swap.
 	// - Were just exchanging internal data; the identity (address) of the interface tied to the window doesnt change.
@@ -63,24 +64,35 @@ BasicInterface& BasicInterface::operator=(BasicInterface&& other) noexcept
 
 	// Swap the internal state between *this and other.
 	// This includes all relevant members to fully transfer ownership.
+	// The arenas follow their elements: the allocators of the containers are swapped as well.
 	std::swap(this->m_window, other.m_window);
+	std::swap(this->m_ownedArena, other.m_ownedArena);
 	std::swap(this->m_texts, other.m_texts);
 	std::swap(this->m_sprites, other.m_sprites);
+	std::swap(this->m_hiddenTexts, other.m_hiddenTexts);
+	std::swap(this->m_hiddenSprites, other.m_hiddenSprites);
 	std::swap(this->m_relativeScalingDefinition, other.m_relativeScalingDefinition);
-	other.m_window = nullptr;
-	// Both lock states are false;
+	std::swap(this->m_pendingPositionFactor, other.m_pendingPositionFactor);
+	std::swap(this->m_pendingScaleFactor, other.m_pendingScaleFactor);
+	std::swap(this->m_isResizePending, other.m_isResizePending);
+	std::swap(this->m_positionFactor, other.m_positionFactor);
+	std::swap(this->m_context, other.m_context);
+	// Both lock states are false; `other` is still registered, with the former state of this interface.
 
 	return *this;
 }
 
 BasicInterface::~BasicInterface() noexcept
 {
-	auto interfacesThis{ s_allInterfaces.find(this->m_window) };
+	if (m_window == nullptr)
+		return; // Default constructed or moved-from: not in the collection, and nothing allocated.
+
+	auto interfacesThis{ m_context->m_interfaces.find(this->m_window) };
 	auto itThis = std::find_if(interfacesThis->second.begin(), interfacesThis->second.end(), [this](BasicInterface* x) { return x == this; });
 	interfacesThis->second.erase(itThis); // Erasing this interface from the collection.
 
 	if (interfacesThis->second.empty()) // if there are no interfaces for that window, we can erase it. 
-		s_allInterfaces.erase(interfacesThis);
+		m_context->m_interfaces.erase(interfacesThis);
 
 	m_window = nullptr;
 	m_sprites.clear();
@@ -91,13 +103,9 @@ void BasicInterface::addSprite(std::string_view textureName, sf::Vector2f pos, s
 {
 	ENSURE_SFML_WINDOW_VALIDITY(m_window, "The window is invalid when the function addSprite of BasicInterface was called");
 	assert((!m_lockState) && "Precondition violated; the interface is locked when the function addSprite of BasicInterface was called");
+	applyPendingResize(); // The new sprite is scaled with the current window size, unlike the others.
 
-	float relativeScalingValue{ 1.f };
-	if (m_relativeScalingDefinition != 0)
-		relativeScalingValue *= static_cast<float>(std::min(m_window->getSize().x, m_window->getSize().y)) / static_cast<float>(m_relativeScalingDefinition);
-
-	SpriteWrapper newSprite{ textureName, pos, scale * relativeScalingValue, rect, rot, alignment, color };
-	m_sprites.push_back(std::move(newSprite));
+	m_sprites.emplace_back(textureName, pos, scale * computeRelativeScaling(), rect, rot, alignment, color);
 }
 
 void BasicInterface::addSprite(sf::Texture texture, sf::Vector2f pos, sf::Vector2f scale, sf::IntRect rect, sf::Angle rot, Alignment alignment, sf::Color color) noexcept
@@ -120,25 +128,128 @@ void BasicInterface::addSprite(sf::Texture texture, sf::Vector2f pos, sf::Vector
 void BasicInterface::draw() const noexcept
 {
 	ENSURE_SFML_WINDOW_VALIDITY(m_window, "The window is invalid when the function draw of BasicInterface was called");
+	draw(*m_window);
+}
+
+void BasicInterface::draw(sf::RenderTarget& target) const noexcept
+{
+	PROFILE_SCOPE(drawTime);
+
+	applyPendingResize();
+
+	if (m_staticLayer.isEnabled() && m_staticLayer.draw(target, m_sprites, m_texts, m_hiddenSprites, m_hiddenTexts)) [[likely]]
+		return; // Falls back to the usual drawing if the texture could not be created.
+
+	if (m_batchedDrawing)
+	{
+		m_renderBatch.draw(target, m_sprites, m_texts, m_context->m_frame);
+		return;
+	}
+
+	if (m_lockState) [[likely]]
+	{	// Hidden elements are skipped without being touched.
+		for (size_t i{ 0 }; i < m_sprites.size(); ++i)
+		{
+			if (m_hiddenSprites[i]) [[unlikely]]
+			{
+				PROFILE_COUNT(hiddenElementsSkipped, 1);
+				continue;
+			}
+
+			target.draw(m_sprites[i].getSprite());
+			PROFILE_COUNT(drawCalls, 1);
+			PROFILE_COUNT(drawnElements, 1);
+		}
+
+		for (size_t i{ 0 }; i < m_texts.size(); ++i)
+		{
+			if (m_hiddenTexts[i]) [[unlikely]]
+			{
+				PROFILE_COUNT(hiddenElementsSkipped, 1);
+				continue;
+			}
+
+			target.draw(m_texts[i].getText());
+			PROFILE_COUNT(drawCalls, 1);
+			PROFILE_COUNT(drawnElements, 1);
+		}
+
+		return;
+	}
 
 	for (const auto& sprite : m_sprites)
-		if (!sprite.hide)
-			m_window->draw(sprite.getSprite());
+	{
+		if (sprite.hide) [[unlikely]]
+		{
+			PROFILE_COUNT(hiddenElementsSkipped, 1);
+			continue;
+		}
+
+		target.draw(sprite.getSprite());
+		PROFILE_COUNT(drawCalls, 1);
+		PROFILE_COUNT(drawnElements, 1);
+	}
 
 	for (const auto& text : m_texts)
-		if (!text.hide)
-			m_window->draw(text.getText());
+	{
+		if (text.hide) [[unlikely]]
+		{
+			PROFILE_COUNT(hiddenElementsSkipped, 1);
+			continue;
+		}
+
+		target.draw(text.getText());
+		PROFILE_COUNT(drawCalls, 1);
+		PROFILE_COUNT(drawnElements, 1);
+	}
 }
 
-void BasicInterface::lockInterface(bool shrinkToFit) noexcept
+void BasicInterface::lockInterface(bool shrinkToFit, bool batchedDrawing) noexcept
 {
 	m_lockState = true;
+	m_batchedDrawing = batchedDrawing;
+	m_renderBatch.clear(); // Built during the first draw call.
+	m_staticLayer.clear();
 
 	if (shrinkToFit)
 	{
 		m_texts.shrink_to_fit();
 		m_sprites.shrink_to_fit();
 	}
+
+	// Elements won't move anymore, so their hide flags can be mirrored into contiguous arrays.
+	m_hiddenTexts.assign(m_texts.size(), 0);
+	m_hiddenSprites.assign(m_sprites.size(), 0);
+
+	for (size_t i{ 0 }; i < m_texts.size(); ++i)
+		m_texts[i].hide.setMirror(&m_hiddenTexts[i]);
+	for (size_t i{ 0 }; i < m_sprites.size(); ++i)
+		m_sprites[i].hide.setMirror(&m_hiddenSprites[i]);
+}
+
+void BasicInterface::setStaticLayerCaching(bool enable) noexcept
+{
+	assert(m_lockState && "Precondition violated; the interface is not locked when the function setStaticLayerCaching of BasicInterface was called");
+
+	if (!enable)
+	{
+		m_staticLayer.clear();
+		return;
+	}
+
+	std::vector<bool> dynamicSprites(m_sprites.size(), false);
+	std::vector<bool> dynamicTexts(m_texts.size(), false);
+	flagDynamicElements(dynamicSprites, dynamicTexts);
+
+	m_staticLayer.build(dynamicSprites, dynamicTexts);
+}
+
+void BasicInterface::reserve(size_t nbOfNewTexts, size_t nbOfNewSprites) noexcept
+{
+	assert(!m_lockState && "Precondition violated; the interface is locked when the function reserve of BasicInterface was called");
+
+	reserveRoomFor(m_texts, nbOfNewTexts);
+	reserveRoomFor(m_sprites, nbOfNewSprites);
 }
 
 void BasicInterface::proportionKeeper(sf::RenderWindow* resizedWindow, sf::Vector2f scaleFactor, float relativeMinAxisScale) noexcept
@@ -148,9 +259,12 @@ void BasicInterface::proportionKeeper(sf::RenderWindow* resizedWindow, sf::Vecto
 	ENSURE_NOT_ZERO(scaleFactor.x, "Precondition violated; scale factor is equal to 0 when the function proportionKeeper of BasicInterface was called");
 	ENSURE_NOT_ZERO(scaleFactor.y, "Precondition violated; scale factor is equal to 0 when the function proportionKeeper of BasicInterface was called");
 
-	const sf::Vector2f minScaling2f{ relativeMinAxisScale, relativeMinAxisScale };
+	std::unordered_map<sf::RenderWindow*, std::vector<BasicInterface*>>& allInterfaces{ ResourceContext::current().m_interfaces };
+	const auto interfacesIterator{ allInterfaces.find(resizedWindow) };
+	if (interfacesIterator == allInterfaces.end()) [[unlikely]]
+		return; // The window has no interface within this context.
 
-	auto& interfaces{ s_allInterfaces.find(resizedWindow)->second }; // All interfaces associated with the resized window.
+	auto& interfaces{ interfacesIterator->second }; // All interfaces associated with the resized window.
 	for (auto it{ interfaces.begin() }; it != interfaces.end(); ++it)
 	{
 		auto* curInterface{ *it };
@@ -158,24 +272,54 @@ void BasicInterface::proportionKeeper(sf::RenderWindow* resizedWindow, sf::Vecto
 		if (curInterface->m_relativeScalingDefinition == 0)
 			continue; // No scaling definition, so no need to scale.
 
-		// Updating texts.
-		sf::Vector2f pos{};
-		for (auto& text : curInterface->m_texts)
-		{
-			text.scale(minScaling2f);
+		// Consecutive resizes are combined: positions and scales are only multiplied.
+		curInterface->m_pendingPositionFactor.x *= scaleFactor.x;
+		curInterface->m_pendingPositionFactor.y *= scaleFactor.y;
+		curInterface->m_pendingScaleFactor *= relativeMinAxisScale;
+		curInterface->m_isResizePending = true;
+		curInterface->m_positionFactor.x *= scaleFactor.x;
+		curInterface->m_positionFactor.y *= scaleFactor.y;
+	}
+}
 
-			pos = text.getText().getPosition();
-			text.setPosition(sf::Vector2f{ pos.x * scaleFactor.x, pos.y * scaleFactor.y }); // Update position to match the new scale.
-		}
+void BasicInterface::prepareFrame() noexcept
+{
+	applyPendingResize();
 
-		// Updating sprites.
-		for (auto& sprite : curInterface->m_sprites)
-		{
-			sprite.scale(minScaling2f);
+	if (m_batchedDrawing && !m_staticLayer.isEnabled()) // The static layer is rendered, hence on the render thread.
+		m_renderBatch.prepare(m_sprites, m_texts, m_context->m_frame);
+}
 
-			pos = sprite.getSprite().getPosition();
-			sprite.setPosition(sf::Vector2f{ pos.x * scaleFactor.x, pos.y * scaleFactor.y }); // Update position to match the new scale.
-		}
+void BasicInterface::resizeElements() const noexcept
+{
+	PROFILE_SCOPE(resizeTime);
+	PROFILE_COUNT(resizes, 1);
+
+	const sf::Vector2f minScaling2f{ m_pendingScaleFactor, m_pendingScaleFactor };
+	const sf::Vector2f scaleFactor{ m_pendingPositionFactor };
+
+	m_pendingPositionFactor = sf::Vector2f{ 1.f, 1.f };
+	m_pendingScaleFactor = 1.f;
+	m_isResizePending = false;
+	m_staticLayer.invalidate(); // The static elements are modified below.
+
+	// Updating texts.
+	sf::Vector2f pos{};
+	for (auto& text : m_texts)
+	{
+		text.scale(minScaling2f);
+
+		pos = text.getText().getPosition();
+		text.setPosition(sf::Vector2f{ pos.x * scaleFactor.x, pos.y * scaleFactor.y }); // Update position to match the new scale.
+	}
+
+	// Updating sprites.
+	for (auto& sprite : m_sprites)
+	{
+		sprite.scale(minScaling2f);
+
+		pos = sprite.getSprite().getPosition();
+		sprite.setPosition(sf::Vector2f{ pos.x * scaleFactor.x, pos.y * scaleFactor.y }); // Update position to match the new scale.
 	}
 }
 
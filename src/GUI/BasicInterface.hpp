@@ -13,12 +13,20 @@
 #define BASICINTERFACE_HPP
 
 #include "GraphicalResources.hpp"
+#include "ResourceContext.hpp"
+#include "RenderBatch.hpp"
+#include "StaticLayer.hpp"
+#include "ArenaAllocator.hpp"
 #include <SFML/Graphics.hpp>
 #include <string>
 #include <string_view>
 #include <vector>
+#include <memory>
+#include <memory_resource>
 #include <unordered_map>
 #include <algorithm>
+#include <tuple>
+#include <cstdint>
 
 #ifndef NDEBUG 
 #include <cassert>
@@ -45,10 +53,19 @@ namespace gui
  * 
  * Move functions are disabled if the interface is locked.
  *
+ * An interface belongs to the `ResourceContext` that is current when it is constructed, and its
+ * elements use the textures and fonts of that context: it should only be used on threads where the
+ * context is current.
+ *
+ * The containers of an interface, and the identifiers of derived interfaces, are allocated from an
+ * arena: the memory of removed elements is reused by the next ones, and destroying the interface
+ * frees it all at once instead of element by element. This avoids fragmenting the heap when screens
+ * are created and destroyed for a long time.
+ *
  * \note This class stores UI components ; it will use a considerable amount of memory.
  * \warning Avoid deleting the `sf::RenderWindow` passed as an argument while this class is using it.
  *
- * \see `sf::RenderWindow`, `TextWrapper`, `SpriteWrapper`.
+ * \see `sf::RenderWindow`, `TextWrapper`, `SpriteWrapper`, `ResourceContext`.
  *
  * \code
  * sf::RenderWindow window{ sf::VideoMode{ { 1000, 1000 } }, "Template sfml 3" };
@@ -103,16 +120,20 @@ public:
 	 *			  - A window of size 7680x2160 (32/9) → factor = 1080/2160 = 2.0
 	 *
 	 *			  If set to 0, no scaling is applied regardless of the window size.
+	 * \param[in] resource Where the elements are allocated from. If nullptr, the interface owns a pool
+	 *			  (`std::pmr::unsynchronized_pool_resource`). A `std::pmr::monotonic_buffer_resource` suits
+	 *			  interfaces whose elements are never removed. It must outlive the interface, and only be
+	 *			  used by one thread at a time.
 	 *
 	 * \pre `window` must be a valid.
 	 * \post An interface is constructed.
 	 * \warning The program will assert otherwise.
 	 */
-	explicit BasicInterface(sf::RenderWindow* window, unsigned int relativeScalingDefinition = 1080) noexcept;
+	explicit BasicInterface(sf::RenderWindow* window, unsigned int relativeScalingDefinition = 1080, std::pmr::memory_resource* resource = nullptr) noexcept;
 
-	constexpr inline BasicInterface() noexcept : m_window{ nullptr }, m_texts{}, m_sprites{}, m_relativeScalingDefinition{ 1080 }, m_lockState{ false } {}
+	constexpr inline BasicInterface() noexcept : m_window{ nullptr }, m_ownedArena{}, m_texts{}, m_sprites{}, m_hiddenTexts{}, m_hiddenSprites{}, m_relativeScalingDefinition{ 1080 }, m_lockState{ false }, m_batchedDrawing{ false }, m_renderBatch{}, m_staticLayer{}, m_pendingPositionFactor{ 1.f, 1.f }, m_pendingScaleFactor{ 1.f }, m_isResizePending{ false }, m_positionFactor{ 1.f, 1.f }, m_context{ nullptr } {}
 	BasicInterface(const BasicInterface&) noexcept = delete;
-	BasicInterface(BasicInterface&& other) noexcept; // Asserts if the other interface is locked
+	BasicInterface(BasicInterface&& other) noexcept; // Asserts if the other interface is locked. The moved-from interface can only be destroyed or assigned.
 	BasicInterface& operator=(const BasicInterface&) noexcept = delete;
 	BasicInterface& operator=(BasicInterface&& other) noexcept; // Asserts if any interface is locked
 	virtual ~BasicInterface() noexcept; /// \complexity O(N + M) where N is the number of reserved textures of all sprites and M is number of interfaces with the same window
@@ -156,18 +177,10 @@ public:
 	{
 		ENSURE_SFML_WINDOW_VALIDITY(m_window, "The window is invalid in the function addText of BasicInterface");
 		assert((!m_lockState) && "Precondition violated; the interface is locked in the function addText of BasicInterface");
+		applyPendingResize(); // The new text is scaled with the current window size, unlike the others.
+		loadDefaultFont();
 
-		// Loads the default font.
-		static constexpr std::string_view defaultFontPath{ "defaultFont.ttf" };
-		if (TextWrapper::getFont(s_defaultFontName) == nullptr) [[unlikely]] // Does not exist yet.
-			TextWrapper::createFont(std::string{ s_defaultFontName }, defaultFontPath); // Throws an exception if loading fails.
-
-		float relativeScalingValue{ 1.f };
-		if (m_relativeScalingDefinition != 0) [[likely]]
-			relativeScalingValue *= std::min(m_window->getSize().x, m_window->getSize().y) / static_cast<float>(m_relativeScalingDefinition);
-
-		TextWrapper newText{ content, fontName, characterSize, pos, scale * relativeScalingValue, color, alignment, style, rot };
-		m_texts.push_back(std::move(newText));
+		m_texts.emplace_back(content, fontName, characterSize, pos, scale * computeRelativeScaling(), color, alignment, style, rot);
 	}
 
 	/**
@@ -198,6 +211,8 @@ public:
 	/**
 	 * \see Similar to `addSprite`, but adds a reserved texture as well, which allows the function to
 	 *		be noexcept.
+	 * \note The texture is never shared with other sprites. To reuse textures built from identical
+	 *		 drawables, see `createSharedTextureFromDrawables`.
 	 */
 	void addSprite(sf::Texture texture, sf::Vector2f pos, sf::Vector2f scale = sf::Vector2f{ 1.f, 1.f }, sf::IntRect rect = sf::IntRect{}, sf::Angle rot = sf::degrees(0), Alignment alignment = Alignment::Center, sf::Color color = sf::Color::White) noexcept;
 
@@ -207,32 +222,125 @@ public:
 	 * 
 	 * This function is cache-friendly.
 	 * 
-	 * \see `sf::Drawable::draw()`.
+	 * If batched drawing was enabled when locking the interface, elements that share a texture are
+	 * drawn together: the number of draw calls no longer depends on the number of elements.
+	 * 
+	 * If the window was resized since the last call, the elements are rescaled first (see `windowResized`).
+	 * The elements and the pending resize are `mutable` for this reason: drawing completes the
+	 * modification deferred by the resize.
+	 * 
+	 * If the static layer is cached, it is drawn as a single quad, then the dynamic elements are
+	 * drawn on top of it. It takes precedence over batched drawing.
+	 * 
+	 * \see `sf::Drawable::draw()`, `lockInterface`, `RenderBatch`, `setStaticLayerCaching`.
 	 */
 	void draw() const noexcept;
 
+	/**
+	 * \see Similar to `draw`, but renders the interface into any target, such as a `sf::RenderTexture`.
+	 *		 The interface is still scaled according to its window.
+	 */
+	void draw(sf::RenderTarget& target) const noexcept;
+
 	/**
 	 * \brief Prevents any addition of new elements to the interface.
-	 * \complexity O(1) if shrinkToFit is false
-	 * \complexity O(N + M) otherwise. N is the number of texts and M the number of sprites.
+	 * \complexity O(N + M), where N is the number of texts and M the number of sprites.
 	 * 
 	 * Once you have added all your elements, you can lock the interface to avoid futur modifications.
 	 * Locking the interface can reduce memory usage a little bit if `shrinkToFit` is true. But be aware
 	 * that it can be time consuming if you have a lot of elements. In debug mode, a crash will be triggered
 	 * if a modification is attempted after locking.
 	 * 
+	 * Since elements won't move anymore, their hide flags are mirrored into contiguous arrays (see
+	 * `MirroredFlag`): drawing skips hidden elements without touching them.
+	 * 
 	 * \param[in] shrinkToFit If true, the function will call `shrink_to_fit` on both the texts and
 	 *						  sprites.
+	 * \param[in] batchedDrawing If true, `draw` groups the elements sharing a texture (or a font) into
+	 *							 cached vertex arrays, which are only rebuilt when an element changes.
+	 *							 Recommended for interfaces with many elements.
 	 * 
 	 * \note Is not constexpr because MutableInterface overrides it with a none constexpr member.
+	 * 
+	 * \see `RenderBatch`.
+	 */
+	virtual void lockInterface(bool shrinkToFit = true, bool batchedDrawing = false) noexcept;
+
+	/**
+	 * \brief Renders the static elements once into a texture, which is then drawn instead of them.
+	 * \complexity O(N), where N is the number of graphical elements.
+	 *
+	 * Static elements (added with `addText` and `addSprite`) can't change once the interface is locked,
+	 * yet they are drawn every frame. When enabled, they are rendered into a texture of the size of the
+	 * window, and the whole static layer costs one textured quad per frame. Dynamic elements are
+	 * still drawn, on top of it.
+	 *
+	 * The texture is only rendered again after a resize of the window, or when the view changes.
+	 * Recommended for screens full of static labels and decorations.
+	 *
+	 * \param[in] enable If true, the static layer is cached. Otherwise the texture is released.
+	 *
+	 * \note Dynamic elements are always drawn above static ones, even a dynamic sprite that would be
+	 *		 drawn below a static text otherwise.
+	 * \note The texture uses as much memory as the window framebuffer.
+	 *
+	 * \pre The interface must be locked.
+	 * \warning The program will assert otherwise.
+	 *
+	 * \see `StaticLayer`, `draw`.
+	 */
+	void setStaticLayerCaching(bool enable) noexcept;
+
+	/**
+	 * \brief Reserves memory for elements that will be added, to avoid reallocations while populating.
+	 * \complexity O(N + M), where N is the number of texts and M the number of sprites, if memory
+	 *					   must be reallocated.
+	 *
+	 * Recommended before adding thousands of elements. Calling it several times does not break the
+	 * amortized O(1) complexity of additions: capacities still grow geometrically.
+	 *
+	 * \param[in] nbOfNewTexts The number of texts that will be added.
+	 * \param[in] nbOfNewSprites The number of sprites that will be added.
+	 *
+	 * \note May invalidate any pointers of any TransformableWrapper in this gui.
+	 *
+	 * \pre The interface must not be locked.
+	 * \warning The program will assert otherwise.
+	 *
+	 * \see `MutableInterface::addDynamicTexts`, `MutableInterface::addDynamicSprites`.
 	 */
-	virtual void lockInterface(bool shrinkToFit = true) noexcept;
+	virtual void reserve(size_t nbOfNewTexts, size_t nbOfNewSprites) noexcept;
+
+	/**
+	 * \brief Returns the memory resource the elements are allocated from.
+	 * \complexity O(1).
+	 *
+	 * \return The resource given to the constructor, or the pool owned by the interface.
+	 */
+	[[nodiscard]] inline std::pmr::memory_resource* getMemoryResource() const noexcept
+	{
+		return m_texts.get_allocator().getResource();
+	}
+
+	/**
+	 * \brief Returns the factor by which all resizes of the window multiplied the positions of the
+	 *		  elements since the interface was constructed, pending ones included.
+	 * \complexity O(1).
+	 *
+	 * Positions given before a resize are converted to the current coordinates by multiplying their
+	 * components by the ratio between the current factor and the factor at that time.
+	 *
+	 * \see `windowResized`.
+	 */
+	[[nodiscard]] inline sf::Vector2f getPositionFactor() const noexcept
+	{
+		return m_positionFactor;
+	}
 
 
 	/**
 	 * \brief Handles window rescaling and updates views/interfaces' drawables accordingly.
-	 * \complexity O(N + M), where N is the number of graphical elements in all interfaces associated
-	 *						 with the resized window (if their 'relativeScalingDefinition's were not set to 0). And M
+	 * \complexity O(N + M), where N is the number of interfaces associated with the resized window. And M
 	 *						 is the number of views passed as arguments.
 	 *
 	 * This function should be called after a window has been resized (or recreated). It updates all of
@@ -240,9 +348,13 @@ public:
 	 * If an interface has a scaling definition of `0`, it will not be modifies.
 	 * 
 	 * The scales and positions/centers are modified for both transformables and views, but without distortion.
+	 * Transformables are only modified when their interface is next drawn or hovered, or when one
+	 * of its elements is added or accessed: consecutive resizes are combined into a single update, and
+	 * interfaces that are not displayed do nothing until they are.
 	 * The resized window is always constrained to the screen resolution, and larger than 480 px on each axis.
 	 * 
 	 * Call this function after recreation of the window if the size changed, since recreation (create()) does not.
+	 * Only the interfaces of the `ResourceContext` of the calling thread are rescaled.
 	 *
 	 * \param[in,out] resizedWindow A valid pointer to the window that was resized.
 	 * \param[in,out] previousView: The previous view of the window before the resize. Updated after call.
@@ -297,10 +409,17 @@ protected:
 
 	/// Pointer to the window.
 	mutable sf::RenderWindow* m_window;
-	/// Collection of texts in the interface.
-	std::vector<TextWrapper> m_texts;
-	/// Collection of sprites in the interface.
-	std::vector<SpriteWrapper> m_sprites;
+	/// The pool the elements are allocated from, unless a resource was given. Destroyed after them.
+	std::unique_ptr<std::pmr::memory_resource> m_ownedArena;
+	/// Collection of texts in the interface. Mutable, so that `draw` can apply the pending resize.
+	mutable ArenaVector<TextWrapper> m_texts;
+	/// Collection of sprites in the interface. Mutable, so that `draw` can apply the pending resize.
+	mutable ArenaVector<SpriteWrapper> m_sprites;
+
+	/// The hide flag of each text, mirrored once locked. Loops read it rather than the heavy wrappers.
+	ArenaVector<std::uint8_t> m_hiddenTexts;
+	/// The hide flag of each sprite, mirrored once locked. Loops read it rather than the heavy wrappers.
+	ArenaVector<std::uint8_t> m_hiddenSprites;
 
 	/// All scales are multiplied by a factor one if the min axis (between x and y) is the same as this
 	/// value. Otherwise the factor is adjusted to ensure same visual proportions across different window sizes. 
@@ -308,19 +427,129 @@ protected:
 
 	/// If true, no more elements can be added to the interface.
 	bool m_lockState;
+	/// If true, the elements are drawn using the render batch. Only possible when locked.
+	bool m_batchedDrawing;
+
+	/// Caches the vertices of all elements when batched drawing is enabled.
+	mutable RenderBatch m_renderBatch;
+	/// Caches the static elements into a texture, when enabled.
+	mutable StaticLayer m_staticLayer;
 
 	/// The name of the default font.
 	inline static constexpr std::string_view s_defaultFontName{ "__default" };
 
+
+	/**
+	 * \brief Rescales and repositions the elements if the window was resized since the last call.
+	 * \complexity O(1), if no resize is pending.
+	 * \complexity O(N), where N is the number of graphical elements, otherwise.
+	 *
+	 * Must be called before the elements are read or modified, so that they reflect the current size
+	 * of the window.
+	 *
+	 * \see `windowResized`.
+	 */
+	inline void applyPendingResize() const noexcept
+	{
+		if (m_isResizePending) [[unlikely]]
+			resizeElements();
+	}
+
+	/**
+	 * \brief Computes the factor by which the scale of new elements is multiplied.
+	 * \complexity O(1).
+	 *
+	 * \see `m_relativeScalingDefinition`.
+	 */
+	[[nodiscard]] inline float computeRelativeScaling() const noexcept
+	{
+		if (m_relativeScalingDefinition == 0) [[unlikely]]
+			return 1.f;
+
+		return static_cast<float>(std::min(m_window->getSize().x, m_window->getSize().y)) / static_cast<float>(m_relativeScalingDefinition);
+	}
+
+	/**
+	 * \brief Loads the default font under the name `__default` from `../assets/defaultFont.ttf`, if
+	 *		  it does not exist yet.
+	 * \complexity O(1), if the font already exists.
+	 *
+	 * \throw LoadingGraphicalRessourceFailure Strong exception guarantee: nothing happens.
+	 */
+	inline static void loadDefaultFont()
+	{
+		static constexpr std::string_view defaultFontPath{ "defaultFont.ttf" };
+		if (TextWrapper::getFont(s_defaultFontName) == nullptr) [[unlikely]] // Does not exist yet.
+			TextWrapper::createFont(std::string{ s_defaultFontName }, defaultFontPath); // Throws an exception if loading fails.
+	}
+
+	/**
+	 * \brief Reserves room for new elements in a vector or a hash map, growing it geometrically.
+	 * \complexity O(N), where N is the number of elements, if memory must be reallocated.
+	 *
+	 * Reserving exactly the required size would reallocate during each call, which makes repeated
+	 * calls quadratic.
+	 *
+	 * \param[in,out] container The container to grow.
+	 * \param[in] nbOfNewElements The number of elements that will be added.
+	 */
+	template<typename Container>
+	inline static void reserveRoomFor(Container& container, size_t nbOfNewElements) noexcept
+	{
+		const size_t required{ container.size() + nbOfNewElements };
+
+		size_t capacity{};
+		if constexpr (requires { container.capacity(); })
+			capacity = container.capacity();
+		else
+			capacity = static_cast<size_t>(static_cast<float>(container.bucket_count()) * container.max_load_factor());
+
+		if (required > capacity)
+			container.reserve(std::max(required, container.size() * 2));
+	}
+
+	/**
+	 * \brief Flags the elements that can be modified once the interface is locked.
+	 * \complexity O(D), where D is the number of dynamic elements.
+	 *
+	 * Only the other elements are cached by the static layer. A basic interface has no dynamic element.
+	 *
+	 * \param[out] dynamicSprites For each sprite, set to true if it is dynamic.
+	 * \param[out] dynamicTexts For each text, set to true if it is dynamic.
+	 *
+	 * \see `setStaticLayerCaching`.
+	 */
+	inline virtual void flagDynamicElements([[maybe_unused]] std::vector<bool>& dynamicSprites, [[maybe_unused]] std::vector<bool>& dynamicTexts) const noexcept
+	{}
+
 private:
 
+	friend class FramePreparer;
+
+
+	/**
+	 * \brief Applies the pending resize to all elements.
+	 * \complexity O(N), where N is the number of graphical elements.
+	 *
+	 * \note Elements with scales 0 are not modified.
+	 */
+	void resizeElements() const noexcept;
+
+	/**
+	 * \brief Does the work of the next `draw` that does not need the render thread: applies the pending
+	 *		  resize, and builds the vertices of batched drawing.
+	 * \complexity O(N), where N is the number of graphical elements; O(1) if nothing needs to be done.
+	 *
+	 * \see `FramePreparer`, `RenderBatch::prepare`.
+	 */
+	void prepareFrame() noexcept;
+
 	/**
-	 * \brief Modifies the window' interfaces drawables after the resize.
-	 * \complexity O(N), where N is the number of graphical elements in all interfaces associated with
-	 *					 the resized window (if their 'relativeScalingDefinition's were not set to 0).
+	 * \brief Schedules the modification of the window' interfaces drawables after the resize.
+	 * \complexity O(N), where N is the number of interfaces associated with the resized window.
 	 * 
-	 * Rescales and repositions all interface elements associated with the resized window, if their 
-	 * relativeScalingDefinition isn't 0.
+	 * Combines the resize with the pending one of all interfaces associated with the resized window,
+	 * if their relativeScalingDefinition isn't 0. Their elements are modified later, by `applyPendingResize`.
 	 * 
 	 * \param[in] window: The window which was resized, and for which the interfaces will be resized.
 	 * \param[in] scaleFactor The factor by which the window was resized, in both x and y axes.
@@ -329,8 +558,6 @@ private:
 	 *            the scale factor is (0.75, 2), and the smallest axis ratio is 750 / 500 = 1.5.
 	 *            This helps to scale elements uniformly based on the smaller dimension.
 	 * 
-	 * \note Elements with scales 0 are not modified.
-	 *
 	 * \pre `resizedWindow` must be a valid window.
 	 * \pre `relativeMinAxisScale` must represent a valid proportion (not 0).
 	 * \pre `scaleFactor` must not be equal to 0.
@@ -340,8 +567,17 @@ private:
 	static void proportionKeeper(sf::RenderWindow* resizedWindow, sf::Vector2f scaleFactor, float relativeMinAxisScale) noexcept;
 
 
-	/// Collection of all interfaces to perform resizing. Stored by window.
-	inline static std::unordered_map<sf::RenderWindow*, std::vector<BasicInterface*>> s_allInterfaces{};
+	/// The factor by which positions must be multiplied, for all resizes not applied yet. Mutable, like the elements.
+	mutable sf::Vector2f m_pendingPositionFactor;
+	/// The factor by which scales must be multiplied, for all resizes not applied yet.
+	mutable float m_pendingScaleFactor;
+	/// If true, the elements were not updated since the last resize of the window.
+	mutable bool m_isResizePending;
+	/// The factor by which all resizes multiplied positions, pending ones included.
+	sf::Vector2f m_positionFactor;
+
+	/// The context the interface was constructed within, which keeps it for resizing.
+	ResourceContext* m_context;
 };
 
 
@@ -352,30 +588,29 @@ template<typename T>
 concept Drawable = std::derived_from<std::remove_cvref_t<T>, sf::Drawable>
 && std::derived_from<std::remove_cvref_t<T>, sf::Transformable>;
 
+/**
+ * \brief Must be a drawable whose appearance can be described by its parameters: a shape, a
+ *		  sprite or a text.
+ */
+template<typename T>
+concept KeyableDrawable = Drawable<T>
+&& (std::derived_from<std::remove_cvref_t<T>, sf::Shape>
+ || std::derived_from<std::remove_cvref_t<T>, sf::Sprite>
+ || std::derived_from<std::remove_cvref_t<T>, sf::Text>);
+
 /**
  * \complexity O(N), where N is the number of drawables passed as arguments.
- *  
- * From the given drawables, the function creates a texture that visually represents what
- * they look like if drawn separately, in order. The texture size covers the distance between
- * the pixel at the leftmost/top edge of the leftmost/top drawable and the pixel at the
- * rightmost/bottom edge of the rightmost/bottom drawable, not beginning at (0;0). It accounts for
- * the drawables' transformables such as rotation, position...
- * 
- * \param[in] drawables: The drawables to create the texture from.
  *
- * \return Returns a texture created from the given drawables such as sprites, circleShape, convexShape...
+ * Draws the drawables onto a render texture that fits them exactly. See `createTextureFromDrawables`.
  *
- * \note The drawables' origins are moved to 0;0, and their positions are adjusted; therefore the
- *       drawables passed as arguments are very likely going to be modified.
- * \note If you create a texture from shapes, keep in mind that shapes are drawn differently than
- *		 sprites in SFML. Shapes use mathematical formulas to draw themselves, whereas sprites use arrays
- *		 of pixels (textures). While textures can be more detailed, they are also more pixelized. Be aware
- *		 that some sprites may have artefacts, which shapes usually don't have. For some reasons, this
- *	     seems to not be the case if the origins of such sprites are located at 0,0.
- * \note Consider generating a mipmap.
+ * \param[in] drawables: The drawables to draw.
+ *
+ * \return The render texture, on which `display` was already called.
+ *
+ * \note The drawables' origins are moved to 0;0, and their positions are adjusted.
  */
 template<Drawable... Ts>
-sf::Texture createTextureFromDrawables(Ts&&... drawables) noexcept
+sf::RenderTexture renderDrawables(Ts&&... drawables) noexcept
 {
 	// First, we need to calculate how much space the drawables will occupy in the render texture.
 
@@ -411,11 +646,166 @@ sf::Texture createTextureFromDrawables(Ts&&... drawables) noexcept
 	(renderTexture.draw(std::forward<Ts>(drawables)), ...);
 	renderTexture.display();
 
+	return renderTexture;
+}
+
+/**
+ * \complexity O(N), where N is the number of drawables passed as arguments.
+ *  
+ * From the given drawables, the function creates a texture that visually represents what
+ * they look like if drawn separately, in order. The texture size covers the distance between
+ * the pixel at the leftmost/top edge of the leftmost/top drawable and the pixel at the
+ * rightmost/bottom edge of the rightmost/bottom drawable, not beginning at (0;0). It accounts for
+ * the drawables' transformables such as rotation, position...
+ * 
+ * \param[in] drawables: The drawables to create the texture from.
+ *
+ * \return Returns a texture created from the given drawables such as sprites, circleShape, convexShape...
+ *
+ * \note The drawables' origins are moved to 0;0, and their positions are adjusted; therefore the
+ *       drawables passed as arguments are very likely going to be modified.
+ * \note If you create a texture from shapes, keep in mind that shapes are drawn differently than
+ *		 sprites in SFML. Shapes use mathematical formulas to draw themselves, whereas sprites use arrays
+ *		 of pixels (textures). While textures can be more detailed, they are also more pixelized. Be aware
+ *		 that some sprites may have artefacts, which shapes usually don't have. For some reasons, this
+ *	     seems to not be the case if the origins of such sprites are located at 0,0.
+ * \note Consider generating a mipmap.
+ * \note Every call renders and copies a new texture. If the same texture is built several times,
+ *		 prefer `createSharedTextureFromDrawables`.
+ */
+template<Drawable... Ts>
+sf::Texture createTextureFromDrawables(Ts&&... drawables) noexcept
+{
+	const sf::RenderTexture renderTexture{ renderDrawables(std::forward<Ts>(drawables)...) };
+
 	sf::Texture texture{ renderTexture.getTexture() };
 	texture.setSmooth(true);
 	return texture;
 }
 
+/**
+ * \complexity O(P), where P is the number of parameters of the drawable (points of a shape, characters
+ *			   of a text); plus the complexity of `SpriteWrapper::findTexture` or `TextWrapper::findFont`.
+ *
+ * Appends to the key every parameter that changes how the drawable looks: its geometry, colors,
+ * texture or font, and transform. The translation is relative to `reference`, so that moving all
+ * drawables together does not change the key.
+ *
+ * \param[out] key The key to append to.
+ * \param[in] drawable The drawable to describe.
+ * \param[in] reference The translation of the first drawable of the texture.
+ *
+ * \note Registered textures and fonts are identified by their name and their generation, others by
+ *		 their address.
+ */
+template<KeyableDrawable T>
+void appendDrawableKey(std::string& key, const T& drawable, sf::Vector2f reference) noexcept
+{
+	const auto append{ [&key](const auto& value) { key.append(reinterpret_cast<const char*>(&value), sizeof(value)); } };
+	const auto appendResource{ [&key, &append](const void* address, const std::optional<std::pair<std::string_view, std::uint64_t>>& resource)
+	{
+		append(resource.has_value());
+		if (!resource.has_value()) [[unlikely]]
+		{
+			append(address); // Not registered, e.g. a texture owned by the user.
+			return;
+		}
+
+		append(resource->first.size());
+		key.append(resource->first);
+		append(resource->second);
+	} };
+
+	const float* matrix{ drawable.getTransform().getMatrix() };
+	append(matrix[0]); append(matrix[1]); append(matrix[4]); append(matrix[5]);
+	append(matrix[12] - reference.x); append(matrix[13] - reference.y);
+
+	using Type = std::remove_cvref_t<T>;
+	if constexpr (std::derived_from<Type, sf::Shape>)
+	{
+		append(drawable.getPointCount());
+		for (size_t i{ 0 }; i < drawable.getPointCount(); ++i)
+			append(drawable.getPoint(i));
+
+		append(drawable.getFillColor());
+		append(drawable.getOutlineColor());
+		append(drawable.getOutlineThickness());
+		append(drawable.getTexture() != nullptr);
+		if (drawable.getTexture() != nullptr)
+			appendResource(drawable.getTexture(), SpriteWrapper::findTexture(drawable.getTexture(), drawable.getTextureRect()));
+		append(drawable.getTextureRect());
+	}
+	else if constexpr (std::derived_from<Type, sf::Sprite>)
+	{
+		appendResource(&drawable.getTexture(), SpriteWrapper::findTexture(&drawable.getTexture(), drawable.getTextureRect()));
+		append(drawable.getTextureRect());
+		append(drawable.getColor());
+	}
+	else
+	{
+		const std::u32string content{ drawable.getString().toUtf32() };
+		append(content.size());
+		key.append(reinterpret_cast<const char*>(content.data()), content.size() * sizeof(char32_t));
+
+		appendResource(&drawable.getFont(), TextWrapper::findFont(&drawable.getFont()));
+		append(drawable.getCharacterSize());
+		append(drawable.getStyle());
+		append(drawable.getFillColor());
+		append(drawable.getOutlineColor());
+		append(drawable.getOutlineThickness());
+		append(drawable.getLetterSpacing());
+		append(drawable.getLineSpacing());
+	}
+}
+
+/**
+ * \complexity O(P), where P is the number of parameters of the drawables, if their textures and fonts
+ *			   were already found, see `appendDrawableKey`; plus O(N) if the texture does not exist yet,
+ *			   see `createTextureFromDrawables`.
+ *
+ * Creates a shared texture from the given drawables, like `createTextureFromDrawables`, unless an
+ * identical one was already created. The texture is registered under a name built from all the
+ * parameters of the drawables, hence two calls with identical drawables return the same name and
+ * only the first one renders. Moving all drawables together yields the same texture too.
+ *
+ * If the atlas is enabled, the drawables are rendered straight into a page (see `enableAtlas`).
+ *
+ * \param[in] drawables: The drawables to create the texture from.
+ *
+ * \return The name of the texture, to give to `addSprite`, `addDynamicSprite` or `addTexture`.
+ *
+ * \note The drawables are modified, like with `createTextureFromDrawables`, but only if the texture
+ *		 does not exist yet.
+ * \note Textures and fonts registered with `SpriteWrapper::createTexture` or `TextWrapper::createFont`
+ *		 are identified by their name and their generation: if one is removed and another is created
+ *		 under the same name or at the same address, the drawables are rendered again. Others are
+ *		 identified by their address: if one is destroyed and another is created at the same address,
+ *		 the former texture is returned.
+ * \note The texture can be removed with `SpriteWrapper::removeTexture` once no sprite uses it; the
+ *		 next call then renders it again.
+ *
+ * \code
+ * sf::RectangleShape rect{ sf::Vector2f{ 200, 200 } };
+ * const std::string name{ gui::createSharedTextureFromDrawables(rect) };
+ * myInterface.addSprite(name, {500, 500});
+ * myInterface.addSprite(gui::createSharedTextureFromDrawables(rect), {800, 500}); // Not rendered again.
+ * \endcode
+ */
+template<KeyableDrawable... Ts> requires (sizeof...(Ts) > 0)
+std::string createSharedTextureFromDrawables(Ts&&... drawables) noexcept
+{
+	const float* firstMatrix{ std::get<0>(std::tie(drawables...)).getTransform().getMatrix() };
+	const sf::Vector2f reference{ firstMatrix[12], firstMatrix[13] };
+
+	std::string name{ "_drawables_" }; // Starts with an underscore: it can't collide with the user's names.
+	(appendDrawableKey(name, drawables, reference), ...);
+
+	if (SpriteWrapper::getTexture(name) == nullptr)
+		SpriteWrapper::createTexture(name, renderDrawables(std::forward<Ts>(drawables)...), SpriteWrapper::Reserved::No);
+
+	return name;
+}
+
 } // gui namespace
 
 #endif // BASICINTERFACE_HPP
\ No newline at end of file
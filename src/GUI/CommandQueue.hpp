@@ -0,0 +1,159 @@
+/*******************************************************************
+ * \file   CommandQueue.hpp
+ * \brief  Declare a lock-free queue through which any thread can send commands to the render thread.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note This file only depends on the standard library.
+ *********************************************************************/
+
+#ifndef COMMANDQUEUE_HPP
+#define COMMANDQUEUE_HPP
+
+#include <atomic>
+#include <concepts>
+#include <utility>
+
+namespace gui
+{
+
+/**
+ * \brief A multiple producers, single consumer queue that never blocks its producers.
+ *
+ * Producers push commands onto a lock-free list. The consumer takes the whole list at once with a
+ * single atomic exchange, while producers keep pushing onto a new, empty one: the two play the role
+ * of a double buffer, without any lock. Commands are then executed in the order they were pushed.
+ *
+ * \note Consuming an empty queue costs a single atomic exchange.
+ * \warning Moving or destroying the queue is not thread-safe: no producer should push meanwhile.
+ *
+ * \see `MutableInterface::queueCommand`.
+ */
+template<typename T>
+class CommandQueue
+{
+public:
+
+	constexpr CommandQueue() noexcept = default;
+	CommandQueue(const CommandQueue&) noexcept = delete;
+	CommandQueue& operator=(const CommandQueue&) noexcept = delete;
+
+	inline CommandQueue(CommandQueue&& other) noexcept
+		: m_head{ other.m_head.exchange(nullptr, std::memory_order_acquire) }
+	{}
+
+	inline CommandQueue& operator=(CommandQueue&& other) noexcept
+	{
+		if (this != &other)
+			deleteNodes(m_head.exchange(other.m_head.exchange(nullptr, std::memory_order_acquire), std::memory_order_acq_rel));
+
+		return *this;
+	}
+
+	inline ~CommandQueue() noexcept /// \complexity O(N), where N is the number of commands not consumed.
+	{
+		deleteNodes(m_head.exchange(nullptr, std::memory_order_acquire));
+	}
+
+
+	/**
+	 * \brief Pushes a command, from any thread.
+	 * \complexity O(1), lock-free.
+	 *
+	 * \param[in] command The command to push.
+	 */
+	inline void push(T command) noexcept
+	{
+		Node* const node{ new Node{ std::move(command), m_head.load(std::memory_order_relaxed) } };
+
+		// On failure, `node->next` is updated with the current head.
+		while (!m_head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	/**
+	 * \brief Executes and removes all commands pushed so far, in the order they were pushed.
+	 * \complexity O(N), where N is the number of commands.
+	 *
+	 * Commands pushed while consuming are executed during the next call.
+	 *
+	 * \param[in] function Called with each command.
+	 *
+	 * \return The number of commands consumed.
+	 *
+	 * \pre Only one thread may consume at a time.
+	 */
+	template<typename F> requires std::invocable<F, T&>
+	inline size_t consume(F&& function) noexcept
+	{
+		Node* node{ m_head.exchange(nullptr, std::memory_order_acquire) };
+		if (node == nullptr) [[likely]]
+			return 0;
+
+		// The list is in the reverse order of pushing.
+		Node* ordered{ nullptr };
+		while (node != nullptr)
+		{
+			Node* const next{ node->next };
+			node->next = ordered;
+			ordered = node;
+			node = next;
+		}
+
+		size_t nbOfCommands{ 0 };
+		while (ordered != nullptr)
+		{
+			function(ordered->command);
+
+			Node* const next{ ordered->next };
+			delete ordered;
+			ordered = next;
+			++nbOfCommands;
+		}
+
+		return nbOfCommands;
+	}
+
+	/**
+	 * \brief Tells if no command is waiting. The result may be outdated if producers are pushing.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline bool empty() const noexcept
+	{
+		return m_head.load(std::memory_order_relaxed) == nullptr;
+	}
+
+private:
+
+	/**
+	 * \brief A command, and the one pushed before it.
+	 */
+	struct Node
+	{
+		T command;
+		Node* next;
+	};
+
+
+	/**
+	 * \brief Deletes a list of nodes without executing them.
+	 * \complexity O(N), where N is the number of nodes.
+	 */
+	inline static void deleteNodes(Node* node) noexcept
+	{
+		while (node != nullptr)
+		{
+			Node* const next{ node->next };
+			delete node;
+			node = next;
+		}
+	}
+
+
+	/// The last command pushed, or nullptr.
+	std::atomic<Node*> m_head{ nullptr };
+};
+
+} // gui namespace
+
+#endif // COMMANDQUEUE_HPP
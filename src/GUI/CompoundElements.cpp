@@ -1,7 +1,10 @@
 #include "CompoundElements.hpp"
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
 #include <numbers>
+#include <string_view>
 #ifndef NDEBUG
 #include <cassert>
 #endif //NDEBUG
@@ -13,6 +16,45 @@ inline const static std::string progressBarIdPrefix{ "_pb_" };
 inline const static std::string sliderIdPrefix{ "_sc_" };
 inline const static std::string mqbIdPrefix{ "_mqb_" };
 
+/**
+ * \brief The identifier of an element of a compound one: its prefix followed by the identifier of the
+ *		  compound element. Written on the stack, unless it is unusually long.
+ */
+class PrefixedIdentifier
+{
+public:
+
+	inline PrefixedIdentifier(std::string_view prefix, std::string_view identifier) noexcept
+		: m_buffer{}, m_fallback{}, m_view{}
+	{
+		if (prefix.size() + identifier.size() <= m_buffer.size()) [[likely]]
+		{
+			std::copy(identifier.begin(), identifier.end(), std::copy(prefix.begin(), prefix.end(), m_buffer.begin()));
+			m_view = std::string_view{ m_buffer.data(), prefix.size() + identifier.size() };
+		}
+		else
+		{
+			m_fallback.reserve(prefix.size() + identifier.size());
+			m_fallback.append(prefix).append(identifier);
+			m_view = m_fallback;
+		}
+	}
+
+	PrefixedIdentifier(const PrefixedIdentifier&) noexcept = delete;
+	PrefixedIdentifier& operator=(const PrefixedIdentifier&) noexcept = delete;
+
+	[[nodiscard]] inline operator std::string_view() const noexcept
+	{
+		return m_view;
+	}
+
+private:
+
+	std::array<char, 64> m_buffer;
+	std::string m_fallback;
+	std::string_view m_view;
+};
+
 /**
  * \brief Creates a texture from a solid rectangle shape.
  * \complexity O(1).
@@ -60,17 +102,17 @@ void addProgressBar(MutableInterface* gui, std::string identifier, sf::Vector2f
 	gui->addDynamicText(std::move(identifier), "0%", pos, size);
 }
 
-void moveProgressBar(MutableInterface* gui, const std::string& identifier, float progress)
+void moveProgressBar(MutableInterface* gui, std::string_view identifier, float progress)
 {
 	ENSURE_VALID_PTR(gui, "The gui was nullptr when the function updateProgressBar was called");
 	assert(((progress >= 0.f) && (progress <= 1.f)) && ("The progress value was not between 0 and 1 when the function updateProgressBar was called"));
 
-	auto* const backPtr{ gui->getDynamicSprite(progressBarIdPrefix + identifier) };
+	auto* const backPtr{ gui->getDynamicSprite(PrefixedIdentifier{ progressBarIdPrefix, identifier }) };
 	auto* const fillPtr{ gui->getDynamicSprite(identifier) };
 	auto* const textPtr{ gui->getDynamicText(identifier) };
 
 	if (backPtr == nullptr || fillPtr == nullptr || textPtr == nullptr) [[unlikely]]
-		throw std::invalid_argument{ "The progress bar with the identifier " + identifier + " does not exist." };
+		throw std::invalid_argument{ "The progress bar with the identifier " + std::string{ identifier } + " does not exist." };
 
 	progress = round(progress * 100) / 100; // Rounding to the nearest integer percentage.
 
@@ -83,7 +125,8 @@ void moveProgressBar(MutableInterface* gui, const std::string& identifier, float
 	// 4 * scale because the outline scales with the sprite.
 	const float outlineThickness{ 4 * backSprite.getScale().x };
 	// getGlobalBounds because we want the size after scaling (the visual size).
-	const float maxLength{ backSprite.getGlobalBounds().size.x - outlineThickness };
+	const sf::FloatRect& backBounds{ backPtr->getGlobalBounds() }; // Cached, the back sprite rarely changes.
+	const float maxLength{ backBounds.size.x - outlineThickness };
 	// getLocalBounds because we want the original size to get the scales.
 	const float curLength{ fillSprite.getLocalBounds().size.x }; 
 	const float newLength{ maxLength * progress / curLength }; 
@@ -92,34 +135,35 @@ void moveProgressBar(MutableInterface* gui, const std::string& identifier, float
 	fillPtr->setScale(sf::Vector2f{ newLength, fillSprite.getScale().y });
 	// outlineThickness / 2.f because we deal with one border, not two (in x).
 	// The outline is fixed since its scale is always 1 (in y).
-	fillPtr->setPosition(backSprite.getGlobalBounds().position + sf::Vector2f{ outlineThickness / 2.f, 2.f });
+	fillPtr->setPosition(backBounds.position + sf::Vector2f{ outlineThickness / 2.f, 2.f });
 
-	std::ostringstream content{};
-	content << progress * 100 << '%';
-	textPtr->setContent(content);
+	std::array<char, 16> content; // Same format as std::ostream, e.g. "42.5%".
+	char* const end{ std::to_chars(content.data(), content.data() + content.size() - 1, progress * 100, std::chars_format::general, 6).ptr };
+	*end = '%';
+	textPtr->setContent(std::string_view{ content.data(), static_cast<size_t>(end + 1 - content.data()) });
 }
 
-void hideProgressBar(MutableInterface* gui, const std::string& identifier, bool hide)
+void hideProgressBar(MutableInterface* gui, std::string_view identifier, bool hide)
 {
 	assert(gui != nullptr && "The gui was nullptr when the function hideProgressBar was called");
 
-	auto* const backPtr{ gui->getDynamicSprite(progressBarIdPrefix + identifier) };
+	auto* const backPtr{ gui->getDynamicSprite(PrefixedIdentifier{ progressBarIdPrefix, identifier }) };
 	auto* const fillPtr{ gui->getDynamicSprite(identifier) };
 	auto* const textPtr{ gui->getDynamicText(identifier) };
 
 	if (backPtr == nullptr || fillPtr == nullptr || textPtr == nullptr) [[unlikely]]
-		throw std::invalid_argument{ "The progress bar with the identifier " + identifier + " does not exist." };
+		throw std::invalid_argument{ "The progress bar with the identifier " + std::string{ identifier } + " does not exist." };
 
 	backPtr->hide = hide;
 	fillPtr->hide = hide;
 	textPtr->hide = hide;
 }
 
-void removeProgressBar(MutableInterface* gui, const std::string& identifier) noexcept
+void removeProgressBar(MutableInterface* gui, std::string_view identifier) noexcept
 {
 	assert(gui != nullptr && "The gui was nullptr when the function removeProgressBar was called");
 
-	gui->removeDynamicSprite(progressBarIdPrefix + identifier);
+	gui->removeDynamicSprite(PrefixedIdentifier{ progressBarIdPrefix, identifier });
 	gui->removeDynamicSprite(identifier);
 	gui->removeDynamicText(identifier);
 }
@@ -146,27 +190,28 @@ void addSlider(InteractiveInterface* gui, std::string identifier, sf::Vector2f p
 	gui->addDynamicSprite(sliderIdPrefix + identifier, sliderCursorTextureName, pos);
 	gui->addInteractive(identifier);
 
-	sf::Vector2f posText{ gui->getDynamicSprite(sliderIdPrefix + identifier)->getSprite().getGlobalBounds().position };
+	sf::Vector2f posText{ gui->getDynamicSprite(sliderIdPrefix + identifier)->getGlobalBounds().position };
 	posText.x -= outlineThickness;
 	gui->addDynamicText(std::move(identifier), "", posText, size, sf::Color::White, "__default", Alignment::Right);
 }
 
-double moveSlider(InteractiveInterface* gui, const std::string& identifier, double yPos, int intervals, const GrowthSliderFunction& growth, const UserFunction& user)
+double moveSlider(InteractiveInterface* gui, std::string_view identifier, double yPos, int intervals, const GrowthSliderFunction& growth, const UserFunction& user)
 {
 	ENSURE_VALID_PTR(gui, "The gui was nullptr when the function moveSlider was called");
 	assert(growth != nullptr && "The growth function was nullptr when the function moveSlider was called");
 
 	auto* const backgroundSlider{ gui->getDynamicSprite(identifier) };
-	auto* const cursorSlider{ gui->getDynamicSprite(sliderIdPrefix + identifier) };
+	auto* const cursorSlider{ gui->getDynamicSprite(PrefixedIdentifier{ sliderIdPrefix, identifier }) };
 	auto* const textSlider{ gui->getDynamicText(identifier) };
 
 	if (backgroundSlider == nullptr || cursorSlider == nullptr) [[unlikely]]
-		throw std::invalid_argument{ "The slider with the identifier " + identifier + " does not exist." };
+		throw std::invalid_argument{ "The slider with the identifier " + std::string{ identifier } + " does not exist." };
 
 	// Calculating the new position of the cursor.
 
-	const double bias{ backgroundSlider->getSprite().getGlobalBounds().position.y };
-	const double length{ backgroundSlider->getSprite().getGlobalBounds().size.y };
+	const sf::FloatRect& backgroundBounds{ backgroundSlider->getGlobalBounds() }; // Cached, the background rarely changes.
+	const double bias{ backgroundBounds.position.y };
+	const double length{ backgroundBounds.size.y };
 	yPos = std::clamp(yPos, bias, bias + length) - bias;
 
 	if (intervals >= 0)
@@ -188,28 +233,28 @@ double moveSlider(InteractiveInterface* gui, const std::string& identifier, doub
 	return value;
 }
 
-void hideSlider(InteractiveInterface* gui, const std::string& identifier, bool hide)
+void hideSlider(InteractiveInterface* gui, std::string_view identifier, bool hide)
 {
 	ENSURE_VALID_PTR(gui, "The gui was nullptr when the function hideSlider was called");
 
 	auto* const backPtr{ gui->getDynamicSprite(identifier) };
-	auto* const sliderPtr{ gui->getDynamicSprite(sliderIdPrefix + identifier) };
+	auto* const sliderPtr{ gui->getDynamicSprite(PrefixedIdentifier{ sliderIdPrefix, identifier }) };
 	auto* const textPtr{ gui->getDynamicText(identifier) };
 
 	if (backPtr == nullptr || sliderPtr == nullptr || textPtr == nullptr) [[unlikely]]
-		throw std::invalid_argument{ "The slider with the identifier " + identifier + " does not exist." };
+		throw std::invalid_argument{ "The slider with the identifier " + std::string{ identifier } + " does not exist." };
 
 	backPtr->hide = hide;
 	sliderPtr->hide = hide;
 	textPtr->hide = hide;
 }
 
-void removeSlider(InteractiveInterface* gui, const std::string& identifier) noexcept
+void removeSlider(InteractiveInterface* gui, std::string_view identifier) noexcept
 {
 	assert(gui != nullptr && "The gui was nullptr when the function removeSlider was called");
 	
 	gui->removeDynamicSprite(identifier);
-	gui->removeDynamicSprite(sliderIdPrefix + identifier);
+	gui->removeDynamicSprite(PrefixedIdentifier{ sliderIdPrefix, identifier });
 	gui->removeDynamicText(identifier);
 }
 
@@ -247,53 +292,67 @@ static sf::Texture loadCheckBoxTexture(sf::Vector2f scale, float outlineThicknes
 	return texture;
 }
 
+/**
+ * \brief Displays a box as checked or unchecked.
+ * \complexity O(1).
+ */
+static void showBoxStatus(InteractiveInterface* gui, MutableInterface::SpriteHandle box, bool checked) noexcept
+{
+	if (SpriteWrapper* const sprite{ gui->getDynamicSprite(box) }; sprite != nullptr) [[likely]]
+		sprite->switchToTexture(checked ? 1 : 0);
+}
+
 /**
  * \brief Checks a box
  * \complexity O(1).
  *
  * \param[in] gui The gui that contains the multiple question box.
- * \param[in] identifier The identifier under the form "_mqb_identifier_".
+ * \param[in] mqb The handle of the state of the mqb within the gui.
  * \param[in] check The 1-indexed box to check/uncheck.
- * \param[in] multipleChoices `true` if multiple boxes can be checked at once.
- * \param[in] atLeastOne `true` if at least one box must always be checked.
  * 
  * \pre The gui must be valid.
- * \pre The identifier must represent a mqb.
+ * \pre The handle must represent a mqb.
  * \post The box status will be updated.
  * \warning Asserts otherwise.
  */
-static void checkBox(InteractiveInterface* gui, const std::string& identifier, unsigned short check, bool multipleChoices, bool atLeastOne) noexcept
+static void checkBox(InteractiveInterface* gui, InteractiveInterface::MQBHandle mqb, unsigned short check) noexcept
 {
 	ENSURE_VALID_PTR(gui, "The gui was nullptr when the function checkBox was called");
 
-	SpriteWrapper* alreadyCheckedBox{ nullptr };
-	SpriteWrapper* curBoxToCheck{ gui->getDynamicSprite(identifier + std::to_string(check)) };
-	bool wasAlreadyChecked{ curBoxToCheck->getCurrentTextureIndex() == 1 };
+	InteractiveInterface::MQBState* const state{ gui->getMQBState(mqb) };
+	ENSURE_VALID_PTR(state, "The handle did not represent a mqb when the function checkBox was called");
 
-	unsigned short index{ 1 }; // 1-indexed
-	auto* box{ gui->getDynamicSprite(identifier + '1') }; 
-	ENSURE_VALID_PTR(box != nullptr, "The identifier did not represent a mqb when the function getMQBStatus was called");
-	do
+	const size_t index{ check - 1u }; // 1-indexed
+	const std::uint64_t bit{ std::uint64_t{ 1 } << (index % 64) };
+
+	if ((state->checkedBits[index / 64] & bit) != 0) // Unchecking the box.
 	{
-		if (index != check && box->getCurrentTextureIndex() == 1) // If the box is checked.
-		{
-			alreadyCheckedBox = box;
-			break;
-		}
+		if (state->atLeastOne && state->nbOfCheckedBoxes == 1)
+			return; // Only one box checked which happens to be the parameter + at least one box must be checked -> nothing happens
+
+		state->checkedBits[index / 64] &= ~bit;
+		--state->nbOfCheckedBoxes;
+		if (state->checkedBox == check)
+			state->checkedBox = 0;
 
-		box = gui->getDynamicSprite(identifier + std::to_string(++index)); // poor cache locality but not meant to be fast
-	} while (box != nullptr);
+		showBoxStatus(gui, state->boxes[index], false);
+		return;
+	}
 
-	if (atLeastOne && wasAlreadyChecked && alreadyCheckedBox == nullptr)
-		return; // Only one box checked which happens to be the parameter + at least one box must be checked -> nothing happens
+	if (!state->multipleChoices && state->checkedBox != 0) // Not a multiple choice mqb + checking a new box -> uncheck the currently checked box to switch to the new one
+	{
+		const size_t checkedIndex{ state->checkedBox - 1u };
+		state->checkedBits[checkedIndex / 64] &= ~(std::uint64_t{ 1 } << (checkedIndex % 64));
+		--state->nbOfCheckedBoxes;
 
-	if (!multipleChoices && !wasAlreadyChecked && alreadyCheckedBox != nullptr) // == 1 because there could be 0 box if atLeastOne == false
-		alreadyCheckedBox->switchToNextTexture(); // Not a multiple choice mqb + checking a new box -> uncheck the currently checked box to switch to the new one
+		showBoxStatus(gui, state->boxes[checkedIndex], false);
+	}
 
-	// Reverses the box status
-	curBoxToCheck->switchToNextTexture();
+	state->checkedBits[index / 64] |= bit;
+	++state->nbOfCheckedBoxes;
+	state->checkedBox = check;
 
-	return;
+	showBoxStatus(gui, state->boxes[index], true);
 }
 
 void addMQB(InteractiveInterface* gui, const std::string& identifier, sf::Vector2f initPos, sf::Vector2f deltaPos, unsigned short numberOfBoxes, bool multipleChoices, bool atLeastOne, unsigned short defaultCheckedBox) noexcept
@@ -304,6 +363,9 @@ void addMQB(InteractiveInterface* gui, const std::string& identifier, sf::Vector
 	assert((atLeastOne != true || defaultCheckedBox != 0) && "The mqb can't be completely unchecked and yet it has no default checked box in the function checkBox");
 	assert(numberOfBoxes != 1 || atLeastOne != true && "The mqb is useless as it has only one box which can't be unchecked due to the variable atLeastOne being true in the function checkBox");
 
+	if (gui->getMQBState(identifier) != nullptr)
+		return; // Already added.
+
 	static constexpr std::string_view uncheckedMqbTextureName{ "__ub" };
 	static constexpr std::string_view checkedMqbTextureName{ "__cb" };
 	static constexpr sf::Vector2f boxSize{ 20, 20 };
@@ -315,68 +377,117 @@ void addMQB(InteractiveInterface* gui, const std::string& identifier, sf::Vector
 		SpriteWrapper::createTexture(std::string{ checkedMqbTextureName },   loadCheckBoxTexture(boxSize, outlineThickness), SpriteWrapper::Reserved::No);
 	}
 
+	InteractiveInterface::MQBState state{ .boxes = {}, .checkedBits = std::vector<std::uint64_t>((numberOfBoxes + 63u) / 64u, 0), .nbOfCheckedBoxes = 0, .checkedBox = 0, .multipleChoices = multipleChoices, .atLeastOne = atLeastOne };
+	state.boxes.reserve(numberOfBoxes);
+
 	// Adding all boxes.
 	sf::Vector2f curPos{ initPos.x - (boxSize.x / 2.f), initPos.y - (boxSize.y / 2.f) }; // The "boxSize / 2" counteracts the origin not being at the center of the sprite.
 	const std::string identifierBox{ mqbIdPrefix + identifier + '_' };
+	std::string identifierBoxTemp{ identifierBox }; // Only the number at the end changes.
+	gui->reserve(0, numberOfBoxes);
+
 	for (unsigned short i{ 1 }; i <= numberOfBoxes; ++i) // 1-indexed
 	{
-		const std::string identifierBoxTemp{ identifierBox + std::to_string(i) };
-		gui->addDynamicSprite(identifierBoxTemp, uncheckedMqbTextureName, curPos, { 1.f, 1.f }, sf::IntRect{}, sf::degrees(0), gui::Alignment::Top | gui::Alignment::Left);
-		gui->getDynamicSprite(identifierBoxTemp)->addTexture(checkedMqbTextureName);
-		gui->addInteractive(identifierBoxTemp, [identifierBox, i, multipleChoices, atLeastOne](InteractiveInterface* gui) { checkBox(gui, identifierBox, i, multipleChoices, atLeastOne); }); // Will execute checkBox on click.
+		identifierBoxTemp.resize(identifierBox.size());
+		identifierBoxTemp += std::to_string(i);
 
-		if (i == defaultCheckedBox) 
-			gui->getDynamicSprite(identifierBoxTemp)->switchToNextTexture();
+		gui->addDynamicSprite(identifierBoxTemp, uncheckedMqbTextureName, curPos, { 1.f, 1.f }, sf::IntRect{}, sf::degrees(0), gui::Alignment::Top | gui::Alignment::Left);
+		state.boxes.push_back(gui->getSpriteHandle(identifierBoxTemp));
+		gui->getDynamicSprite(state.boxes.back())->addTexture(checkedMqbTextureName);
 
 		curPos += deltaPos;
 	} 
+
+	if (defaultCheckedBox != 0)
+	{
+		state.checkedBits[(defaultCheckedBox - 1u) / 64] |= std::uint64_t{ 1 } << ((defaultCheckedBox - 1u) % 64);
+		state.nbOfCheckedBoxes = 1;
+		state.checkedBox = defaultCheckedBox;
+		showBoxStatus(gui, state.boxes[defaultCheckedBox - 1u], true);
+	}
+
+	const InteractiveInterface::MQBHandle mqb{ gui->addMQBState(identifier, std::move(state)) };
+
+	for (unsigned short i{ 1 }; i <= numberOfBoxes; ++i) // Last, since it may invalidate the pointers to the boxes.
+	{
+		identifierBoxTemp.resize(identifierBox.size());
+		identifierBoxTemp += std::to_string(i);
+
+		gui->addInteractive(identifierBoxTemp, [mqb, i](InteractiveInterface* gui) { checkBox(gui, mqb, i); }); // Will execute checkBox on click.
+	}
 }
 
-std::vector<unsigned short> getMQBStatus(InteractiveInterface* gui, const std::string& identifier) noexcept
+std::vector<unsigned short> getMQBStatus(InteractiveInterface* gui, std::string_view identifier) noexcept
 {
-	ENSURE_VALID_PTR(gui, "The gui was nullptr when the function getMQBStatus was called");
+	std::vector<unsigned short> checkedBoxes{}; // The indexes of the currently checked boxes.
+	getMQBStatus(gui, identifier, checkedBoxes);
 
-	const std::string identifierBox{ mqbIdPrefix + identifier + '_' };
+	return checkedBoxes;
+}
 
-	std::vector<unsigned short> checkedBoxes{}; // The indexes of the currently checked boxes.
-	unsigned short index{ 1 };
-	auto* box{ gui->getDynamicSprite(identifierBox + '1') }; //1-indexed
+void getMQBStatus(InteractiveInterface* gui, std::string_view identifier, std::vector<unsigned short>& checkedBoxes) noexcept
+{
+	ENSURE_VALID_PTR(gui, "The gui was nullptr when the function getMQBStatus was called");
+
+	const InteractiveInterface::MQBState* const state{ gui->getMQBState(identifier) };
+	ENSURE_VALID_PTR(state, "The identifier did not represent a mqb when the function getMQBStatus was called");
 
-	ENSURE_VALID_PTR(box != nullptr, "The identifier did not represent a mqb when the function getMQBStatus was called");
+	checkedBoxes.clear();
+	checkedBoxes.reserve(state->nbOfCheckedBoxes);
 
-	do
+	for (size_t word{ 0 }; word < state->checkedBits.size(); ++word)
 	{
-		if (box->getCurrentTextureIndex() == 1) // If the box is checked.
-			checkedBoxes.push_back(index);
-		box = gui->getDynamicSprite(identifierBox + std::to_string(++index)); // poor cache locality but not meant to be fast
-	} while (box != nullptr);
+		for (std::uint64_t bits{ state->checkedBits[word] }; bits != 0; bits &= bits - 1) // Skips 64 unchecked boxes at once.
+			checkedBoxes.push_back(static_cast<unsigned short>(word * 64 + std::countr_zero(bits) + 1)); // 1-indexed
+	}
+}
 
-	return checkedBoxes;
+bool isMQBBoxChecked(InteractiveInterface* gui, std::string_view identifier, unsigned short box) noexcept
+{
+	ENSURE_VALID_PTR(gui, "The gui was nullptr when the function isMQBBoxChecked was called");
+
+	const InteractiveInterface::MQBState* const state{ gui->getMQBState(identifier) };
+	ENSURE_VALID_PTR(state, "The identifier did not represent a mqb when the function isMQBBoxChecked was called");
+	assert(box > 0 && box <= state->boxes.size() && "The box was out of range when the function isMQBBoxChecked was called");
+
+	return (state->checkedBits[(box - 1u) / 64] >> ((box - 1u) % 64)) & 1;
 }
 
-void hideMQB(InteractiveInterface* gui, const std::string& identifier, bool hide) noexcept
+unsigned short getMQBCheckedBox(InteractiveInterface* gui, std::string_view identifier) noexcept
+{
+	ENSURE_VALID_PTR(gui, "The gui was nullptr when the function getMQBCheckedBox was called");
+
+	const InteractiveInterface::MQBState* const state{ gui->getMQBState(identifier) };
+	ENSURE_VALID_PTR(state, "The identifier did not represent a mqb when the function getMQBCheckedBox was called");
+
+	return state->checkedBox;
+}
+
+void hideMQB(InteractiveInterface* gui, std::string_view identifier, bool hide) noexcept
 {
 	ENSURE_VALID_PTR(gui, "The gui was nullptr when the function hideMQB was called");
 
-	const std::string identifierBox{ mqbIdPrefix + identifier + "_" };
+	const InteractiveInterface::MQBState* const state{ gui->getMQBState(identifier) };
+	if (state == nullptr)
+		return; // Not a mqb.
 
-	unsigned short index{ 1 }; // 1-indexed
-	auto* mqb{ gui->getDynamicSprite(identifierBox + '1') };
-	while (mqb != nullptr)
-	{
-		mqb->hide = hide;
-		mqb = gui->getDynamicSprite(identifierBox + std::to_string(++index)); // poor cache locality but not meant to be fast
-	}
+	for (const MutableInterface::SpriteHandle box : state->boxes)
+		if (SpriteWrapper* const sprite{ gui->getDynamicSprite(box) }; sprite != nullptr)
+			sprite->hide = hide;
 }
 
-void removeMQB(InteractiveInterface* gui, const std::string& identifier, unsigned short numberOfBoxes) noexcept
+void removeMQB(InteractiveInterface* gui, std::string_view identifier) noexcept
 {
 	assert(gui != nullptr && "The gui was nullptr when the function removeMQB was called");
 
-	const std::string identifierBox{ mqbIdPrefix + identifier + "_" };
+	const InteractiveInterface::MQBState* const state{ gui->getMQBState(identifier) };
+	if (state == nullptr)
+		return; // Not a mqb.
+
+	for (const MutableInterface::SpriteHandle box : state->boxes)
+		gui->removeDynamicSprite(box);
 
-	for (; numberOfBoxes > 0; --numberOfBoxes) // 1-indexed
-		gui->removeDynamicSprite(identifierBox + std::to_string(numberOfBoxes)); // poor cache locality but not meant to be fast
+	gui->removeMQBState(identifier);
 }
 
 bool updateWritingText(TextWrapper* text, char32_t unicodeValue, const WritingFunction& func)
@@ -10,7 +10,7 @@
  *
  * \note These files depend on the SFML library.
  * \note All these features were developed for user-friendliness and easy-to-use. They are not built
- *		 for performance (especially mqbs).
+ *		 for performance (especially mqbs). Large data sets are displayed with `ScrollList` instead.
  *********************************************************************/
 
 #ifndef COMPOUNDELEMENTS_HPP
@@ -19,6 +19,7 @@
 #include "Interactiveinterface.hpp"
 #include <SFML/Graphics.hpp>
 #include <string>
+#include <string_view>
 #include <functional>
 #include <vector>
 #include <optional>
@@ -71,7 +72,7 @@ void addProgressBar(MutableInterface* gui, std::string identifier, sf::Vector2f
  * 
  * \see addProgessBar.
  */
-void moveProgressBar(MutableInterface* gui, const std::string& identifier, float progress);
+void moveProgressBar(MutableInterface* gui, std::string_view identifier, float progress);
 
 /**
  * \brief Hides or shows the progress bar and its elements.
@@ -88,7 +89,7 @@ void moveProgressBar(MutableInterface* gui, const std::string& identifier, float
  * 
  * \see removeProgressBar, addProgessBar.
  */
-void hideProgressBar(MutableInterface* gui, const std::string& identifier, bool hide = true);
+void hideProgressBar(MutableInterface* gui, std::string_view identifier, bool hide = true);
 
 /**
  * \brief Removes the progress bar and its elements from the gui.
@@ -104,7 +105,7 @@ void hideProgressBar(MutableInterface* gui, const std::string& identifier, bool
  * 
  * \see hideProgressBar, addProgessBar.
  */
-void removeProgressBar(MutableInterface* gui, const std::string& identifier) noexcept;
+void removeProgressBar(MutableInterface* gui, std::string_view identifier) noexcept;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 /// Progress bar functions.
@@ -174,7 +175,7 @@ void addSlider(InteractiveInterface* gui, std::string identifier, sf::Vector2f p
  * 
  * \see addSlider.
  */
-double moveSlider(InteractiveInterface* gui, const std::string& identifier, double yPos, int intervals = 99, const GrowthSliderFunction& growth = [](double x) {return x; }, const UserFunction& user = nullptr);
+double moveSlider(InteractiveInterface* gui, std::string_view identifier, double yPos, int intervals = 99, const GrowthSliderFunction& growth = [](double x) {return x; }, const UserFunction& user = nullptr);
 
 /**
  * \brief Hides or shows the slider and its elements.
@@ -192,7 +193,7 @@ double moveSlider(InteractiveInterface* gui, const std::string& identifier, doub
  * 
  * \see removeSlider, addSlider.
  */
-void hideSlider(InteractiveInterface* gui, const std::string& identifier, bool hide = true);
+void hideSlider(InteractiveInterface* gui, std::string_view identifier, bool hide = true);
 
 /**
  * \brief Removes the slider and its elements from the gui.
@@ -209,7 +210,7 @@ void hideSlider(InteractiveInterface* gui, const std::string& identifier, bool h
  * 
  * \see hideSlider, addSlider.
  */
-void removeSlider(InteractiveInterface* gui, const std::string& identifier) noexcept;
+void removeSlider(InteractiveInterface* gui, std::string_view identifier) noexcept;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 /// Slider bar functions.
@@ -227,8 +228,9 @@ void removeSlider(InteractiveInterface* gui, const std::string& identifier) noex
  * 
  * Nothing is done if already added.
  * 
- * The mqb is automatically updated via the buttons in the interactive interface. Note that when it
- * is updated, the complexity is O(N) and it is not cache efficient.
+ * The mqb is automatically updated via the buttons in the interactive interface, in O(1): its state
+ * (which boxes are checked, and the handles of the boxes) is stored by the interface, see
+ * `InteractiveInterface::MQBState`.
  *
  * \param[out] gui The interactive gui to which the multiple question box will be added.
  * \param[in]  identifier The unique identifier for the multiple question box.
@@ -259,38 +261,67 @@ void addMQB(InteractiveInterface* gui, const std::string& identifier, sf::Vector
 
 /**
  * \brief get the mqb status, that is to say the indexes of all boxes checked.
- * \complexity O(N), where N is the number of boxes
+ * \complexity O(N / 64 + K), where N is the number of boxes and K the number of checked ones.
  * 
- * All boxes are retrieved through their identifiers by iterating until i grows larger than the number
- * of boxes.
- * 
- * This function is not cache efficient.
+ * The checked boxes are read from the bits of the state of the mqb: boxes are not looked up.
  * 
  * \param[out] gui The interactive gui to which the multiple question box was added.
  * \param[in]  identifier The unique identifier of the multiple question box.
  * 
- * \returns The indexes of all boxes checked
+ * \returns The indexes of all boxes checked, in increasing order.
  * 
  * \note Boxes are 1-indexed.
  * 
  * \pre the gui must not be nullptr
  * \pre the identifier must represent a mqb
- * \post the status will be reported using the texture index
  * \warning asserts otherwise.
  * 
- * \see addMQB.
+ * \see addMQB, getMQBCheckedBox.
+ */
+std::vector<unsigned short> getMQBStatus(InteractiveInterface* gui, std::string_view identifier) noexcept;
+
+/**
+ * \brief Same as `getMQBStatus`, but writes the indexes to a vector, whose memory can be reused
+ *		  between calls.
+ * \complexity O(N / 64 + K), where N is the number of boxes and K the number of checked ones.
+ *
+ * \param[out] checkedBoxes Cleared, then filled with the indexes of all boxes checked.
+ */
+void getMQBStatus(InteractiveInterface* gui, std::string_view identifier, std::vector<unsigned short>& checkedBoxes) noexcept;
+
+/**
+ * \brief Tells if a box of the mqb is checked.
+ * \complexity O(1).
+ *
+ * \param[in] gui The interactive gui to which the multiple question box was added.
+ * \param[in] identifier The unique identifier of the multiple question box.
+ * \param[in] box The 1-indexed box.
+ *
+ * \pre the gui must not be nullptr, the identifier must represent a mqb and the box must exist.
+ * \warning asserts otherwise.
  */
-std::vector<unsigned short> getMQBStatus(InteractiveInterface* gui, const std::string& identifier) noexcept;
+[[nodiscard]] bool isMQBBoxChecked(InteractiveInterface* gui, std::string_view identifier, unsigned short box) noexcept;
+
+/**
+ * \brief Returns the checked box of a mqb without multiple choices, or the last box checked otherwise.
+ * \complexity O(1).
+ *
+ * \param[in] gui The interactive gui to which the multiple question box was added.
+ * \param[in] identifier The unique identifier of the multiple question box.
+ *
+ * \return The 1-indexed box, or 0 if none is checked. With multiple choices, 0 as well if the last box
+ *		   checked was unchecked since.
+ *
+ * \pre the gui must not be nullptr, and the identifier must represent a mqb.
+ * \warning asserts otherwise.
+ */
+[[nodiscard]] unsigned short getMQBCheckedBox(InteractiveInterface* gui, std::string_view identifier) noexcept;
 
 /**
  * \brief Hides or shows the multiple question box and its elements.
  * \complexity O(N), where N is the number of boxes.
  * 
- * All boxes are retrieved through their identifiers by iterating until i grows larger than the number
- * of boxes.
- *
- * This function is not particularly efficient, but it is not meant to be called multiple times
- * per frame or even per second.
+ * Boxes are accessed with the handles stored in the state of the mqb, without their identifiers.
  * 
  * Nothing happens if the identifier is not a multiple question box's identifier.
  * 
@@ -304,24 +335,26 @@ std::vector<unsigned short> getMQBStatus(InteractiveInterface* gui, const std::s
  * 
  * \see removeMQB, addMQB.
  */
-void hideMQB(InteractiveInterface* gui, const std::string& identifier, bool hide = true) noexcept;
+void hideMQB(InteractiveInterface* gui, std::string_view identifier, bool hide = true) noexcept;
 
 /**
  * \brief Removes the multiple question box and its elements from the gui.
  * \complexity O(N), where N is the number of boxes.
  * 
+ * The number of boxes is known from the state of the mqb.
+ * 
  * Nothing happens if the identifier is not a multiple question box's identifier.
  * 
  * \param[out] gui The interactive gui containing the multiple question box.
  * \param[in]  identifier The unique identifier for the multiple question box.
  * 
- * \pre The gui must be a valid ptr.
+ * \pre The gui must be a valid ptr, and must not be locked.
  * \post The multiple question box will be removed from the gui.
  * \warning The program will assert otherwise.
  * 
  * \see hideMQB, addMQB.
  */
-void removeMQB(InteractiveInterface* gui, const std::string& identifier, unsigned short numberOfBoxes) noexcept;
+void removeMQB(InteractiveInterface* gui, std::string_view identifier) noexcept;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 /// MQB functions.
@@ -0,0 +1,561 @@
+/*******************************************************************
+ * \file   FlatMap.hpp
+ * \brief  Declare an open addressing hash map, that stores its elements in a single array.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note This file only depends on the standard library.
+ *********************************************************************/
+
+#ifndef FLATMAP_HPP
+#define FLATMAP_HPP
+
+#include "ArenaAllocator.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include <concepts>
+#include <tuple>
+#include <cassert>
+
+namespace gui
+{
+
+/**
+ * \brief Hash map storing its elements in a single array, with one control byte per slot.
+ *
+ * The design follows SwissTable: a control byte holds 7 bits of the hash of its element, or marks the
+ * slot as empty or deleted. Slots are probed by groups of 8: a lookup compares the 8 control bytes of
+ * a group at once, with a few integer operations, and only compares the keys whose 7 bits match.
+ * Most lookups read one group of control bytes, then one element: there is no node to chase, unlike
+ * `std::unordered_map`.
+ *
+ * The interface is a subset of `std::unordered_map`, with heterogeneous lookups if both `Hash` and
+ * `KeyEqual` define `is_transparent`.
+ *
+ * The storage may be allocated from a memory resource, which is also given to the keys and values that
+ * accept an allocator, such as `ArenaString`. Moving the map moves the resource along with the storage.
+ *
+ * \note Unlike `std::unordered_map`, growing or rehashing the map moves its elements: any insertion
+ *		 invalidates iterators, pointers and references. Erasing only invalidates the erased element.
+ * \warning The key of an element must never be modified through an iterator.
+ *
+ * \see `SlotMap`, for elements whose address must remain stable.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class FlatMap
+{
+public:
+
+	using key_type = Key;
+	using mapped_type = Value;
+	using value_type = std::pair<Key, Value>;
+
+	/// Whether keys can be looked up with other types, e.g. `std::string_view` for `std::string` keys.
+	static constexpr bool s_isTransparent{ requires { typename Hash::is_transparent; typename KeyEqual::is_transparent; } };
+
+	template<bool IsConst>
+	class Iterator
+	{
+	public:
+
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = FlatMap::value_type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+		using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+		constexpr Iterator() noexcept = default;
+
+		constexpr Iterator(const std::int8_t* control, pointer slot) noexcept
+			: m_control{ control }, m_slot{ slot }
+		{
+			skipFreeSlots();
+		}
+
+		template<bool WasConst> requires (IsConst && !WasConst)
+		constexpr Iterator(const Iterator<WasConst>& other) noexcept
+			: m_control{ other.m_control }, m_slot{ other.m_slot }
+		{}
+
+		[[nodiscard]] constexpr reference operator*() const noexcept { return *m_slot; }
+		[[nodiscard]] constexpr pointer operator->() const noexcept { return m_slot; }
+
+		constexpr Iterator& operator++() noexcept
+		{
+			++m_control;
+			++m_slot;
+			skipFreeSlots();
+			return *this;
+		}
+
+		constexpr Iterator operator++(int) noexcept
+		{
+			Iterator previous{ *this };
+			++(*this);
+			return previous;
+		}
+
+		[[nodiscard]] constexpr bool operator==(const Iterator& other) const noexcept
+		{
+			return m_slot == other.m_slot;
+		}
+
+	private:
+
+		template<bool> friend class Iterator;
+		friend class FlatMap;
+
+		/// Skips the empty and deleted slots. The control bytes end with a sentinel, which stops it.
+		constexpr void skipFreeSlots() noexcept
+		{
+			if (m_control == nullptr)
+				return;
+
+			while (*m_control < 0 && *m_control != s_sentinel)
+			{
+				++m_control;
+				++m_slot;
+			}
+		}
+
+		const std::int8_t* m_control{ nullptr };
+		pointer m_slot{ nullptr };
+	};
+
+	using iterator = Iterator<false>;
+	using const_iterator = Iterator<true>;
+
+
+	inline FlatMap() noexcept
+		: m_control{ emptyControl() }, m_slots{ nullptr }, m_mask{ 0 }, m_size{ 0 }, m_growthLeft{ 0 }, m_allocator{}
+	{}
+
+	/**
+	 * \param[in] resource Where the storage is allocated from, or nullptr for the global heap. It must
+	 *					   outlive the map.
+	 */
+	inline explicit FlatMap(std::pmr::memory_resource* resource) noexcept
+		: m_control{ emptyControl() }, m_slots{ nullptr }, m_mask{ 0 }, m_size{ 0 }, m_growthLeft{ 0 }, m_allocator{ resource }
+	{}
+
+	FlatMap(const FlatMap&) noexcept = delete;
+	FlatMap& operator=(const FlatMap&) noexcept = delete;
+
+	inline FlatMap(FlatMap&& other) noexcept
+		: m_control{ std::exchange(other.m_control, emptyControl()) }, m_slots{ std::exchange(other.m_slots, nullptr) },
+		  m_mask{ std::exchange(other.m_mask, 0) }, m_size{ std::exchange(other.m_size, 0) }, m_growthLeft{ std::exchange(other.m_growthLeft, 0) }, m_allocator{ other.m_allocator }
+	{}
+
+	inline FlatMap& operator=(FlatMap&& other) noexcept
+	{
+		if (this != &other)
+		{
+			destroy();
+			m_control = std::exchange(other.m_control, emptyControl());
+			m_slots = std::exchange(other.m_slots, nullptr);
+			m_mask = std::exchange(other.m_mask, 0);
+			m_size = std::exchange(other.m_size, 0);
+			m_growthLeft = std::exchange(other.m_growthLeft, 0);
+			std::swap(m_allocator, other.m_allocator); // The other map is given the resource of this one, empty.
+		}
+
+		return *this;
+	}
+
+	inline ~FlatMap() noexcept
+	{
+		destroy();
+	}
+
+
+	[[nodiscard]] inline iterator begin() noexcept { return iterator{ m_control, m_slots }; }
+	[[nodiscard]] inline const_iterator begin() const noexcept { return const_iterator{ m_control, m_slots }; }
+	[[nodiscard]] inline iterator end() noexcept { return iterator{ nullptr, m_slots + slotCount() }; }
+	[[nodiscard]] inline const_iterator end() const noexcept { return const_iterator{ nullptr, m_slots + slotCount() }; }
+
+	[[nodiscard]] inline size_t size() const noexcept { return m_size; }
+	[[nodiscard]] inline bool empty() const noexcept { return m_size == 0; }
+
+	/**
+	 * \brief Returns the number of elements the map can hold before growing.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t capacity() const noexcept
+	{
+		return m_size + m_growthLeft;
+	}
+
+
+	/**
+	 * \brief Finds an element.
+	 * \complexity Average O(1), usually a single group of control bytes is read.
+	 *
+	 * \return An iterator to the element, or `end()` if it does not exist.
+	 */
+	template<typename K> requires (s_isTransparent || std::same_as<K, Key>)
+	[[nodiscard]] inline iterator find(const K& key) noexcept
+	{
+		const size_t index{ findIndex(key) };
+		return (index != s_notFound) ? iterator{ m_control + index, m_slots + index } : end();
+	}
+
+	template<typename K> requires (s_isTransparent || std::same_as<K, Key>)
+	[[nodiscard]] inline const_iterator find(const K& key) const noexcept
+	{
+		const size_t index{ findIndex(key) };
+		return (index != s_notFound) ? const_iterator{ m_control + index, m_slots + index } : end();
+	}
+
+	template<typename K> requires (s_isTransparent || std::same_as<K, Key>)
+	[[nodiscard]] inline bool contains(const K& key) const noexcept
+	{
+		return findIndex(key) != s_notFound;
+	}
+
+	/**
+	 * \brief Inserts an element, unless its key already exists.
+	 * \complexity Amortized O(1).
+	 *
+	 * \return An iterator to the element with this key, and whether it was inserted.
+	 *
+	 * \throw std::bad_alloc, or what the constructors of the element throw. Strong exception guarantee.
+	 */
+	template<typename K, typename... Args>
+	inline std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+	{
+		const size_t hash{ hashOf(key) };
+		if (const size_t index{ findIndex(key, hash) }; index != s_notFound)
+			return { iterator{ m_control + index, m_slots + index }, false };
+
+		if (m_growthLeft == 0) [[unlikely]]
+			rehash((m_size + 1 > capacityFor(slotCount()) / 2) ? std::max(slotCount() * 2, s_groupWidth) : slotCount());
+
+		const size_t index{ findFreeSlot(hash) };
+		std::uninitialized_construct_using_allocator(m_slots + index, m_allocator, std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+
+		m_growthLeft -= (m_control[index] == s_empty); // Reusing a deleted slot does not consume growth.
+		setControl(index, static_cast<std::int8_t>(hash & 0x7f));
+		++m_size;
+
+		return { iterator{ m_control + index, m_slots + index }, true };
+	}
+
+	template<typename K, typename V>
+	inline std::pair<iterator, bool> emplace(K&& key, V&& value)
+	{
+		return try_emplace(std::forward<K>(key), std::forward<V>(value));
+	}
+
+	template<typename K, typename V>
+	inline std::pair<iterator, bool> insert_or_assign(K&& key, V&& value)
+	{
+		auto result{ try_emplace(std::forward<K>(key), std::forward<V>(value)) };
+		if (!result.second)
+			result.first->second = std::forward<V>(value);
+
+		return result;
+	}
+
+	/**
+	 * \brief Erases an element.
+	 * \complexity O(1).
+	 *
+	 * \pre The iterator must refer to an element of this map.
+	 * \warning Asserts otherwise.
+	 */
+	inline void erase(const_iterator position) noexcept
+	{
+		assert(position.m_slot >= m_slots && position.m_slot < m_slots + slotCount() && "Precondition violated; the iterator did not refer to an element when erase of FlatMap was called");
+
+		const size_t index{ static_cast<size_t>(position.m_slot - m_slots) };
+		std::destroy_at(m_slots + index);
+		--m_size;
+
+		// A group only stops having empty slots once it is full, and probes only go past full groups.
+		// Therefore, if the group still has an empty slot, no probe ever went past it.
+		if (emptyBits(loadGroup(index & ~(s_groupWidth - 1))) != 0)
+		{
+			setControl(index, s_empty);
+			++m_growthLeft;
+		}
+		else
+			setControl(index, s_deleted);
+	}
+
+	inline void erase(iterator position) noexcept
+	{
+		erase(const_iterator{ position }); // Otherwise, the overload that takes a key would be chosen.
+	}
+
+	template<typename K> requires (s_isTransparent || std::same_as<K, Key>)
+	inline size_t erase(const K& key) noexcept
+	{
+		const size_t index{ findIndex(key) };
+		if (index == s_notFound)
+			return 0;
+
+		erase(const_iterator{ m_control + index, m_slots + index });
+		return 1;
+	}
+
+	/**
+	 * \brief Destroys all elements, but keeps the memory.
+	 * \complexity O(C), where C is the number of slots.
+	 */
+	inline void clear() noexcept
+	{
+		for (size_t i{ 0 }; i < slotCount(); ++i)
+			if (m_control[i] >= 0)
+				std::destroy_at(m_slots + i);
+
+		if (slotCount() != 0)
+			std::memset(m_control, s_empty, slotCount());
+
+		m_size = 0;
+		m_growthLeft = capacityFor(slotCount());
+	}
+
+	/**
+	 * \brief Makes room for a number of elements, so that inserting them does not grow the map.
+	 * \complexity O(N) if the map grows, where N is the number of elements.
+	 *
+	 * \throw std::bad_alloc. Strong exception guarantee.
+	 */
+	inline void reserve(size_t nbOfElements)
+	{
+		if (nbOfElements <= capacity())
+			return;
+
+		size_t slots{ s_groupWidth };
+		while (capacityFor(slots) < nbOfElements)
+			slots *= 2;
+
+		rehash(slots);
+	}
+
+private:
+
+	static constexpr std::int8_t s_empty{ -128 }; // 0b10000000
+	static constexpr std::int8_t s_deleted{ -2 }; // 0b11111110
+	static constexpr std::int8_t s_sentinel{ -1 }; // 0b11111111, after the last slot, stops iterations.
+	static constexpr size_t s_groupWidth{ 8 }; // The number of slots is a multiple of it.
+	static constexpr size_t s_notFound{ static_cast<size_t>(-1) };
+
+	static constexpr std::uint64_t s_lowBits{ 0x0101010101010101ull };
+	static constexpr std::uint64_t s_highBits{ 0x8080808080808080ull };
+
+
+	[[nodiscard]] inline size_t slotCount() const noexcept
+	{
+		return (m_slots != nullptr) ? m_mask + 1 : 0;
+	}
+
+	/// Maximum load factor of 7/8.
+	[[nodiscard]] inline static constexpr size_t capacityFor(size_t slots) noexcept
+	{
+		return slots - slots / 8;
+	}
+
+	/// The control bytes of an empty map: only the sentinel, so that iterating it needs no branch.
+	[[nodiscard]] inline static std::int8_t* emptyControl() noexcept
+	{
+		static std::int8_t control[1]{ s_sentinel };
+		return control;
+	}
+
+	/// Mixes the hash, so that hashes that only differ by their high bits (e.g. identity hashes of
+	/// indexes) still spread over the slots.
+	template<typename K>
+	[[nodiscard]] inline static size_t hashOf(const K& key) noexcept
+	{
+		std::uint64_t hash{ static_cast<std::uint64_t>(Hash{}(key)) };
+		hash ^= hash >> 32;
+		hash *= 0xd6e8feb86659fd93ull;
+		hash ^= hash >> 32;
+		return static_cast<size_t>(hash);
+	}
+
+	/// Reads the control bytes of the group starting at `index`, the first one in the lowest bits.
+	[[nodiscard]] inline std::uint64_t loadGroup(size_t index) const noexcept
+	{
+		std::uint64_t group{ 0 };
+
+		if constexpr (std::endian::native == std::endian::little)
+			std::memcpy(&group, m_control + index, sizeof(group)); // A single load.
+		else
+			for (size_t i{ 0 }; i < s_groupWidth; ++i)
+				group |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(m_control[index + i])) << (8 * i);
+
+		return group;
+	}
+
+	/// One bit per byte whose 7 low bits are `h2`. May have false positives, which keys comparisons rule out.
+	[[nodiscard]] inline static std::uint64_t matchingBits(std::uint64_t group, std::uint8_t h2) noexcept
+	{
+		const std::uint64_t x{ group ^ (s_lowBits * h2) };
+		return (x - s_lowBits) & ~x & s_highBits;
+	}
+
+	/// One bit per empty byte: its high bit is set, and its second lowest bit is not.
+	[[nodiscard]] inline static std::uint64_t emptyBits(std::uint64_t group) noexcept
+	{
+		return group & ~(group << 6) & s_highBits;
+	}
+
+	template<typename K>
+	[[nodiscard]] inline size_t findIndex(const K& key) const noexcept
+	{
+		return findIndex(key, hashOf(key));
+	}
+
+	template<typename K>
+	[[nodiscard]] inline size_t findIndex(const K& key, size_t hash) const noexcept
+	{
+		if (m_slots == nullptr) [[unlikely]]
+			return s_notFound;
+
+		const std::uint8_t h2{ static_cast<std::uint8_t>(hash & 0x7f) };
+		size_t position{ firstGroupOf(hash) };
+
+		for (size_t step{ s_groupWidth }; ; step += s_groupWidth)
+		{
+			const std::uint64_t group{ loadGroup(position) };
+
+			for (std::uint64_t matches{ matchingBits(group, h2) }; matches != 0; matches &= matches - 1)
+			{
+				const size_t index{ position + static_cast<size_t>(std::countr_zero(matches)) / 8 };
+				if (KeyEqual{}(m_slots[index].first, key)) [[likely]]
+					return index;
+			}
+
+			if (emptyBits(group) != 0) [[likely]]
+				return s_notFound;
+
+			position = (position + step) & m_mask; // Triangular probing visits every group.
+		}
+	}
+
+	[[nodiscard]] inline size_t firstGroupOf(size_t hash) const noexcept
+	{
+		return (hash >> 7) & m_mask & ~(s_groupWidth - 1);
+	}
+
+	/// Returns the first empty or deleted slot of the probe sequence.
+	[[nodiscard]] inline size_t findFreeSlot(size_t hash) const noexcept
+	{
+		size_t position{ firstGroupOf(hash) };
+
+		for (size_t step{ s_groupWidth }; ; step += s_groupWidth)
+		{
+			const std::uint64_t freeSlots{ loadGroup(position) & s_highBits };
+			if (freeSlots != 0) [[likely]]
+				return position + static_cast<size_t>(std::countr_zero(freeSlots)) / 8;
+
+			position = (position + step) & m_mask;
+		}
+	}
+
+	inline void setControl(size_t index, std::int8_t control) noexcept
+	{
+		m_control[index] = control;
+	}
+
+	/**
+	 * \brief Moves all elements into new storage.
+	 * \complexity O(N + C), where N is the number of elements and C the number of slots.
+	 */
+	inline void rehash(size_t newSlotCount)
+	{
+		assert(std::has_single_bit(newSlotCount) && newSlotCount >= s_groupWidth && "the number of slots is a power of 2");
+
+		ArenaAllocator<std::int8_t> controlAllocator{ m_allocator };
+		std::int8_t* const control{ controlAllocator.allocate(newSlotCount + 1) };
+		value_type* slots{ nullptr };
+		try
+		{
+			slots = m_allocator.allocate(newSlotCount);
+		}
+		catch (...)
+		{
+			controlAllocator.deallocate(control, newSlotCount + 1);
+			throw;
+		}
+
+		std::memset(control, s_empty, newSlotCount);
+		control[newSlotCount] = s_sentinel;
+
+		std::int8_t* const oldControl{ m_control };
+		value_type* const oldSlots{ m_slots };
+		const size_t oldSlotCount{ slotCount() };
+
+		m_control = control;
+		m_slots = slots;
+		m_mask = newSlotCount - 1;
+		m_growthLeft = capacityFor(newSlotCount) - m_size;
+
+		static_assert(std::is_nothrow_move_constructible_v<value_type>, "Elements are moved while rehashing");
+		for (size_t i{ 0 }; i < oldSlotCount; ++i)
+		{
+			if (oldControl[i] < 0)
+				continue;
+
+			const size_t hash{ hashOf(oldSlots[i].first) };
+			const size_t index{ findFreeSlot(hash) };
+			std::construct_at(m_slots + index, std::move(oldSlots[i]));
+			std::destroy_at(oldSlots + i);
+			setControl(index, static_cast<std::int8_t>(hash & 0x7f));
+		}
+
+		if (oldSlots != nullptr)
+		{
+			m_allocator.deallocate(oldSlots, oldSlotCount);
+			controlAllocator.deallocate(oldControl, oldSlotCount + 1);
+		}
+	}
+
+	inline void destroy() noexcept
+	{
+		if (m_slots == nullptr)
+			return;
+
+		for (size_t i{ 0 }; i < slotCount(); ++i)
+			if (m_control[i] >= 0)
+				std::destroy_at(m_slots + i);
+
+		m_allocator.deallocate(m_slots, slotCount());
+		ArenaAllocator<std::int8_t>{ m_allocator }.deallocate(m_control, slotCount() + 1);
+
+		m_control = emptyControl();
+		m_slots = nullptr;
+		m_mask = 0;
+		m_size = 0;
+		m_growthLeft = 0;
+	}
+
+
+	/// One control byte per slot, then the sentinel.
+	std::int8_t* m_control;
+	/// The elements, constructed only where the control byte is positive.
+	value_type* m_slots;
+	/// The number of slots minus one, always a power of 2 minus one.
+	size_t m_mask;
+	/// The number of elements.
+	size_t m_size;
+	/// The number of empty slots that can be filled before growing.
+	size_t m_growthLeft;
+	/// Allocates the slots and the control bytes.
+	ArenaAllocator<value_type> m_allocator;
+};
+
+} // gui namespace
+
+#endif // FLATMAP_HPP
@@ -0,0 +1,120 @@
+#include "FramePreparer.hpp"
+#include <exception>
+#include <future>
+#include <utility>
+#include <algorithm>
+
+namespace gui
+{
+
+void FramePreparer::setUpdate(const sf::RenderWindow* window, std::function<void()> update)
+{
+	ENSURE_VALID_PTR(window, "The window was nullptr when the function setUpdate of FramePreparer was called");
+
+	if (!update)
+	{
+		m_updates.erase(window);
+		return;
+	}
+
+	m_updates.insert_or_assign(window, std::move(update));
+}
+
+size_t FramePreparer::prepare(std::span<BasicInterface* const> interfaces)
+{
+	ResourceContext& context{ ResourceContext::current() };
+	++context.m_frame; // Vertices prepared for the previous frame, but not drawn, are prepared again.
+
+	// The given interfaces grouped by window. There are only a few windows: they are searched linearly.
+	std::vector<std::pair<const sf::RenderWindow*, std::vector<BasicInterface*>>> interfacesByWindow{};
+	for (BasicInterface* gui : interfaces)
+	{
+		ENSURE_VALID_PTR(gui, "An interface was nullptr when the function prepare of FramePreparer was called");
+		assert(gui->m_context == &context && "Precondition violated; an interface belonged to another context when the function prepare of FramePreparer was called");
+
+		const auto sameWindow{ std::find_if(interfacesByWindow.begin(), interfacesByWindow.end(), [gui](const auto& x) { return x.first == gui->m_window; }) };
+		if (sameWindow != interfacesByWindow.end())
+			sameWindow->second.push_back(gui);
+		else
+			interfacesByWindow.emplace_back(gui->m_window, std::vector<BasicInterface*>{ gui });
+	}
+
+	// Windows with interfaces, then windows with an update only.
+	std::vector<std::pair<const std::function<void()>*, const std::vector<BasicInterface*>*>> windows{};
+	windows.reserve(interfacesByWindow.size() + m_updates.size());
+
+	for (const auto& [window, windowInterfaces] : interfacesByWindow)
+	{
+		const auto update{ m_updates.find(window) };
+		windows.emplace_back((update != m_updates.end()) ? &update->second : nullptr, &windowInterfaces);
+	}
+	for (const auto& [window, update] : m_updates)
+		if (std::none_of(interfacesByWindow.begin(), interfacesByWindow.end(), [window](const auto& x) { return x.first == window; }))
+			windows.emplace_back(&update, nullptr);
+
+	if (windows.empty())
+		return 0;
+
+	const bool isParallel{ windows.size() > 1 && m_pool->getThreadCount() != 0 };
+
+	// All windows but the first go to the workers. The first one is prepared by this thread meanwhile.
+	std::vector<std::future<void>> futures{};
+	if (isParallel)
+	{
+		futures.reserve(windows.size() - 1);
+		for (size_t i{ 1 }; i < windows.size(); ++i)
+		{
+			futures.push_back(m_pool->submit([&context, window = windows[i]]()
+			{
+				const ResourceContext::Binding binding{ context }; // Wrappers read the fonts of their context.
+				prepareWindow(window.first, window.second);
+			}));
+		}
+	}
+
+	std::exception_ptr error{};
+	for (size_t i{ 0 }; i < (isParallel ? 1 : windows.size()); ++i)
+	{
+		try
+		{
+			prepareWindow(windows[i].first, windows[i].second);
+		}
+		catch (...)
+		{
+			if (error == nullptr)
+				error = std::current_exception();
+		}
+	}
+
+	for (auto& future : futures)
+	{	// Every window is waited for, even if one threw: the interfaces must not be used by a worker afterwards.
+		try
+		{
+			future.get();
+		}
+		catch (...)
+		{
+			if (error == nullptr)
+				error = std::current_exception();
+		}
+	}
+
+	if (error != nullptr) [[unlikely]]
+		std::rethrow_exception(error);
+
+	return windows.size();
+}
+
+void FramePreparer::prepareWindow(const std::function<void()>* update, const std::vector<BasicInterface*>* interfaces)
+{
+	if (update != nullptr)
+		(*update)(); // Wrappers lock the mutexes of their context themselves, only while they read fonts or switch textures.
+
+	if (interfaces == nullptr)
+		return;
+
+	for (BasicInterface* gui : *interfaces)
+		gui->prepareFrame();
+}
+
+} // gui namespace
@@ -0,0 +1,180 @@
+/*******************************************************************
+ * \file   FramePreparer.hpp, FramePreparer.cpp
+ * \brief  Declare a stage that prepares the frame of each window on a worker thread, before drawing.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note These files depend on the SFML library.
+ * \note All assertions are disabled in release mode. If broken, undefined behavior will occur.
+ *********************************************************************/
+
+#ifndef FRAMEPREPARER_HPP
+#define FRAMEPREPARER_HPP
+
+#include "BasicInterface.hpp"
+#include "ThreadPool.hpp"
+#include <SFML/Graphics.hpp>
+#include <unordered_map>
+#include <vector>
+#include <span>
+#include <initializer_list>
+#include <functional>
+
+namespace gui
+{
+
+/**
+ * \brief Prepares the interfaces of every window in parallel, so that the render thread only issues
+ *		  the draw calls.
+ *
+ * With several windows, the work of a frame adds up window by window: tweens and animations, the
+ * resize of the elements after the window was resized, and the vertices of batched drawing. Instead,
+ * `prepare` receives the interfaces about to be drawn, and gives each of their windows to a worker of
+ * a `ThreadPool`, which:
+ *
+ * - runs the update registered for the window, if any (typically `TweenEngine::update`),
+ * - applies the pending resize of the given interfaces of the window,
+ * - builds the vertices of those drawn in batches (see `BasicInterface::lockInterface`).
+ *
+ * Once all windows are prepared, the render thread draws the interfaces as usual: `draw` only sends
+ * the vertices that were built. Interfaces that are not drawn in batches, or whose static layer is
+ * cached, are only resized: their drawing is done by the render thread anyway. Interfaces that are
+ * not given, such as the menus that are not displayed, are left alone: their resize is still
+ * deferred until they are drawn.
+ *
+ * Windows are independent: a worker only touches the elements of its window, and the updates run in
+ * parallel as well. Fonts are shared by all windows though, and rasterize their glyphs on demand:
+ * texts only read them under a mutex of their `ResourceContext`, so that updates may change the
+ * content, the font or the character size of texts. Batched texts are laid out from the glyphs cached
+ * by their interface: the mutex is only locked the first time a glyph is met, and while a modified
+ * text computes its origin. Likewise, sprites switch textures under another mutex of the context, so
+ * that updates may play animations (`SpriteAnimator::update`).
+ *
+ * \note Elements must not be modified between `prepare` and `draw`, otherwise they are displayed as
+ *		 they were when prepared until the next frame. Interfaces prepared but not drawn are prepared
+ *		 again by their next `draw` once `prepare` is called again.
+ * \note With a single window or a single worker, everything is done on the calling thread.
+ * \note A texture switched to by an update, but not loaded yet, is loaded by the worker: prefetch the
+ *		 textures of animations beforehand (see `SpriteWrapper::prefetchTextures`).
+ * \warning Updates run on a worker: they must only modify the elements of their window. They must
+ *			not create or remove textures or fonts, nor add textures to sprites, since the registries
+ *			of the context are shared by all windows.
+ *
+ * \code
+ * gui::FramePreparer preparer{};
+ * preparer.setUpdate(&controlWindow, [&controlTweens, &elapsed]() { controlTweens.update(elapsed); });
+ * preparer.setUpdate(&mapWindow, [&mapTweens, &elapsed]() { mapTweens.update(elapsed); });
+ *
+ * while (controlWindow.isOpen())
+ * {
+ *		// Events...
+ *		elapsed = clock.restart();
+ *		preparer.prepare({ &controlInterface, &mapInterface }); // Both windows are prepared in parallel.
+ *
+ *		controlWindow.clear();
+ *		controlInterface.draw();
+ *		controlWindow.display();
+ *
+ *		mapWindow.clear();
+ *		mapInterface.draw();
+ *		mapWindow.display();
+ * }
+ * \endcode
+ *
+ * \see `BasicInterface::draw`, `RenderBatch::prepare`, `ThreadPool`.
+ */
+class FramePreparer
+{
+public:
+
+	/**
+	 * \brief Constructs a preparer without any update.
+	 * \complexity O(1).
+	 *
+	 * \param[in] pool The workers that prepare the windows. Must outlive the preparer.
+	 */
+	inline explicit FramePreparer(ThreadPool& pool = ThreadPool::getShared()) noexcept
+		: m_pool{ &pool }, m_updates{}
+	{}
+
+	FramePreparer(const FramePreparer&) noexcept = delete;
+	FramePreparer(FramePreparer&&) noexcept = delete;
+	FramePreparer& operator=(const FramePreparer&) noexcept = delete;
+	FramePreparer& operator=(FramePreparer&&) noexcept = delete;
+	~FramePreparer() noexcept = default;
+
+
+	/**
+	 * \brief Sets the function called on the worker of a window, before its interfaces are prepared.
+	 * \complexity Amortized O(1).
+	 *
+	 * \param[in] window The window.
+	 * \param[in] update Called once per `prepare`. Replaces the previous one. If empty, the window no
+	 *			  longer has any update.
+	 *
+	 * \pre `window` must be a valid ptr.
+	 * \warning The program will assert otherwise.
+	 * \throw std::bad_alloc. Strong exception guarantee.
+	 */
+	void setUpdate(const sf::RenderWindow* window, std::function<void()> update);
+
+	/**
+	 * \brief Prepares the next frame of the given interfaces, and runs the updates of all windows.
+	 * \complexity O(N / T + I * W), where N is the number of elements of the interfaces, T the number of
+	 *			   windows prepared in parallel, I the number of interfaces and W the number of windows;
+	 *			   plus the complexity of the updates.
+	 *
+	 * Blocks until all windows are prepared. Windows are prepared within the `ResourceContext` of the
+	 * calling thread. The updates of windows without any interface given still run.
+	 *
+	 * \param[in] interfaces The interfaces that are about to be drawn.
+	 *
+	 * \return The number of windows prepared.
+	 *
+	 * \pre Must be called by the render thread, and no other thread may use the interfaces meanwhile.
+	 * \pre The interfaces must belong to the `ResourceContext` of the calling thread.
+	 * \warning The program will assert otherwise.
+	 * \throw What the updates throw, once all windows are prepared. If several updates throw, only one
+	 *		  of the exceptions is thrown.
+	 */
+	size_t prepare(std::span<BasicInterface* const> interfaces);
+
+	/**
+	 * \see `prepare(std::span<BasicInterface* const>)`.
+	 */
+	inline size_t prepare(std::initializer_list<BasicInterface*> interfaces)
+	{
+		return prepare(std::span<BasicInterface* const>{ interfaces.begin(), interfaces.size() });
+	}
+
+	/**
+	 * \brief Returns the number of windows that have an update.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t getNbOfUpdates() const noexcept
+	{
+		return m_updates.size();
+	}
+
+private:
+
+	/**
+	 * \brief Runs the update of a window, then prepares its interfaces.
+	 * \complexity O(N), where N is the number of elements of the interfaces.
+	 *
+	 * \param[in] update The update of the window, can be nullptr.
+	 * \param[in] interfaces The interfaces of the window, can be nullptr.
+	 */
+	static void prepareWindow(const std::function<void()>* update, const std::vector<BasicInterface*>* interfaces);
+
+
+	/// The workers that prepare the windows.
+	ThreadPool* m_pool;
+	/// The update of each window, called before its interfaces are prepared.
+	std::unordered_map<const sf::RenderWindow*, std::function<void()>> m_updates;
+};
+
+} // gui namespace
+
+#endif // FRAMEPREPARER_HPP
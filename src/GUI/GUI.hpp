@@ -16,10 +16,17 @@
 #define GUI_HPP
 
 #include "GraphicalResources.hpp"
+#include "ResourceContext.hpp"
 #include "BasicInterface.hpp"
 #include "MutableInterface.hpp"
 #include "InteractiveInterface.hpp"
+#include "StaticInterface.hpp"
+#include "InputDispatcher.hpp"
+#include "FramePreparer.hpp"
 #include "CompoundElements.hpp"
+#include "SpriteAnimator.hpp"
+#include "TweenEngine.hpp"
+#include "ScrollList.hpp"
 #include <string>
 #include <sstream>
 #include <cstddef>
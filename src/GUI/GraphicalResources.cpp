@@ -1,5 +1,10 @@
 #include "GraphicalResources.hpp"
+#include "ResourceContext.hpp"
+#include "ThreadPool.hpp"
+#include "SpatialGrid.hpp"
 #include <utility>
+#include <algorithm>
+#include <limits>
 
 namespace gui
 {
@@ -12,36 +17,51 @@ void TransformableWrapper::move(sf::Vector2f pos) noexcept
 {
 	ENSURE_VALID_PTR(m_transformable, "Pointer to sf::Transformable in TransformableWrapper is nullptr when the function move is called");
 	m_transformable->move(pos);
+	markModified();
 }
 
 void TransformableWrapper::scale(sf::Vector2f pos) noexcept
 {
 	ENSURE_VALID_PTR(m_transformable, "Pointer to sf::Transformable in TransformableWrapper is nullptr when the function scale is called");
 	m_transformable->scale(pos);
+	markModified();
 }
 
 void TransformableWrapper::rotate(sf::Angle pos) noexcept
 {
 	ENSURE_VALID_PTR(m_transformable, "Pointer to sf::Transformable in TransformableWrapper is nullptr when the function rotate is called");
 	m_transformable->rotate(pos);
+	markModified();
 }
 
 void TransformableWrapper::setPosition(sf::Vector2f pos) noexcept
 {
 	ENSURE_VALID_PTR(m_transformable, "Pointer to sf::Transformable in TransformableWrapper is nullptr when the function setPosition is called");
 	m_transformable->setPosition(pos);
+	markModified();
 }
 
 void TransformableWrapper::setScale(sf::Vector2f pos) noexcept
 {
 	ENSURE_VALID_PTR(m_transformable, "Pointer to sf::Transformable in TransformableWrapper is nullptr when the function setScale is called");
 	m_transformable->setScale(pos);
+	markModified();
 }
 
 void TransformableWrapper::setRotation(sf::Angle pos) noexcept
 {
 	ENSURE_VALID_PTR(m_transformable, "Pointer to sf::Transformable in TransformableWrapper is nullptr when the function setRotation is called");
 	m_transformable->setRotation(pos);
+	markModified();
+}
+
+void TransformableWrapper::markModified() noexcept
+{
+	++m_revision;
+	m_areBoundsOutdated = true;
+
+	if (m_spatialLink.grid != nullptr) [[unlikely]]
+		m_spatialLink.grid->markDirty(m_spatialLink.slot);
 }
 
 void TransformableWrapper::create(sf::Transformable* transformable, sf::Vector2f pos, sf::Vector2f scale, sf::Angle rot, Alignment alignment) noexcept
@@ -66,31 +86,48 @@ void TransformableWrapper::create(sf::Transformable* transformable, sf::Vector2f
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 TextWrapper::TextWrapper(const TextWrapper& other) noexcept
-	: TransformableWrapper{}, m_wrappedText{ other.m_wrappedText }
+	: TransformableWrapper{}, m_wrappedText{ other.m_wrappedText }, m_contentBuffer{}, m_registry{ other.m_registry }, m_fontKey{ other.m_fontKey }
 {
 	this->m_alignment = other.m_alignment;
 	this->hide = other.hide;
 
 	this->m_transformable = &m_wrappedText;
+
+	std::lock_guard lock{ m_registry->mutex };
+	trackCharacterSize(*m_registry, m_fontKey, m_wrappedText.getCharacterSize(), 1);
 }
 
 TextWrapper::TextWrapper(TextWrapper&& other) noexcept
-	: TransformableWrapper{}, m_wrappedText{ std::move(other.m_wrappedText) }
+	: TransformableWrapper{}, m_wrappedText{ std::move(other.m_wrappedText) }, m_contentBuffer{}, m_registry{ other.m_registry }, m_fontKey{ other.m_fontKey }
 {
 	std::swap(this->m_alignment, other.m_alignment);
 	std::swap(this->hide,		 other.hide);
 
+	other.m_fontKey = {}; // This text now counts as the user of the character size.
 	other.m_transformable = nullptr;
 	this->m_transformable = &m_wrappedText;
 }
 
 TextWrapper& TextWrapper::operator=(const TextWrapper& other) noexcept
 {
+	{
+		std::lock_guard lock{ m_registry->mutex };
+		untrackCharacterSize(*m_registry, m_fontKey, m_wrappedText.getCharacterSize());
+	}
+
 	this->m_wrappedText = other.m_wrappedText;
 	this->m_alignment =	  other.m_alignment;
 	this->hide =		  other.hide;
+	this->m_registry =	  other.m_registry;
+	this->m_fontKey =	  other.m_fontKey;
+
+	{
+		std::lock_guard lock{ m_registry->mutex }; // The registry of the other text, possibly another one.
+		trackCharacterSize(*m_registry, m_fontKey, m_wrappedText.getCharacterSize(), 1);
+	}
 
 	this->m_transformable = &m_wrappedText;
+	this->markModified();
 
 	return *this;
 }
@@ -100,56 +137,122 @@ TextWrapper& TextWrapper::operator=(TextWrapper&& other) noexcept
 	std::swap(this->m_wrappedText, other.m_wrappedText);
 	std::swap(this->m_alignment,   other.m_alignment);
 	std::swap(this->hide,		   other.hide);
+	std::swap(this->m_registry,	   other.m_registry);
+	std::swap(this->m_fontKey,	   other.m_fontKey);
 
 	other.m_transformable = nullptr;
 	this->m_transformable = &m_wrappedText;
+	this->markModified();
+	other.markModified();
 
 	return *this;
 }
 
+TextWrapper::~TextWrapper() noexcept
+{
+	std::lock_guard lock{ m_registry->mutex };
+	untrackCharacterSize(*m_registry, m_fontKey, m_wrappedText.getCharacterSize());
+}
+
+void TextWrapper::setContent(std::string_view content) noexcept
+{
+	const sf::String& currentContent{ m_wrappedText.getString() };
+	const bool isAscii{ std::all_of(content.begin(), content.end(), [](char character) { return static_cast<unsigned char>(character) < 128; }) };
+
+	if (!isAscii) [[unlikely]]
+	{
+		const sf::String convertedContent{ std::string{ content } }; // With the global locale, as `std::ostringstream` contents.
+		if (convertedContent != currentContent)
+			setContent(convertedContent);
+		else
+			PROFILE_COUNT(setContentSkips, 1);
+
+		return;
+	}
+
+	if (currentContent.getSize() == content.size())
+	{
+		size_t i{ 0 };
+		while (i < content.size() && currentContent[i] == static_cast<char32_t>(content[i]))
+			++i;
+
+		if (i == content.size())
+		{
+			PROFILE_COUNT(setContentSkips, 1);
+			return; // Same content.
+		}
+	}
+
+	m_contentBuffer.clear(); // Keeps its capacity.
+	for (const char character : content)
+		m_contentBuffer += static_cast<char32_t>(character);
+
+	setContent(m_contentBuffer);
+}
+
 void TextWrapper::setContent(const std::ostringstream& content) noexcept
 {
+	PROFILE_COUNT(setContentUpdates, 1);
 	m_wrappedText.setString(content.str());
-	m_wrappedText.setOrigin(computeNewOrigin(m_wrappedText.getLocalBounds(), m_alignment));
+	setOriginFromLayout();
 }
 
 void TextWrapper::setContent(const sf::String& content) noexcept
 {
+	PROFILE_COUNT(setContentUpdates, 1);
 	m_wrappedText.setString(content);
-	m_wrappedText.setOrigin(computeNewOrigin(m_wrappedText.getLocalBounds(), m_alignment));
+	setOriginFromLayout();
 }
 
 bool TextWrapper::setFont(std::string_view name) noexcept
 {
-	sf::Font* font{ getFont(name) };
+	const auto mapIterator{ m_registry->accessToFonts.find(name) };
 
-	if (!font)
+	if (mapIterator == m_registry->accessToFonts.end())
 		return false;
 
-	m_wrappedText.setFont(*font);
+	std::lock_guard lock{ m_registry->mutex };
+	untrackCharacterSize(*m_registry, m_fontKey, m_wrappedText.getCharacterSize());
+	m_fontKey = mapIterator->second;
+	m_wrappedText.setFont(m_registry->allFonts[m_fontKey].font);
+	trackCharacterSize(*m_registry, m_fontKey, m_wrappedText.getCharacterSize(), 1);
+	markModified();
 	return true;
 }
 
 void TextWrapper::setCharacterSize(unsigned int size) noexcept
 {
+	{
+		std::lock_guard lock{ m_registry->mutex };
+		untrackCharacterSize(*m_registry, m_fontKey, m_wrappedText.getCharacterSize());
+		trackCharacterSize(*m_registry, m_fontKey, size, 1);
+	}
+
 	m_wrappedText.setCharacterSize(size);
-	m_wrappedText.setOrigin(computeNewOrigin(m_wrappedText.getLocalBounds(), m_alignment));
+	setOriginFromLayout();
 }
 
 void TextWrapper::setColor(sf::Color color) noexcept
 {
 	m_wrappedText.setFillColor(color);
+	markModified();
 }
 
 void TextWrapper::setStyle(std::uint32_t style) noexcept
 {
 	m_wrappedText.setStyle(style);
+	markModified();
 }
 
 void TextWrapper::setAlignment(Alignment alignment) noexcept
 {
 	m_alignment = alignment;
-	m_wrappedText.setOrigin(computeNewOrigin(m_wrappedText.getLocalBounds(), m_alignment));
+	setOriginFromLayout();
+}
+
+std::uint32_t TextWrapper::getFontGeneration() noexcept
+{
+	return currentRegistry().fontGeneration;
 }
 
 void TextWrapper::createFont(std::string name, std::string_view fileName)
@@ -165,41 +268,214 @@ void TextWrapper::createFont(std::string name, std::string_view fileName)
 	createFont(std::move(name), std::move(optFont.value()));
 }
 
+void TextWrapper::createFont(std::string name, std::shared_ptr<const AssetPack> pack, std::string_view entryName)
+{
+	ENSURE_VALID_PTR(pack, "The pack was nullptr when the function createFont of TextWrapper was called");
+	if (getFont(name) != nullptr)
+		return;
+
+	std::ostringstream errorMessage{};
+	auto optFont{ pack->openFont(errorMessage, entryName) };
+	if (!optFont.has_value()) [[unlikely]]
+		throw LoadingGraphicalResourceFailure{ errorMessage.str() };
+
+	FontRegistry& registry{ currentRegistry() };
+	sf::Font pristine{ optFont.value() };
+	const auto key{ registry.allFonts.emplace(FontHolder{ std::move(pack), std::move(optFont.value()), std::move(pristine), {}, std::numeric_limits<size_t>::max(), ++registry.nbOfCreatedFonts }) }; // The font reads the memory of the pack.
+	registry.accessToFonts.try_emplace(std::move(name), key);
+}
+
 void TextWrapper::createFont(std::string name, sf::Font font) noexcept
 {
+	FontRegistry& registry{ currentRegistry() };
 	if (getFont(name) != nullptr)
 		return;
 
-	// We add the font using push_front so we know that it is at the beginning.
-	// Therefore, using the function begin() we have a direct iterator pointing to it.
-	s_allFonts.push_front(std::move(font));
-	s_accessToFonts.insert(std::make_pair(std::move(name), s_allFonts.begin()));
+	sf::Font pristine{ font };
+	const auto key{ registry.allFonts.emplace(FontHolder{ nullptr, std::move(font), std::move(pristine), {}, std::numeric_limits<size_t>::max(), ++registry.nbOfCreatedFonts }) };
+	registry.accessToFonts.try_emplace(std::move(name), key);
 }
 
 void TextWrapper::removeFont(std::string_view name) noexcept
 {
-	const auto mapIterator{ s_accessToFonts.find(name) };
+	FontRegistry& registry{ currentRegistry() };
+	const auto mapIterator{ registry.accessToFonts.find(name) };
 
-	if (mapIterator == s_accessToFonts.end())
+	if (mapIterator == registry.accessToFonts.end())
 		return;
 
-	s_allFonts.erase(mapIterator->second); // First, removing the actual font.
-	s_accessToFonts.erase(mapIterator); // Then, the accessing item within the map.
+	registry.namesOfFonts.erase(&registry.allFonts[mapIterator->second].font);
+	registry.allFonts.erase(mapIterator->second); // First, removing the actual font.
+	registry.accessToFonts.erase(mapIterator); // Then, the accessing item within the map.
+	++registry.fontGeneration; // Another font may be created at the same address.
 }
 
 sf::Font* TextWrapper::getFont(std::string_view name) noexcept
 {
-	const auto mapIterator{ s_accessToFonts.find(name) };
+	FontRegistry& registry{ currentRegistry() };
+	const auto mapIterator{ registry.accessToFonts.find(name) };
 
-	if (mapIterator == s_accessToFonts.end()) [[unlikely]]
+	if (mapIterator == registry.accessToFonts.end()) [[unlikely]]
 		return nullptr;
 
-	return &*mapIterator->second;
+	return &registry.allFonts[mapIterator->second].font;
+}
+
+std::optional<std::pair<std::string_view, std::uint64_t>> TextWrapper::findFont(const sf::Font* font) noexcept
+{
+	FontRegistry& registry{ currentRegistry() };
+
+	// The font may have been removed since, and another one created at the same address.
+	if (const auto cached{ registry.namesOfFonts.find(font) }; cached != registry.namesOfFonts.end()) [[likely]]
+		if (const FontHolder* const holder{ registry.allFonts.get(cached->second.second) }; holder != nullptr && &holder->font == font)
+			return std::pair<std::string_view, std::uint64_t>{ cached->second.first, holder->generation };
+
+	for (const auto& [name, key] : registry.accessToFonts)
+	{
+		const FontHolder& holder{ registry.allFonts[key] };
+		if (&holder.font != font)
+			continue;
+
+		const auto cached{ registry.namesOfFonts.insert_or_assign(font, std::pair<std::string, SlotMap<FontHolder>::Key>{ name, key }).first };
+		return std::pair<std::string_view, std::uint64_t>{ cached->second.first, holder.generation };
+	}
+
+	return std::nullopt;
+}
+
+bool TextWrapper::warmUpFont(std::string_view name, const std::vector<unsigned int>& characterSizes, std::u32string_view charset, bool bold) noexcept
+{
+	FontRegistry& registry{ currentRegistry() };
+	const auto mapIterator{ registry.accessToFonts.find(name) };
+
+	if (mapIterator == registry.accessToFonts.end())
+		return false;
+
+	std::lock_guard lock{ registry.mutex };
+	for (const unsigned int characterSize : characterSizes)
+	{
+		trackCharacterSize(registry, mapIterator->second, characterSize, 0);
+
+		const sf::Font& font{ registry.allFonts[mapIterator->second].font };
+		for (const char32_t character : charset)
+			(void)font.getGlyph(character, characterSize, bold); // Loads the glyph into the page of its size.
+	}
+
+	return true;
+}
+
+size_t TextWrapper::getFontMemoryUsage(std::string_view name) noexcept
+{
+	FontRegistry& registry{ currentRegistry() };
+	const auto mapIterator{ registry.accessToFonts.find(name) };
+
+	if (mapIterator == registry.accessToFonts.end())
+		return 0;
+
+	std::lock_guard lock{ registry.mutex };
+	return computePagesMemory(registry.allFonts[mapIterator->second]);
+}
+
+void TextWrapper::setFontMemoryBudget(std::string_view name, size_t budget) noexcept
+{
+	FontRegistry& registry{ currentRegistry() };
+	const auto mapIterator{ registry.accessToFonts.find(name) };
+
+	if (mapIterator == registry.accessToFonts.end())
+		return;
+
+	std::lock_guard lock{ registry.mutex };
+	FontHolder& holder{ registry.allFonts[mapIterator->second] };
+	holder.memoryBudget = budget;
+
+	if (computePagesMemory(holder) > budget)
+		releasePages(registry, holder);
+}
+
+TextWrapper::FontRegistry& TextWrapper::currentRegistry() noexcept
+{
+	return ResourceContext::current().m_fonts;
+}
+
+void TextWrapper::trackCharacterSize(FontRegistry& registry, SlotMap<FontHolder>::Key font, unsigned int characterSize, size_t nbOfTexts) noexcept
+{
+	FontHolder* const holder{ registry.allFonts.get(font) };
+
+	if (holder == nullptr) [[unlikely]]
+		return; // Not registered, e.g. the default font of the constructor.
+
+	// The new text lays out its glyphs, and warming up rasterizes them: the page exists from now on.
+	const auto size{ std::find_if(holder->characterSizes.begin(), holder->characterSizes.end(), [characterSize](const CharacterSize& x) { return x.size == characterSize; }) };
+	if (size != holder->characterSizes.end()) [[likely]]
+	{
+		size->nbOfTexts += nbOfTexts;
+		size->hasPage = true;
+		return;
+	}
+
+	// A new size gets a new page: if the pages already exceed the budget, all of them are released
+	// first, and the glyphs of the sizes still in use are rasterized again when drawn.
+	if (holder->memoryBudget != std::numeric_limits<size_t>::max() && computePagesMemory(*holder) > holder->memoryBudget)
+		releasePages(registry, *holder);
+
+	holder->characterSizes.push_back(CharacterSize{ characterSize, nbOfTexts, true });
+}
+
+void TextWrapper::setOriginFromLayout() noexcept
+{
+	{
+		std::lock_guard lock{ m_registry->mutex };
+		m_wrappedText.setOrigin(computeNewOrigin(m_wrappedText.getLocalBounds(), m_alignment));
+	}
+
+	markModified();
+}
+
+void TextWrapper::untrackCharacterSize(FontRegistry& registry, SlotMap<FontHolder>::Key font, unsigned int characterSize) noexcept
+{
+	FontHolder* const holder{ registry.allFonts.get(font) };
+
+	if (holder == nullptr) [[unlikely]]
+		return; // Not registered, or removed since.
+
+	const auto size{ std::find_if(holder->characterSizes.begin(), holder->characterSizes.end(), [characterSize](const CharacterSize& x) { return x.size == characterSize; }) };
+	if (size != holder->characterSizes.end() && size->nbOfTexts > 0) [[likely]]
+		--size->nbOfTexts;
+}
+
+size_t TextWrapper::computePagesMemory(const FontHolder& holder) noexcept
+{
+	size_t memory{ 0 };
+
+	for (const CharacterSize& characterSize : holder.characterSizes)
+	{
+		if (!characterSize.hasPage)
+			continue; // `getTexture` would create the page.
+
+		const sf::Vector2u size{ holder.font.getTexture(characterSize.size).getSize() };
+		memory += static_cast<size_t>(size.x) * size.y * 4;
+	}
+
+	return memory;
+}
+
+void TextWrapper::releasePages(FontRegistry& registry, FontHolder& holder) noexcept
+{
+	// Texts keep a pointer to the font, which stays the same. They detect the new page textures and
+	// rasterize their glyphs again when drawn.
+	holder.font = holder.pristine;
+	std::erase_if(holder.characterSizes, [](const CharacterSize& size) { return size.nbOfTexts == 0; }); // Only the warmed up sizes, and those no text uses anymore.
+	for (CharacterSize& size : holder.characterSizes)
+		size.hasPage = false; // Until a text of this size is created or resized: texts that are never drawn again do not rasterize it.
+	++registry.fontGeneration;
 }
 
 
 std::optional<sf::Font> loadFontFromFile(std::ostringstream& errorMessage, std::string_view fileName, std::string_view path) noexcept
 {
+	PROFILE_SCOPE(fontLoadTime);
+	PROFILE_COUNT(fontLoads, 1);
+
 	try
 	{
 		sf::Font font{};
@@ -231,7 +507,11 @@ std::optional<sf::Font> loadFontFromFile(std::ostringstream& errorMessage, std::
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 SpriteWrapper::SpriteWrapper(std::string_view textureName, sf::Vector2f pos, sf::Vector2f scale, sf::IntRect rect, sf::Angle rot, Alignment alignment, sf::Color color)
-	: TransformableWrapper{}, m_wrappedSprite{ s_defaultTexture }, m_curTextureIndex{ 0 }, m_textures{}, m_uniqueTextures{}
+	: SpriteWrapper{ std::allocator_arg, allocator_type{}, textureName, pos, scale, rect, rot, alignment, color }
+{}
+
+SpriteWrapper::SpriteWrapper(std::allocator_arg_t, const allocator_type& allocator, std::string_view textureName, sf::Vector2f pos, sf::Vector2f scale, sf::IntRect rect, sf::Angle rot, Alignment alignment, sf::Color color)
+	: TransformableWrapper{}, m_wrappedSprite{ s_defaultTexture }, m_curTextureIndex{ 0 }, m_textures{ allocator }, m_uniqueTextures{ allocator }, m_awaitedTexture{ nullptr }, m_displayedTexture{ nullptr }, m_registry{ &currentRegistry() }
 {
 	create(&m_wrappedSprite, pos, scale, rot, alignment);
 
@@ -244,10 +524,15 @@ SpriteWrapper::SpriteWrapper(std::string_view textureName, sf::Vector2f pos, sf:
 }
 
 SpriteWrapper::SpriteWrapper(SpriteWrapper&& other) noexcept
-	: TransformableWrapper{}, m_wrappedSprite{ std::move(other.m_wrappedSprite) }, m_curTextureIndex{ other.m_curTextureIndex }, m_textures{ std::move(other.m_textures) }, m_uniqueTextures{ std::move(other.m_uniqueTextures) }
+	: SpriteWrapper{ std::move(other), other.m_textures.get_allocator() }
+{}
+
+SpriteWrapper::SpriteWrapper(SpriteWrapper&& other, const allocator_type& allocator) noexcept
+	: TransformableWrapper{}, m_wrappedSprite{ std::move(other.m_wrappedSprite) }, m_curTextureIndex{ other.m_curTextureIndex }, m_textures{ std::move(other.m_textures), allocator }, m_uniqueTextures{ std::move(other.m_uniqueTextures), allocator }, m_awaitedTexture{ std::exchange(other.m_awaitedTexture, nullptr) }, m_displayedTexture{ std::exchange(other.m_displayedTexture, nullptr) }, m_registry{ other.m_registry }
 {
 	std::swap(this->m_alignment, other.m_alignment);
 	std::swap(this->hide,		 other.hide);
+	replaceAwaitingSprite(*m_registry, m_awaitedTexture, &other, this);
 
 	other.m_transformable = nullptr; // The default move constructor would not handle the base pointer correctly.
 	this->m_transformable = &m_wrappedSprite;
@@ -261,25 +546,40 @@ SpriteWrapper& SpriteWrapper::operator=(SpriteWrapper&& other) noexcept
 	std::swap(this->m_uniqueTextures,  other.m_uniqueTextures);
 	std::swap(this->m_alignment,	   other.m_alignment);
 	std::swap(this->hide,			   other.hide);
+	std::swap(this->m_awaitedTexture,  other.m_awaitedTexture);
+	std::swap(this->m_displayedTexture, other.m_displayedTexture);
+	std::swap(this->m_registry,		   other.m_registry);
+	replaceAwaitingSprite(*this->m_registry, this->m_awaitedTexture, &other, this);
+	replaceAwaitingSprite(*other.m_registry, other.m_awaitedTexture, this, &other);
 
 	other.m_transformable = &other.m_wrappedSprite; // The default move assignment would not handle the base pointer correctly.
 	this->m_transformable = &m_wrappedSprite;
+	this->markModified();
+	other.markModified();
 
 	return *this;
 }
 
 SpriteWrapper::~SpriteWrapper() noexcept
 {
+	awaitTexture(nullptr);
+	displayTexture(nullptr);
+	for (const TextureInfo& textureInfo : m_textures)
+		--textureInfo.texture->references;
+
 	for (auto& reservedTexture : m_uniqueTextures)
 	{
-		auto mapAccessIterator{ s_accessToTextures.find(reservedTexture) };
+		auto mapAccessIterator{ m_registry->accessToTextures.find(reservedTexture) };
+		TextureHolder& holder{ m_registry->allTextures[mapAccessIterator->second] };
+		cancelStreaming(*m_registry, &holder);
 #ifndef NDEBUG
-		s_allUniqueTextures.erase(&*mapAccessIterator->second); // Remove the texture from the reserved map.
+		m_registry->allUniqueTextures.erase(&holder); // Remove the texture from the reserved map.
 #endif //NDEBUG
-		mapAccessIterator->second->actualTexture.reset(); // Free the actual texture memory.
-		mapAccessIterator->second->fileName.clear(); // as well as the path
-		s_allTextures.erase(mapAccessIterator->second); // Remove the actual texture from the list.
-		s_accessToTextures.erase(mapAccessIterator); // Remove the access toward the texture from the access map.
+		holder.actualTexture.reset(); // Free the actual texture memory.
+		holder.fileName.clear(); // as well as the path
+		holder.pack.reset();
+		m_registry->allTextures.erase(mapAccessIterator->second); // Remove the actual texture from the store.
+		m_registry->accessToTextures.erase(mapAccessIterator); // Remove the access toward the texture from the access map.
 	}
 
 	m_textures.clear();
@@ -289,12 +589,14 @@ SpriteWrapper::~SpriteWrapper() noexcept
 void SpriteWrapper::setColor(sf::Color color) noexcept
 {
 	m_wrappedSprite.setColor(color);
+	markModified();
 }
 
 void SpriteWrapper::setAlignment(Alignment alignment) noexcept
 {
 	m_alignment = alignment;
 	m_wrappedSprite.setOrigin(computeNewOrigin(m_wrappedSprite.getLocalBounds(), m_alignment));
+	markModified();
 }
 
 void SpriteWrapper::switchToNextTexture(long long indexOffset)
@@ -303,46 +605,73 @@ void SpriteWrapper::switchToNextTexture(long long indexOffset)
 	const long long totalIndex{ static_cast<long long>(m_curTextureIndex) + indexOffset };
 	const size_t textureSize{ m_textures.size() };
 	m_curTextureIndex = ((totalIndex % textureSize) + textureSize) % textureSize; // Correctly handle negative indices and wrap around.
-	
+
+	std::lock_guard lock{ m_registry->mutex }; // The textures are shared with the sprites animated by other threads.
+	applyCurrentTexture();
+}
+
+void SpriteWrapper::switchToTexture(size_t index)
+{
+	ENSURE_NOT_OUT_OF_RANGE(index, m_textures.size(), "Precondition violated; index is out of range for the texture vector in the function switchToTexture of SpriteWrapper");
+
+	if (index == m_curTextureIndex)
+		return;
+
+	m_curTextureIndex = index; 
+
+	std::lock_guard lock{ m_registry->mutex };
+	applyCurrentTexture();
+}
+
+void SpriteWrapper::applyCurrentTexture()
+{
 	TextureInfo& textureInfo{ m_textures[m_curTextureIndex] };
 	ENSURE_VALID_PTR(textureInfo.texture, "A textureHolder within a TextureInfo was nullptr somehow when the switchToNextTexture function was called in SpriteWrapper");
-	std::unique_ptr<sf::Texture>& newTexture{ textureInfo.texture->actualTexture }; // From texture holder
+	TextureHolder& holder{ *textureInfo.texture };
 
-	if (newTexture == nullptr) [[unlikely]]
+	if (holder.actualTexture == nullptr && holder.atlasPage == nullptr && m_registry->streamingTickets.contains(&holder)) [[unlikely]]
+	{	// Being decoded in the background: the previous texture is kept until this one is uploaded.
+		awaitTexture(&holder);
+		return;
+	}
+	awaitTexture(nullptr); // A texture the sprite was waiting for is no longer wanted.
+
+	if (holder.actualTexture == nullptr && holder.atlasPage == nullptr) [[unlikely]]
 	{	// Not loaded yet, so we need to load it first.
 		std::ostringstream errorMessage{};
-		auto optTexture{ loadTextureFromFile(errorMessage, textureInfo.texture->fileName) };
+		auto optTexture{ loadHolderTexture(errorMessage, holder) };
 		
 		if (!optTexture.has_value()) [[unlikely]]
 			throw LoadingGraphicalResourceFailure{ errorMessage.str() };
 
-		newTexture = std::make_unique<sf::Texture>(std::move(optTexture.value()));
+		holder.actualTexture = std::make_unique<sf::Texture>(std::move(optTexture.value()));
+		onTextureLoaded(*m_registry, holder);
 	}	
 	
-	if (textureInfo.displayedTexturePart == sf::IntRect{}) [[unlikely]] // If rect is 0,0 then the rect should cover the whole texture.
-		textureInfo.displayedTexturePart.size = static_cast<sf::Vector2i>(newTexture->getSize());
+	const bool isPacked{ holder.atlasPage != nullptr };
+	const sf::Texture& newTexture{ isPacked ? *holder.atlasPage : *holder.actualTexture };
 
-	m_wrappedSprite.setTextureRect(textureInfo.displayedTexturePart);
-	m_wrappedSprite.setTexture(*newTexture);
-}
+	if (textureInfo.displayedTexturePart == sf::IntRect{}) [[unlikely]] // If rect is 0,0 then the rect should cover the whole texture.
+		textureInfo.displayedTexturePart.size = isPacked ? holder.atlasRect.size : static_cast<sf::Vector2i>(newTexture.getSize());
 
-void SpriteWrapper::switchToTexture(size_t index)
-{
-	ENSURE_NOT_OUT_OF_RANGE(index, m_textures.size(), "Precondition violated; index is out of range for the texture vector in the function switchToTexture of SpriteWrapper");
+	sf::IntRect displayedPart{ textureInfo.displayedTexturePart };
+	displayedPart.position += holder.atlasRect.position; // Relative to the page if packed, otherwise the offset is 0.
 
-	if (index == m_curTextureIndex)
-		return;
+	m_wrappedSprite.setTextureRect(displayedPart);
+	if (&m_wrappedSprite.getTexture() != &newTexture) // Frames within the same texture or atlas page only change the rect.
+		m_wrappedSprite.setTexture(newTexture);
 
-	m_curTextureIndex = index; 
-	switchToNextTexture(0);
+	displayTexture(&holder);
+	markModified();
 }
 
 void SpriteWrapper::createTexture(std::string name, std::string fileName, Reserved shared, bool loadImmediately)
 {
+	TextureRegistry& registry{ currentRegistry() };
 	if (getTexture(name) != nullptr)
 		return;
 
-	TextureHolder newTexture{ .fileName = std::move(fileName) };
+	TextureHolder newTexture{ .fileName = std::move(fileName), .reserved = (shared == Reserved::Yes) };
 	newTexture.actualTexture = nullptr;
 
 	if (loadImmediately)
@@ -354,94 +683,187 @@ void SpriteWrapper::createTexture(std::string name, std::string fileName, Reserv
 			throw LoadingGraphicalResourceFailure{ errorMessage.str() };
 		else
 			newTexture.actualTexture = std::make_unique<sf::Texture>(std::move(optTexture.value()));
+
+		packIntoAtlas(registry, newTexture);
 	}
 
-	// We add the font using push_front so we know that it is at the beginning.
-	// Therefore, using the function begin() we have a direct iterator pointing to it.
-	s_allTextures.push_front(std::move(newTexture));
-	s_accessToTextures.insert(std::make_pair(std::move(name), s_allTextures.begin()));
+	registerTexture(registry, std::move(name), std::move(newTexture));
+}
 
-#ifndef NDEBUG
-	if (shared == Reserved::Yes)
-		s_allUniqueTextures[&*s_allTextures.begin()] = false;
-#else //NDEBUG
-	if (shared == Reserved::Yes)
-		s_allUniqueTextures.insert(&*s_allTextures.begin());
-#endif //NDEBUG
+void SpriteWrapper::createTexture(std::string name, std::shared_ptr<const AssetPack> pack, std::string entryName, Reserved shared, bool loadImmediately)
+{
+	ENSURE_VALID_PTR(pack, "The pack was nullptr when the function createTexture of SpriteWrapper was called");
+	TextureRegistry& registry{ currentRegistry() };
+	if (getTexture(name) != nullptr)
+		return;
+
+	TextureHolder newTexture{ .fileName = std::move(entryName), .pack = std::move(pack), .reserved = (shared == Reserved::Yes) };
+
+	if (loadImmediately)
+	{
+		std::ostringstream errorMessage{};
+		auto optTexture{ loadHolderTexture(errorMessage, newTexture) };
+
+		if (!optTexture.has_value()) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ errorMessage.str() };
+
+		newTexture.actualTexture = std::make_unique<sf::Texture>(std::move(optTexture.value()));
+		packIntoAtlas(registry, newTexture);
+	}
+
+	registerTexture(registry, std::move(name), std::move(newTexture));
 }
 
 void SpriteWrapper::createTexture(std::string name, sf::Texture texture, Reserved shared) noexcept
 {	
+	TextureRegistry& registry{ currentRegistry() };
+	if (getTexture(name) != nullptr)
+		return;
+
+	TextureHolder& holder{ registerTexture(registry, std::move(name), TextureHolder{ .reserved = (shared == Reserved::Yes) }) }; // No file name provided so it is never reloaded.
+	holder.actualTexture = std::make_unique<sf::Texture>(std::move(texture)); // The texture is added.
+	packIntoAtlas(registry, holder);
+}
+
+void SpriteWrapper::createTexture(std::string name, const sf::RenderTexture& rendered, Reserved shared) noexcept
+{
+	TextureRegistry& registry{ currentRegistry() };
 	if (getTexture(name) != nullptr)
 		return;
 
-	createTexture(std::move(name), "", shared, false); // No file name provided so do not load it. 
-	s_allTextures.front().actualTexture = std::make_unique<sf::Texture>(std::move(texture)); // The texture is added.
+	TextureHolder& holder{ registerTexture(registry, std::move(name), TextureHolder{ .reserved = (shared == Reserved::Yes) }) }; // No file name provided so it is never reloaded.
+	const sf::Texture& renderedTexture{ rendered.getTexture() };
+
+	if (registry.isAtlasEnabled && !holder.reserved && !renderedTexture.isRepeated() && registry.atlas.canHold(renderedTexture.getSize()))
+	{	// The render texture is copied into the page directly, rather than into a texture that would be copied again.
+		const auto region{ registry.atlas.insert(renderedTexture) };
+		if (region.has_value()) [[likely]]
+		{
+			holder.atlasPage = region->page; // Pages are always smooth.
+			holder.atlasRect = region->rect;
+			return;
+		}
+	}
+
+	holder.actualTexture = std::make_unique<sf::Texture>(renderedTexture);
+	holder.actualTexture->setSmooth(true);
+}
+
+SpriteWrapper::TextureRegistry& SpriteWrapper::currentRegistry() noexcept
+{
+	return ResourceContext::current().m_textures;
+}
+
+std::optional<sf::Texture> SpriteWrapper::loadHolderTexture(std::ostringstream& errorMessage, const TextureHolder& holder) noexcept
+{
+	if (holder.pack != nullptr)
+		return holder.pack->loadTexture(errorMessage, holder.fileName);
+
+	return loadTextureFromFile(errorMessage, holder.fileName);
+}
+
+SpriteWrapper::TextureHolder& SpriteWrapper::registerTexture(TextureRegistry& registry, std::string name, TextureHolder holder) noexcept
+{
+	const bool isReserved{ holder.reserved };
+	holder.generation = ++registry.nbOfCreatedTextures;
+	const auto key{ registry.allTextures.emplace(std::move(holder)) };
+	registry.accessToTextures.try_emplace(std::move(name), key);
+	TextureHolder& texture{ registry.allTextures[key] };
+
+#ifndef NDEBUG
+	if (isReserved)
+		registry.allUniqueTextures[&texture] = false;
+#else //NDEBUG
+	if (isReserved)
+		registry.allUniqueTextures.insert(&texture);
+#endif //NDEBUG
+
+	return texture;
 }
 
 void SpriteWrapper::removeTexture(std::string_view name) noexcept
 {
-	auto mapIterator{ s_accessToTextures.find(name) };
+	TextureRegistry& registry{ currentRegistry() };
+	auto mapIterator{ registry.accessToTextures.find(name) };
 
-	if (mapIterator == s_accessToTextures.end())
+	if (mapIterator == registry.accessToTextures.end())
 		return;
 	
-	assert(s_allUniqueTextures.find(&*mapIterator->second) == s_allUniqueTextures.end() && "Precondition violated: a reserved texture cannot be removed using the removeTexture function of SpriteWrapper");
-
-	mapIterator->second->actualTexture.reset(); // Free the actual texture memory.
-	mapIterator->second->fileName.clear(); // as well as the path.
-	s_allTextures.erase(mapIterator->second); // First, removing the actual texture.
-	s_accessToTextures.erase(mapIterator); // Then, the accessing item within the map.
+	TextureHolder& holder{ registry.allTextures[mapIterator->second] };
+	assert(registry.allUniqueTextures.find(&holder) == registry.allUniqueTextures.end() && "Precondition violated: a reserved texture cannot be removed using the removeTexture function of SpriteWrapper");
+
+	if (holder.atlasPage != nullptr)
+		registry.atlas.release(holder.atlasPage); // The page is freed if it was its last texture.
+	cancelStreaming(registry, &holder); // A late background result must not be used.
+
+	holder.actualTexture.reset(); // Free the actual texture memory.
+	holder.fileName.clear(); // as well as the path.
+	holder.pack.reset();
+	std::erase_if(registry.namesOfTextures, [key = mapIterator->second](const auto& name) { return name.second.second == key; }); // Others are checked when found.
+	registry.allTextures.erase(mapIterator->second); // First, removing the actual texture.
+	registry.accessToTextures.erase(mapIterator); // Then, the accessing item within the map.
 }
 
 sf::Texture* SpriteWrapper::getTexture(std::string_view name) noexcept
 {
-	auto mapIterator{ s_accessToTextures.find(name) };
+	TextureRegistry& registry{ currentRegistry() };
+	auto mapIterator{ registry.accessToTextures.find(name) };
 
-	if (mapIterator == s_accessToTextures.end())
+	if (mapIterator == registry.accessToTextures.end())
 		return nullptr;
 
-	return mapIterator->second->actualTexture.get();
+	const TextureHolder& holder{ registry.allTextures[mapIterator->second] };
+	if (holder.atlasPage != nullptr)
+		return holder.atlasPage;
+
+	return holder.actualTexture.get();
 }
 
 bool SpriteWrapper::loadTexture(std::string_view name, bool failingImpliesRemoval)
 {
-	auto mapIterator{ s_accessToTextures.find(name) };
+	TextureRegistry& registry{ currentRegistry() };
+	auto mapIterator{ registry.accessToTextures.find(name) };
 
-	if (mapIterator == s_accessToTextures.end())
+	if (mapIterator == registry.accessToTextures.end())
 		return false;
 
-	TextureHolder* textureHolder{ &*mapIterator->second };
+	TextureHolder* textureHolder{ &registry.allTextures[mapIterator->second] };
 	
-	if (textureHolder->actualTexture != nullptr)
+	if (textureHolder->actualTexture != nullptr || textureHolder->atlasPage != nullptr)
 		return true; // Already loaded.
 	// Texture with no path are always loaded.
 
 	std::ostringstream errorMessage{};
-	auto optTexture{ loadTextureFromFile(errorMessage, textureHolder->fileName) };
+	auto optTexture{ loadHolderTexture(errorMessage, *textureHolder) };
 	if (!optTexture.has_value()) [[unlikely]]
 	{
-		if (failingImpliesRemoval && s_allUniqueTextures.find(&*mapIterator->second) == s_allUniqueTextures.end()) 
+		if (failingImpliesRemoval && registry.allUniqueTextures.find(textureHolder) == registry.allUniqueTextures.end()) 
 			removeTexture(name);
 
 		throw LoadingGraphicalResourceFailure{ errorMessage.str() };
 	}
 
 	textureHolder->actualTexture = std::make_unique<sf::Texture>(std::move(optTexture.value()));
+	onTextureLoaded(registry, *textureHolder);
 	return true;
 }
 
 bool SpriteWrapper::unloadTexture(std::string_view name) noexcept
 {
-	auto mapIterator{ s_accessToTextures.find(name) };
+	TextureRegistry& registry{ currentRegistry() };
+	auto mapIterator{ registry.accessToTextures.find(name) };
 
-	if (mapIterator == s_accessToTextures.end())
+	if (mapIterator == registry.accessToTextures.end())
 		return false;
 
-	TextureHolder* textureHolder{ &*mapIterator->second };
+	TextureHolder* textureHolder{ &registry.allTextures[mapIterator->second] };
 	
 	if (textureHolder->fileName == "")
 		return false; // TextureHolder was not found or no file name provided: loading would be impossible afterwards.
+	if (textureHolder->atlasPage != nullptr)
+		return false; // Packed textures share their page with others, it can't be freed.
+
+	cancelStreaming(registry, textureHolder);
 	if (textureHolder->actualTexture == nullptr)
 		return true; // Already unloaded.
 
@@ -449,9 +871,410 @@ bool SpriteWrapper::unloadTexture(std::string_view name) noexcept
 	return true;
 }
 
+void SpriteWrapper::enableAtlas(bool enable, unsigned int pageSize, unsigned int padding) noexcept
+{
+	TextureRegistry& registry{ currentRegistry() };
+	registry.isAtlasEnabled = enable;
+	registry.atlas.setPageLayout(pageSize, padding);
+}
+
+bool SpriteWrapper::packIntoAtlas(TextureRegistry& registry, TextureHolder& holder) noexcept
+{
+	if (!registry.isAtlasEnabled || holder.reserved || holder.actualTexture == nullptr)
+		return false;
+
+	const sf::Texture& texture{ *holder.actualTexture };
+	if (!texture.isSmooth() || texture.isRepeated() || !registry.atlas.canHold(texture.getSize()))
+		return false; // The page would change how the texture is displayed, or it would waste too much space.
+
+	const auto region{ registry.atlas.insert(texture) };
+	if (!region.has_value()) [[unlikely]]
+		return false;
+
+	holder.atlasPage = region->page;
+	holder.atlasRect = region->rect;
+	holder.actualTexture.reset(); // The copy within the page is used instead.
+	return true;
+}
+
+bool SpriteWrapper::loadTextureAsync(std::string_view name) noexcept
+{
+	TextureRegistry& registry{ currentRegistry() };
+	auto mapIterator{ registry.accessToTextures.find(name) };
+
+	if (mapIterator == registry.accessToTextures.end())
+		return false;
+
+	return requestStreaming(registry, registry.allTextures[mapIterator->second]);
+}
+
+size_t SpriteWrapper::uploadStreamedTextures(size_t byteBudget) noexcept
+{
+	TextureRegistry& registry{ currentRegistry() };
+	size_t nbOfUploads{ 0 };
+	size_t uploadedBytes{ 0 };
+
+	StreamedImages& streamedImages{ *registry.streamedImages };
+
+	while (true)
+	{
+		StreamedImage streamed{};
+
+		{
+			std::lock_guard lock{ streamedImages.mutex };
+			if (streamedImages.images.empty())
+				break;
+
+			const std::optional<sf::Image>& image{ streamedImages.images.front().image };
+			const size_t nbOfBytes{ image.has_value() ? static_cast<size_t>(image->getSize().x) * image->getSize().y * 4 : 0 };
+			if (uploadedBytes != 0 && uploadedBytes + nbOfBytes > byteBudget)
+				break; // The remaining ones are uploaded during the next frames.
+
+			streamed = std::move(streamedImages.images.front());
+			streamedImages.images.pop_front();
+			uploadedBytes += nbOfBytes;
+		}
+
+		const auto ticket{ registry.streamingTickets.find(streamed.holder) };
+		if (ticket == registry.streamingTickets.end() || ticket->second != streamed.ticket) [[unlikely]]
+			continue; // Removed, unloaded or loaded synchronously in the meantime.
+
+		TextureHolder& holder{ *streamed.holder };
+		sf::Texture texture{};
+		{
+			PROFILE_SCOPE(textureUploadTime);
+			if (!streamed.image.has_value() || !texture.loadFromImage(streamed.image.value())) [[unlikely]]
+			{	// The error is reported by the next synchronous loading.
+				registry.nbOfPreloadFailures += registry.preloadingTextures.contains(&holder);
+				cancelStreaming(registry, &holder);
+				continue;
+			}
+		}
+
+		texture.setSmooth(true);
+		holder.actualTexture = std::make_unique<sf::Texture>(std::move(texture));
+		onTextureLoaded(registry, holder);
+		++nbOfUploads;
+		PROFILE_COUNT(textureUploads, 1);
+		PROFILE_COUNT(textureUploadBytes, static_cast<size_t>(holder.actualTexture->getSize().x) * holder.actualTexture->getSize().y * 4);
+	}
+
+	return nbOfUploads;
+}
+
+size_t SpriteWrapper::preloadAll() noexcept
+{
+	TextureRegistry& registry{ currentRegistry() };
+	size_t nbOfRequests{ 0 };
+
+	for (TextureHolder& holder : registry.allTextures)
+		nbOfRequests += requestPreloading(registry, holder);
+
+	return nbOfRequests;
+}
+
+size_t SpriteWrapper::preload(std::span<const std::string_view> names) noexcept
+{
+	TextureRegistry& registry{ currentRegistry() };
+	size_t nbOfRequests{ 0 };
+
+	for (const std::string_view name : names)
+		if (const auto mapIterator{ registry.accessToTextures.find(name) }; mapIterator != registry.accessToTextures.end())
+			nbOfRequests += requestPreloading(registry, registry.allTextures[mapIterator->second]);
+
+	return nbOfRequests;
+}
+
+SpriteWrapper::PreloadProgress SpriteWrapper::getPreloadProgress() noexcept
+{
+	const TextureRegistry& registry{ currentRegistry() };
+	return PreloadProgress{ registry.nbOfPreloadedTextures, registry.nbOfPreloadedTextures - registry.preloadingTextures.size(), registry.nbOfPreloadFailures };
+}
+
+SpriteWrapper::PreloadProgress SpriteWrapper::finishPreloading(const std::function<void(const PreloadProgress&)>& onProgress) noexcept
+{
+	TextureRegistry& registry{ currentRegistry() };
+	StreamedImages& streamedImages{ *registry.streamedImages };
+
+	// Each preloaded texture is either decoded by a worker, which pushes it and notifies, or was
+	// removed from the preloading ones: the loop always ends.
+	while (!registry.preloadingTextures.empty())
+	{
+		{
+			std::unique_lock lock{ streamedImages.mutex };
+			streamedImages.imageReady.wait(lock, [&streamedImages]() { return !streamedImages.images.empty(); });
+		}
+
+		uploadStreamedTextures(std::numeric_limits<size_t>::max()); // All the textures decoded so far.
+		if (onProgress)
+			onProgress(getPreloadProgress());
+	}
+
+	return getPreloadProgress();
+}
+
+bool SpriteWrapper::requestPreloading(TextureRegistry& registry, TextureHolder& holder) noexcept
+{
+	if (holder.actualTexture != nullptr || holder.atlasPage != nullptr || !requestStreaming(registry, holder))
+		return false; // Already loaded, or without a file.
+
+	if (registry.preloadingTextures.empty())
+	{	// The previous preload is done: a new one starts.
+		registry.nbOfPreloadedTextures = 0;
+		registry.nbOfPreloadFailures = 0;
+	}
+
+	registry.nbOfPreloadedTextures += registry.preloadingTextures.insert(&holder).second;
+	return true;
+}
+
+void SpriteWrapper::prefetchTextures() const noexcept
+{
+	for (const TextureInfo& textureInfo : m_textures)
+		requestStreaming(*m_registry, *textureInfo.texture);
+}
+
+bool SpriteWrapper::requestStreaming(TextureRegistry& registry, TextureHolder& holder) noexcept
+{
+	if (holder.actualTexture != nullptr || holder.atlasPage != nullptr || registry.streamingTickets.contains(&holder))
+		return true; // Already loaded, or being loaded.
+
+	if (holder.fileName.empty())
+		return false;
+
+	const std::uint64_t ticket{ ++registry.lastStreamingTicket };
+	registry.streamingTickets.emplace(&holder, ticket);
+
+	// Only the file name and the pack are copied: the holder must not be accessed from the worker. The
+	// queue is shared, so that it outlives the context if the context is destroyed first.
+	ThreadPool::getShared().submit([holder = &holder, ticket, fileName = holder.fileName, pack = holder.pack, streamedImages = registry.streamedImages]()
+	{
+		std::ostringstream errorMessage{};
+		StreamedImage streamed{ holder, ticket, (pack != nullptr) ? pack->loadImage(errorMessage, fileName) : loadImageFromFile(errorMessage, fileName) };
+
+		{
+			std::lock_guard lock{ streamedImages->mutex };
+			streamedImages->images.push_back(std::move(streamed));
+		}
+		streamedImages->imageReady.notify_one();
+	});
+
+	return true;
+}
+
+void SpriteWrapper::onTextureLoaded(TextureRegistry& registry, TextureHolder& holder) noexcept
+{
+	packIntoAtlas(registry, holder);
+	registry.streamingTickets.erase(&holder); // A background result, if any, is not needed anymore.
+	registry.preloadingTextures.erase(&holder);
+
+	auto awaitingIterator{ registry.spritesAwaitingTexture.find(&holder) };
+	if (awaitingIterator == registry.spritesAwaitingTexture.end())
+		return;
+
+	const std::vector<SpriteWrapper*> sprites{ std::move(awaitingIterator->second) };
+	registry.spritesAwaitingTexture.erase(awaitingIterator);
+	++registry.nbOfTextureUploads; // The cached layers that display these sprites are outdated.
+
+	for (SpriteWrapper* sprite : sprites)
+	{
+		sprite->m_awaitedTexture = nullptr;
+		const bool hadNoTexture{ &sprite->m_wrappedSprite.getTexture() == &s_defaultTexture };
+
+		sprite->applyCurrentTexture(); // Does not throw: the texture is loaded. Possibly called by a sprite that locked the registry already.
+		if (hadNoTexture) 
+			sprite->setAlignment(sprite->m_alignment); // The origin was computed with an empty size.
+	}
+}
+
+void SpriteWrapper::cancelStreaming(TextureRegistry& registry, TextureHolder* holder) noexcept
+{
+	registry.streamingTickets.erase(holder);
+	registry.preloadingTextures.erase(holder); // Done, as far as the preload is concerned.
+
+	auto awaitingIterator{ registry.spritesAwaitingTexture.find(holder) };
+	if (awaitingIterator == registry.spritesAwaitingTexture.end())
+		return;
+
+	for (SpriteWrapper* sprite : awaitingIterator->second)
+		sprite->m_awaitedTexture = nullptr; // They keep their previous texture.
+	registry.spritesAwaitingTexture.erase(awaitingIterator);
+}
+
+void SpriteWrapper::awaitTexture(TextureHolder* holder) noexcept
+{
+	if (m_awaitedTexture == holder) [[likely]]
+		return;
+
+	if (m_awaitedTexture != nullptr)
+	{
+		auto awaitingIterator{ m_registry->spritesAwaitingTexture.find(m_awaitedTexture) };
+		std::vector<SpriteWrapper*>& sprites{ awaitingIterator->second };
+		sprites.erase(std::find(sprites.begin(), sprites.end(), this));
+
+		if (sprites.empty())
+			m_registry->spritesAwaitingTexture.erase(awaitingIterator);
+	}
+
+	m_awaitedTexture = holder;
+	if (holder != nullptr)
+		m_registry->spritesAwaitingTexture[holder].push_back(this);
+}
+
+void SpriteWrapper::replaceAwaitingSprite(TextureRegistry& registry, TextureHolder* holder, const SpriteWrapper* previous, SpriteWrapper* current) noexcept
+{
+	if (holder == nullptr) [[likely]]
+		return;
+
+	std::vector<SpriteWrapper*>& sprites{ registry.spritesAwaitingTexture[holder] };
+	*std::find(sprites.begin(), sprites.end(), previous) = current;
+}
+
+void SpriteWrapper::setTextureBudget(size_t byteBudget) noexcept
+{
+	TextureRegistry& registry{ currentRegistry() };
+	registry.textureBudget = byteBudget;
+}
+
+size_t SpriteWrapper::updateTextureResidency() noexcept
+{
+	TextureRegistry& registry{ currentRegistry() };
+	++registry.currentFrame;
+
+	// Displayed textures are used during this frame.
+	for (TextureHolder& holder : registry.allTextures)
+		if (holder.displayCount != 0)
+			holder.lastUsedFrame = registry.currentFrame;
+
+	if (registry.textureBudget == std::numeric_limits<size_t>::max()) [[likely]]
+		return 0;
+
+	size_t residentBytes{ 0 };
+	for (const TextureHolder& holder : registry.allTextures)
+		residentBytes += computeTextureBytes(holder);
+
+	if (residentBytes <= registry.textureBudget) [[likely]]
+		return 0;
+
+	// Packed textures have no texture of their own, so they are never candidates.
+	std::vector<TextureHolder*> candidates{};
+	for (TextureHolder& holder : registry.allTextures)
+		if (holder.actualTexture != nullptr && !holder.fileName.empty() && holder.displayCount == 0)
+			candidates.push_back(&holder);
+
+	// Textures no sprite refers to go first, then the least recently displayed ones.
+	std::sort(candidates.begin(), candidates.end(), [](const TextureHolder* lhs, const TextureHolder* rhs) noexcept
+	{
+		return std::make_pair(lhs->references != 0, lhs->lastUsedFrame) < std::make_pair(rhs->references != 0, rhs->lastUsedFrame);
+	});
+
+	size_t nbOfEvictions{ 0 };
+	for (TextureHolder* holder : candidates)
+	{
+		if (residentBytes <= registry.textureBudget)
+			break;
+
+		const size_t nbOfBytes{ computeTextureBytes(*holder) };
+		holder->actualTexture.reset(); // Reloaded by `switchToNextTexture` when needed.
+
+		residentBytes -= nbOfBytes;
+		registry.evictedBytes += nbOfBytes;
+		++registry.nbOfEvictedTextures;
+		++nbOfEvictions;
+	}
+
+	return nbOfEvictions;
+}
+
+SpriteWrapper::TextureMemoryStats SpriteWrapper::getTextureMemoryStats() noexcept
+{
+	TextureRegistry& registry{ currentRegistry() };
+	size_t residentBytes{ 0 };
+	for (const TextureHolder& holder : registry.allTextures)
+		residentBytes += computeTextureBytes(holder);
+
+	return TextureMemoryStats{ residentBytes, registry.evictedBytes, registry.nbOfEvictedTextures };
+}
+
+std::uint32_t SpriteWrapper::getTextureReferenceCount(std::string_view name) noexcept
+{
+	TextureRegistry& registry{ currentRegistry() };
+	auto mapIterator{ registry.accessToTextures.find(name) };
+
+	if (mapIterator == registry.accessToTextures.end())
+		return 0;
+
+	return registry.allTextures[mapIterator->second].references;
+}
+
+std::optional<std::pair<std::string_view, std::uint64_t>> SpriteWrapper::findTexture(const sf::Texture* texture, sf::IntRect area) noexcept
+{
+	TextureRegistry& registry{ currentRegistry() };
+	const auto isDisplayedBy{ [texture, area](const TextureHolder& holder)
+	{
+		if (holder.atlasPage != nullptr)
+			return holder.atlasPage == texture && holder.atlasRect.findIntersection(area).has_value();
+		return holder.actualTexture.get() == texture;
+	} };
+
+	// The texture may have been removed, reloaded or packed since, and another one may be displayed there.
+	const TextureArea textureArea{ texture, area.position };
+	if (const auto cached{ registry.namesOfTextures.find(textureArea) }; cached != registry.namesOfTextures.end()) [[likely]]
+		if (const TextureHolder* const holder{ registry.allTextures.get(cached->second.second) }; holder != nullptr && isDisplayedBy(*holder))
+			return std::pair<std::string_view, std::uint64_t>{ cached->second.first, holder->generation };
+
+	for (const auto& [name, key] : registry.accessToTextures)
+	{
+		const TextureHolder& holder{ registry.allTextures[key] };
+		if (!isDisplayedBy(holder))
+			continue;
+
+		const auto cached{ registry.namesOfTextures.insert_or_assign(textureArea, std::pair<std::string, SlotMap<TextureHolder>::Key>{ name, key }).first };
+		return std::pair<std::string_view, std::uint64_t>{ cached->second.first, holder.generation };
+	}
+
+	return std::nullopt;
+}
+
+std::uint32_t SpriteWrapper::getTextureUploadCount() noexcept
+{
+	return currentRegistry().nbOfTextureUploads;
+}
+
+void SpriteWrapper::displayTexture(TextureHolder* holder) noexcept
+{
+	if (m_displayedTexture == holder) [[likely]]
+		return;
+
+	if (m_displayedTexture != nullptr)
+	{
+		--m_displayedTexture->displayCount;
+		m_displayedTexture->lastUsedFrame = m_registry->currentFrame;
+	}
+
+	m_displayedTexture = holder;
+	if (holder != nullptr)
+	{
+		++holder->displayCount;
+		holder->lastUsedFrame = m_registry->currentFrame;
+	}
+}
+
+size_t SpriteWrapper::computeTextureBytes(const TextureHolder& holder) noexcept
+{
+	if (holder.actualTexture != nullptr)
+		return static_cast<size_t>(holder.actualTexture->getSize().x) * holder.actualTexture->getSize().y * 4;
+
+	if (holder.atlasPage != nullptr)
+		return static_cast<size_t>(holder.atlasRect.size.x) * holder.atlasRect.size.y * 4;
+
+	return 0;
+}
+
 
 std::optional<sf::Texture> loadTextureFromFile(std::ostringstream& errorMessage, std::string_view fileName, std::string_view path) noexcept
 {
+	PROFILE_SCOPE(textureLoadTime);
 	sf::Texture texture{};
 
 	try
@@ -465,6 +1288,8 @@ std::optional<sf::Texture> loadTextureFromFile(std::ostringstream& errorMessage,
 			throw LoadingGraphicalResourceFailure{ "Failed to load texture from file " + completePath.string() + '\n' };
 
 		texture.setSmooth(true); // Enable smooth rendering for the font.
+		PROFILE_COUNT(textureLoads, 1);
+		PROFILE_COUNT(textureLoadBytes, static_cast<size_t>(texture.getSize().x) * texture.getSize().y * 4);
 	}
 	catch (const LoadingGraphicalResourceFailure & error)
 	{
@@ -476,6 +1301,30 @@ std::optional<sf::Texture> loadTextureFromFile(std::ostringstream& errorMessage,
 	return std::make_optional(texture);
 }
 
+std::optional<sf::Image> loadImageFromFile(std::ostringstream& errorMessage, std::string_view fileName, std::string_view path) noexcept
+{
+	sf::Image image{};
+
+	try
+	{
+		std::filesystem::path completePath{ std::filesystem::path(path) / fileName };
+
+		if (!std::filesystem::exists(completePath)) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "Image file does not exist: " + completePath.string() + '\n' };
+
+		if (!image.loadFromFile(completePath)) [[unlikely]]
+			throw LoadingGraphicalResourceFailure{ "Failed to load image from file " + completePath.string() + '\n' };
+	}
+	catch (const LoadingGraphicalResourceFailure & error)
+	{
+		errorMessage << error.what();
+		errorMessage << "This texture cannot be displayed\n";
+		return std::nullopt;
+	}
+
+	return std::make_optional(std::move(image));
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 /// A `sf::Sprite` wrapper.
 ///////////////////////////////////////////////////////////////////////////////////////////////////
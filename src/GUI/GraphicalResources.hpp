@@ -11,19 +11,38 @@
 #ifndef GRAPHICALRESOURCES_HPP
 #define GRAPHICALRESOURCES_HPP
 
+#include "TextureAtlas.hpp"
+#include "AssetPack.hpp"
+#include "Profiler.hpp"
+#include "FlatMap.hpp"
+#include "SlotMap.hpp"
+#include "ArenaAllocator.hpp"
 #include <SFML/Graphics.hpp>
 #include <string>
 #include <string_view>
-#include <list>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <initializer_list>
+#include <span>
 #include <memory>
 #include <stdexcept>
 #include <optional>
 #include <sstream>
+#include <array>
+#include <charconv>
 #include <cstdint>
+#include <limits>
 #include <concepts>
 #include <type_traits>
+#include <utility>
+#include <bit>
+#include <cstring>
 
 #ifndef NDEBUG 
 #include <cassert>
@@ -77,33 +96,130 @@ public:
 
 /**
  * \brief Functor that allows hashing of `std::string` and `std::string_view` without ambiguity.
+ *
+ * Based on wyhash (final version 4): strings are read 4, 8 or 16 bytes at a time, and long ones
+ * 48 bytes at a time with three independent lanes, so most identifiers are hashed with two or three
+ * 64x64->128 bits multiplications. It remains `constexpr`, to hash names known at compile time. The
+ * values are the same whether the string is hashed at compile time or at runtime, on any platform.
  */
 struct TransparentHash
 {
 private:
 
-	constexpr uint64_t wyHash_mix(uint64_t a, uint64_t b) const noexcept
+	static constexpr uint64_t s_secret0{ 0x2d358dccaa6c78a5ull };
+	static constexpr uint64_t s_secret1{ 0x8bb84b93962eacc9ull };
+	static constexpr uint64_t s_secret2{ 0x4b33a62ed433d4a3ull };
+	static constexpr uint64_t s_secret3{ 0x4d5a2da51de1aa47ull };
+
+	/**
+	 * \brief Multiplies a and b into 128 bits, then returns the low and high halves in a and b.
+	 */
+	static constexpr void wyHash_mum(uint64_t& a, uint64_t& b) noexcept
+	{
+#if defined(__SIZEOF_INT128__)
+		const unsigned __int128 product{ static_cast<unsigned __int128>(a) * b };
+		a = static_cast<uint64_t>(product);
+		b = static_cast<uint64_t>(product >> 64);
+#else
+		const uint64_t aHigh{ a >> 32 }, aLow{ a & 0xffffffffull };
+		const uint64_t bHigh{ b >> 32 }, bLow{ b & 0xffffffffull };
+		const uint64_t highHigh{ aHigh * bHigh }, highLow{ aHigh * bLow }, lowHigh{ aLow * bHigh }, lowLow{ aLow * bLow };
+
+		const uint64_t low{ lowLow + (highLow << 32) };
+		const uint64_t carry{ static_cast<uint64_t>(low < lowLow) };
+		const uint64_t finalLow{ low + (lowHigh << 32) };
+		a = finalLow;
+		b = highHigh + (highLow >> 32) + (lowHigh >> 32) + carry + static_cast<uint64_t>(finalLow < low);
+#endif
+	}
+
+	static constexpr uint64_t wyHash_mix(uint64_t a, uint64_t b) noexcept
+	{
+		wyHash_mum(a, b);
+		return a ^ b;
+	}
+
+	/**
+	 * \brief Reads `N` bytes in little endian order, whatever the platform.
+	 */
+	template<size_t N>
+	static constexpr uint64_t wyHash_read(const char* p) noexcept
 	{
-		a ^= b;
-		a ^= (a >> 32);
-		a *= 0xd6e8feb86659fd93ull;
-		a ^= (a >> 32);
-		a *= 0xd6e8feb86659fd93ull;
-		a ^= (a >> 32);
-		return a;
+		if (!std::is_constant_evaluated() && std::endian::native == std::endian::little)
+		{
+			std::conditional_t<N == 8, uint64_t, uint32_t> value;
+			std::memcpy(&value, p, N); // Compiled to a single load.
+			return value;
+		}
+
+		uint64_t value{ 0 };
+		for (size_t i{ 0 }; i < N; ++i)
+			value |= static_cast<uint64_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+		return value;
 	}
 
-	constexpr size_t wyHash64(std::string_view s, uint64_t seed = 0) const noexcept
+	static constexpr size_t wyHash64(std::string_view s, uint64_t seed = 0) noexcept
 	{
-		constexpr uint64_t _wyp0 = 0xa0761d6478bd642full;
-		constexpr uint64_t _wyp1 = 0xe7037ed1a0b428dbull;
+		const char* p{ s.data() };
+		const size_t length{ s.size() };
+		uint64_t a, b;
 
-		uint64_t hash = seed ^ (s.size() * _wyp0);
+		seed ^= wyHash_mix(seed ^ s_secret0, s_secret1);
+
+		if (length <= 16) [[likely]] // Most identifiers.
+		{
+			if (length >= 4) [[likely]]
+			{	// Overlapping reads cover the whole string without any loop.
+				const size_t offset{ (length >> 3) << 2 };
+				a = (wyHash_read<4>(p) << 32) | wyHash_read<4>(p + offset);
+				b = (wyHash_read<4>(p + length - 4) << 32) | wyHash_read<4>(p + length - 4 - offset);
+			}
+			else if (length > 0)
+			{
+				a = (static_cast<uint64_t>(static_cast<unsigned char>(p[0])) << 16)
+				  | (static_cast<uint64_t>(static_cast<unsigned char>(p[length >> 1])) << 8)
+				  |  static_cast<uint64_t>(static_cast<unsigned char>(p[length - 1]));
+				b = 0;
+			}
+			else
+				a = b = 0;
+		}
+		else
+		{
+			size_t remaining{ length };
+
+			if (remaining >= 48) [[unlikely]]
+			{
+				uint64_t seed1{ seed }, seed2{ seed };
+				do
+				{
+					seed = wyHash_mix(wyHash_read<8>(p) ^ s_secret1, wyHash_read<8>(p + 8) ^ seed);
+					seed1 = wyHash_mix(wyHash_read<8>(p + 16) ^ s_secret2, wyHash_read<8>(p + 24) ^ seed1);
+					seed2 = wyHash_mix(wyHash_read<8>(p + 32) ^ s_secret3, wyHash_read<8>(p + 40) ^ seed2);
+					p += 48;
+					remaining -= 48;
+				} while (remaining >= 48);
+
+				seed ^= seed1 ^ seed2;
+			}
+
+			while (remaining > 16)
+			{
+				seed = wyHash_mix(wyHash_read<8>(p) ^ s_secret1, wyHash_read<8>(p + 8) ^ seed);
+				p += 16;
+				remaining -= 16;
+			}
+
+			// The last 16 bytes, which may overlap the previous block.
+			a = wyHash_read<8>(p + remaining - 16);
+			b = wyHash_read<8>(p + remaining - 8);
+		}
 
-		for (auto c : s)
-			hash = wyHash_mix(hash ^ static_cast<unsigned char>(c), _wyp1);
+		a ^= s_secret1;
+		b ^= seed;
+		wyHash_mum(a, b);
 
-		return static_cast<size_t>(wyHash_mix(hash, static_cast<uint64_t>(s.size())));
+		return static_cast<size_t>(wyHash_mix(a ^ s_secret0 ^ length, b ^ s_secret1));
 	}
 
 public:
@@ -232,6 +348,65 @@ constexpr sf::Vector2f computeNewOrigin(sf::FloatRect bound, Alignment alignment
 }
 
 
+class SpatialGrid;
+
+/**
+ * \brief A boolean flag that can be mirrored into a contiguous array.
+ *
+ * It behaves like a `bool`. Locked interfaces mirror the flag of each of their elements into a
+ * compact array, so that loops over all elements (drawing, hit tests) read this array instead of
+ * bringing every wrapper into the cache. Writing the flag updates its mirror as well.
+ *
+ * \note Copies only transfer the value: the mirror belongs to the element stored in an interface.
+ *
+ * \see `TransformableWrapper::hide`, `BasicInterface::lockInterface`.
+ */
+class MirroredFlag
+{
+public:
+
+	constexpr MirroredFlag(bool value) noexcept : m_value{ value }, m_mirror{ nullptr } {}
+	constexpr MirroredFlag(const MirroredFlag& other) noexcept : m_value{ other.m_value }, m_mirror{ nullptr } {}
+	constexpr MirroredFlag& operator=(const MirroredFlag& other) noexcept { return *this = other.m_value; }
+	constexpr ~MirroredFlag() noexcept = default;
+
+	constexpr MirroredFlag& operator=(bool value) noexcept
+	{
+		m_value = value;
+
+		if (m_mirror != nullptr) [[unlikely]]
+			*m_mirror = value;
+
+		return *this;
+	}
+
+	[[nodiscard]] constexpr operator bool() const noexcept
+	{
+		return m_value;
+	}
+
+	/**
+	 * \brief Sets where the flag is mirrored, and copies it there.
+	 * \complexity O(1).
+	 *
+	 * \param[out] mirror The mirror, or nullptr to stop mirroring.
+	 */
+	constexpr void setMirror(std::uint8_t* mirror) noexcept
+	{
+		m_mirror = mirror;
+
+		if (m_mirror != nullptr)
+			*m_mirror = m_value;
+	}
+
+private:
+
+	/// The value of the flag.
+	bool m_value;
+	/// Where the value is copied each time it is written, if not nullptr.
+	std::uint8_t* m_mirror;
+};
+
 /**
  * \brief Basic wrapper around a `sf::Transformable` using composition.
  * 
@@ -243,7 +418,8 @@ constexpr sf::Vector2f computeNewOrigin(sf::FloatRect bound, Alignment alignment
  * useful when combined with `sf::Drawable`.
  *
  * \note This is a pure virtual class. The pure virtual methods are `setAlignment` and `setColor`.
- * \note Getter methods from `sf::Transformable` should be implemented in derived classes.
+ * \note The position, scale, rotation and color can be read from the wrapper. Other getters from
+ *		 `sf::Transformable` should be implemented in derived classes.
  * \warning The wrapped `sf::Transformable` must remain valid throughout the lifetime of this object.
  *          No `nullptr` checks are performed for performance reasons. Using an invalid pointer will
  *          trigger an assertion.
@@ -321,13 +497,85 @@ public:
 	 */
 	virtual void setColor(sf::Color color) noexcept = 0;
 
+	/**
+	 * \see Similar to the `sf::Transformable::getPosition` function.
+	 */
+	[[nodiscard]] inline sf::Vector2f getPosition() const noexcept
+	{
+		ENSURE_VALID_PTR(m_transformable, "Pointer to sf::Transformable in TransformableWrapper is nullptr when the function getPosition is called");
+		return m_transformable->getPosition();
+	}
+
+	/**
+	 * \see Similar to the `sf::Transformable::getScale` function.
+	 */
+	[[nodiscard]] inline sf::Vector2f getScale() const noexcept
+	{
+		ENSURE_VALID_PTR(m_transformable, "Pointer to sf::Transformable in TransformableWrapper is nullptr when the function getScale is called");
+		return m_transformable->getScale();
+	}
+
+	/**
+	 * \see Similar to the `sf::Transformable::getRotation` function.
+	 */
+	[[nodiscard]] inline sf::Angle getRotation() const noexcept
+	{
+		ENSURE_VALID_PTR(m_transformable, "Pointer to sf::Transformable in TransformableWrapper is nullptr when the function getRotation is called");
+		return m_transformable->getRotation();
+	}
+
+	/**
+	 * \brief Returns the color applied to the `sf::Transformable` object.
+	 *
+	 * \see `setColor`.
+	 */
+	[[nodiscard]] virtual sf::Color getColor() const noexcept = 0;
+
+	/**
+	 * \brief Returns a counter that is incremented each time the wrapper is modified.
+	 * \complexity O(1).
+	 *
+	 * Every change of transform, color, content or texture increments it, which allows caches to
+	 * detect modifications without comparing every property. The `hide` flag is not tracked.
+	 *
+	 * \return The current revision.
+	 *
+	 * \see `RenderBatch`.
+	 */
+	[[nodiscard]] constexpr inline std::uint32_t getRevision() const noexcept
+	{
+		return m_revision;
+	}
+
+
+	/**
+	 * \brief Returns the bounds of the `sf::Transformable` in world coordinates.
+	 * \complexity O(1), if the wrapper was not modified since the last call.
+	 * \complexity Same as `sf::Text::getGlobalBounds` or `sf::Sprite::getGlobalBounds`, otherwise.
+	 *
+	 * The bounds are cached: hit tests and layout computations can call it repeatedly without
+	 * recomputing the transform. Any modification of the wrapper invalidates the cache.
+	 *
+	 * \return The axis-aligned bounds, as `sf::Transformable::getGlobalBounds` would return them.
+	 */
+	[[nodiscard]] inline const sf::FloatRect& getGlobalBounds() const noexcept
+	{
+		if (m_areBoundsOutdated) [[unlikely]]
+		{
+			m_globalBounds = computeGlobalBounds();
+			m_areBoundsOutdated = false;
+		}
+
+		return m_globalBounds;
+	}
+
 
 	/// Tells if the element should be drawn.
-	bool hide; 
+	MirroredFlag hide; 
 
 protected:
 	
-	constexpr inline TransformableWrapper() noexcept : hide{ true }, m_transformable{ nullptr }, m_alignment{ Alignment::Center } {}
+	constexpr inline TransformableWrapper() noexcept : hide{ true }, m_transformable{ nullptr }, m_alignment{ Alignment::Center }, m_revision{ 0 }, m_globalBounds{}, m_areBoundsOutdated{ true }, m_spatialLink{} {}
 	
 	/**
 	 * \brief Initializes the wrapper.
@@ -349,6 +597,52 @@ protected:
 	
 	/// /// The current alignment of the `sf::Transformable`.
 	Alignment m_alignment;
+
+	/**
+	 * \brief Increments the revision, invalidates the cached bounds and notifies the spatial index
+	 *		  the wrapper belongs to, if any.
+	 * \complexity O(1).
+	 *
+	 * Derived classes must call it each time they modify the wrapper.
+	 */
+	void markModified() noexcept;
+
+	/**
+	 * \brief Computes the bounds of the wrapped `sf::Transformable` in world coordinates.
+	 *
+	 * \see `getGlobalBounds`.
+	 */
+	[[nodiscard]] virtual sf::FloatRect computeGlobalBounds() const noexcept = 0;
+
+	/// Incremented each time the wrapper is modified.
+	std::uint32_t m_revision;
+
+	/// The last bounds computed by `getGlobalBounds`.
+	mutable sf::FloatRect m_globalBounds;
+	/// If true, `m_globalBounds` must be recomputed.
+	mutable bool m_areBoundsOutdated;
+
+private:
+
+	friend class SpatialGrid;
+
+	/**
+	 * \brief The spatial index to notify when the wrapper is modified.
+	 *
+	 * It belongs to the element stored within an interface: copies and moved-to wrappers start unlinked.
+	 */
+	struct SpatialLink
+	{
+		constexpr SpatialLink() noexcept = default;
+		constexpr SpatialLink(const SpatialLink&) noexcept {}
+		constexpr SpatialLink& operator=(const SpatialLink&) noexcept { return *this; }
+
+		SpatialGrid* grid{ nullptr };
+		std::uint32_t slot{ 0 };
+	};
+
+	/// Set by `SpatialGrid` while the wrapper is indexed.
+	SpatialLink m_spatialLink;
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -366,6 +660,13 @@ concept Ostreamable = requires(std::ostream & os, T t)
 	{ os << t } -> std::same_as<std::ostream&>;
 };
 
+/// The type is a number that `std::to_chars` can convert. Booleans and characters are excluded, since
+/// `std::basic_ostream` does not display them as numbers.
+template <typename T>
+concept ToCharsConvertible = Ostreamable<T> && std::is_arithmetic_v<T> && !std::same_as<T, bool>
+	&& !std::same_as<T, char> && !std::same_as<T, signed char> && !std::same_as<T, unsigned char>
+	&& !std::same_as<T, wchar_t> && !std::same_as<T, char8_t> && !std::same_as<T, char16_t> && !std::same_as<T, char32_t>;
+
 /**
  * \brief A wrapper for `sf::Text` that simplifies its use.
  * 
@@ -373,8 +674,13 @@ concept Ostreamable = requires(std::ostream & os, T t)
  * for the user to choose from. He can add/remove as much as he wants while keeping O(1) complexity.
  * The function `createFont` adds and loads a font that all instances can use, while `removeFont`
  * deletes it completely. Don't remove fonts that are being used by a text.
+ *
+ * Fonts belong to the `ResourceContext` of the calling thread, and each text to the context it was
+ * created within. Texts read their font, which rasterizes glyphs on demand, under a mutex of their
+ * context: texts of different windows can thus be modified by different threads at once, as done by
+ * `FramePreparer`.
  * 
- * \see `sf::Text`, `sf::Font`, `TransformableWrapper`.
+ * \see `sf::Text`, `sf::Font`, `TransformableWrapper`, `ResourceContext`.
  */
 class TextWrapper final : public TransformableWrapper
 {
@@ -405,7 +711,7 @@ public:
 	 */
 	template<Ostreamable T>
 	inline TextWrapper(const T& content, std::string_view fontName, unsigned int characterSize, sf::Vector2f pos, sf::Vector2f scale, sf::Color color = sf::Color::White, Alignment alignment = Alignment::Center, std::uint32_t style = 0, sf::Angle rot = sf::degrees(0))
-		: TransformableWrapper{}, m_wrappedText{ s_defaultFont, "", characterSize }
+		: TransformableWrapper{}, m_wrappedText{ s_defaultFont, "", characterSize }, m_contentBuffer{}, m_registry{ &currentRegistry() }, m_fontKey{}
 	{
 		create(&m_wrappedText, pos, scale, rot, alignment);
 
@@ -422,7 +728,7 @@ public:
 	TextWrapper(TextWrapper&&) noexcept;
 	TextWrapper& operator=(const TextWrapper&) noexcept;
 	TextWrapper& operator=(TextWrapper&&) noexcept;
-	virtual ~TextWrapper() noexcept = default;
+	virtual ~TextWrapper() noexcept; /// \complexity O(S), where S is the number of character sizes of its font.
 
 
 	/**
@@ -441,6 +747,59 @@ public:
 		setContent(std::move(oss));
 	}
 
+	/**
+	 * \brief Updates the text content with a number, without allocating.
+	 * \complexity O(1).
+	 *
+	 * The number is formatted on the stack with `std::to_chars`, the same way `std::ostream` would
+	 * display it (6 significant digits for floating numbers).
+	 *
+	 * \param[in] content The new content for the text.
+	 *
+	 * \see `setContent(std::string_view)`.
+	 */
+	template<ToCharsConvertible T>
+	inline void setContent(const T& content) noexcept
+	{
+		std::array<char, 32> buffer; // Enough for any integer, or floating number with 6 significant digits.
+		std::to_chars_result result{};
+
+		if constexpr (std::is_floating_point_v<T>)
+			result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), content, std::chars_format::general, 6);
+		else
+			result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), content);
+
+		setContent(std::string_view{ buffer.data(), static_cast<size_t>(result.ptr - buffer.data()) });
+	}
+
+	/**
+	 * \brief Updates the text content with a string, without allocating.
+	 *
+	 * \see `setContent(std::string_view)`.
+	 */
+	template<Ostreamable T> requires std::convertible_to<const T&, std::string_view>
+	inline void setContent(const T& content) noexcept
+	{
+		setContent(std::string_view{ content });
+	}
+
+	/**
+	 * \brief Updates the text content, only if it differs from the current one.
+	 * \complexity O(N), where N is the length of the content.
+	 *
+	 * Nothing is done, not even the computation of the origin, if the text already displays this
+	 * content: labels can be updated every frame at no cost while their value does not change.
+	 *
+	 * Ascii contents are converted within a buffer kept by the wrapper, so that no memory is allocated
+	 * once the buffer is large enough. Others are converted with the global locale, like the other
+	 * overloads do.
+	 *
+	 * \param[in] content The new content for the text.
+	 *
+	 * \see `sf::Text::setString`.
+	 */
+	void setContent(std::string_view content) noexcept;
+
 	/**
 	 * \see setContent(const T& content).
 	 */
@@ -477,6 +836,14 @@ public:
 	 */
 	virtual void setColor(sf::Color color) noexcept final;
 
+	/**
+	 * \see `sf::Text::getFillColor`.
+	 */
+	[[nodiscard]] virtual sf::Color getColor() const noexcept final
+	{
+		return m_wrappedText.getFillColor();
+	}
+
 	/**
 	 * \see `sf::Text::setStyle`.
 	 */
@@ -545,6 +912,28 @@ public:
 	 * \see `loadFontFromFile`, `setFont`
 	 */
 	static void createFont(std::string name, sf::Font font) noexcept;
+
+	/**
+	 * \brief Opens a font from an asset pack and registers it under a given name for shared use across
+	 *		  instances.
+	 * \complexity O(log E), where E is the number of entries of the pack.
+	 *
+	 * The font reads the mapped memory of the pack: the pack is kept alive until the font is removed.
+	 * If a font with the same name already exists, the function does nothingallowing safe repeated calls.
+	 *
+	 * \param[in] name The alias under which the font will be stored.
+	 * \param[in] pack The pack that contains the font.
+	 * \param[in] entryName The name of the font within the pack.
+	 *
+	 * \note Do not start a font name with an underscore.
+	 *
+	 * \pre `pack` must be a valid ptr.
+	 * \warning The program will assert otherwise.
+	 * \throw LoadingGraphicalResourceFailure Strong exception guarantee: no state is modified on failure.
+	 *
+	 * \see `AssetPack`, `setFont`
+	 */
+	static void createFont(std::string name, std::shared_ptr<const AssetPack> pack, std::string_view entryName);
 	
 	/**
 	 * \brief Removes the font from the wrapper with the given name.
@@ -574,15 +963,214 @@ public:
 	 */
 	[[nodiscard]] static sf::Font* getFont(std::string_view name) noexcept;
 
+	/**
+	 * \brief Rasterizes glyphs of a font ahead of time.
+	 * \complexity O(S * C), where S is the number of character sizes and C the number of characters.
+	 *
+	 * SFML rasterizes a glyph the first time it is displayed with a given character size, which can
+	 * stall the first frame of a new menu or the first keystrokes into a text field. Calling this
+	 * function during a loading screen moves that work out of the frames that matter.
+	 *
+	 * \param[in] name The alias under which the font was stored.
+	 * \param[in] characterSizes The character sizes to rasterize.
+	 * \param[in] charset The characters to rasterize, printable ascii by default.
+	 * \param[in] bold If true, the bold glyphs are rasterized instead.
+	 *
+	 * \return `false` if the font does not exist, `true` otherwise.
+	 *
+	 * \pre An OpenGL context must be active, as glyphs are uploaded to the page textures.
+	 *
+	 * \code
+	 * gui::TextWrapper::warmUpFont("__default", { 24, 30, 48 });
+	 * \endcode
+	 *
+	 * \see `setFontMemoryBudget`.
+	 */
+	static bool warmUpFont(std::string_view name, const std::vector<unsigned int>& characterSizes, std::u32string_view charset = s_printableAscii, bool bold = false) noexcept;
+
+	/**
+	 * \brief Returns the memory used by the glyph pages of a font, in bytes.
+	 * \complexity O(S), where S is the number of character sizes the font was used with.
+	 *
+	 * Only the character sizes used by texts, or warmed up, since the last release of the pages are
+	 * accounted for.
+	 *
+	 * \param[in] name The alias under which the font was stored.
+	 *
+	 * \return The size of the page textures, 4 bytes per pixel. 0 if the font does not exist.
+	 */
+	[[nodiscard]] static size_t getFontMemoryUsage(std::string_view name) noexcept;
+
+	/**
+	 * \brief Caps the memory used by the glyph pages of a font.
+	 * \complexity O(S), where S is the number of character sizes the font was used with.
+	 *
+	 * Each character size gets its own page texture, which only grows. When a text requests a new
+	 * character size while the pages exceed the budget, all pages of the font are released: glyphs
+	 * still displayed are rasterized again when drawn. Long sessions that display many sizes thus
+	 * stop growing the font memory without bound.
+	 *
+	 * The budget is checked right away, and each time a new character size is used. It is not by
+	 * default.
+	 *
+	 * \param[in] name The alias under which the font was stored.
+	 * \param[in] budget The maximum memory, in bytes, of the glyph pages.
+	 *
+	 * \see `getFontMemoryUsage`, `warmUpFont`.
+	 */
+	static void setFontMemoryBudget(std::string_view name, size_t budget) noexcept;
+
+	/**
+	 * \brief Returns a counter that is incremented each time the glyph pages of a font are released,
+	 *		  or a font is removed.
+	 * \complexity O(1).
+	 *
+	 * The page textures of the font are then replaced: anything caching them, or the texture
+	 * coordinates of its glyphs, should be recomputed. A removed font may also be replaced by another
+	 * one at the same address.
+	 *
+	 * \see `setFontMemoryBudget`, `RenderBatch`.
+	 */
+	[[nodiscard]] static std::uint32_t getFontGeneration() noexcept;
+
+	/**
+	 * \brief Finds the name of a font from its address.
+	 * \complexity O(1) if the font was found by a previous call, O(F) otherwise, where F is the number of fonts.
+	 *
+	 * Along with the name, returns the generation of the font: a number given when the font was
+	 * created, never reused within the `ResourceContext`. Hence, a font removed and then created again
+	 * under the same name, or at the same address, is not mistaken for the former one.
+	 *
+	 * \param[in] font The address of the font, as returned by `getFont`.
+	 *
+	 * \return The name and the generation of the font, or nullopt if it is not registered.
+	 *
+	 * \see `createSharedTextureFromDrawables`.
+	 */
+	[[nodiscard]] static std::optional<std::pair<std::string_view, std::uint64_t>> findFont(const sf::Font* font) noexcept;
+
+
+	/// Every printable ascii character, the default charset of `warmUpFont`.
+	inline static constexpr std::u32string_view s_printableAscii{ U" !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~" };
+
 private:
 
+	/**
+	 * \brief A character size a font is used with.
+	 */
+	struct CharacterSize
+	{
+		unsigned int size; // The character size.
+		size_t nbOfTexts; // The number of texts using it.
+		bool hasPage; // If false, its page was released, and was not known to be rasterized again since.
+	};
+
+	/**
+	 * \brief A font, and what is needed to limit the memory of its glyph pages.
+	 */
+	struct FontHolder
+	{
+		std::shared_ptr<const AssetPack> pack; // Read by the font if it was opened from a pack, nullptr otherwise. Declared first: destroyed after the fonts.
+		sf::Font font; // The font used by the texts.
+		sf::Font pristine; // A copy of the font made before any glyph was rasterized.
+		std::vector<CharacterSize> characterSizes; // The sizes used by texts or warmed up, since the last release of the pages for the unused ones.
+		size_t memoryBudget; // The maximum memory of the pages, in bytes.
+		std::uint64_t generation; // Never reused within the registry: identifies the font even once its name or address is reused.
+	};
+
+	/**
+	 * \brief The fonts of a `ResourceContext`.
+	 */
+	struct FontRegistry
+	{
+		SlotMap<FontHolder> allFonts{}; // They never move: texts keep a pointer to their font.
+		FlatMap<std::string, SlotMap<FontHolder>::Key, TransparentHash, TransparentEqual> accessToFonts{}; // Finds fonts with a name in O(1).
+		std::atomic<std::uint32_t> fontGeneration{ 0 }; // Incremented each time the glyph pages of a font are released, possibly by a worker preparing a frame, or a font is removed.
+		std::mutex mutex{}; // Locked while texts read or track their font: texts of different windows can be modified by different threads.
+		std::uint64_t nbOfCreatedFonts{ 0 }; // Gives its generation to each new font.
+		std::unordered_map<const sf::Font*, std::pair<std::string, SlotMap<FontHolder>::Key>> namesOfFonts{}; // Filled by `findFont`. Checked against the holder before being trusted.
+	};
+
+	friend class ResourceContext;
+	friend class RenderBatch;
+
+
+	/**
+	 * \brief Returns the fonts of the `ResourceContext` of the calling thread.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] static FontRegistry& currentRegistry() noexcept;
+
+
+	/**
+	 * \see `TransformableWrapper::computeGlobalBounds`.
+	 */
+	[[nodiscard]] inline virtual sf::FloatRect computeGlobalBounds() const noexcept final
+	{
+		std::lock_guard lock{ m_registry->mutex }; // `sf::Text` reads its font, and lays out the text if it changed.
+		return m_wrappedText.getGlobalBounds();
+	}
+
+	/**
+	 * \brief Records that a font is used with a character size, and enforces its budget.
+	 * \complexity O(S), where S is the number of character sizes of the font.
+	 *
+	 * \param[in,out] registry The fonts the font belongs to.
+	 * \param[in] font The key of the font, null for the default one.
+	 * \param[in] characterSize The character size.
+	 * \param[in] nbOfTexts The number of texts that start using the size: 0 if it is only warmed up.
+	 *
+	 * \note The mutex of the registry must be locked by the caller.
+	 */
+	static void trackCharacterSize(FontRegistry& registry, SlotMap<FontHolder>::Key font, unsigned int characterSize, size_t nbOfTexts) noexcept;
+
+	/**
+	 * \brief Computes the origin of the text from its layout and its alignment, then marks it modified.
+	 * \complexity O(L), where L is the length of the text.
+	 *
+	 * The text is laid out under the mutex of its registry, since its font may rasterize glyphs.
+	 */
+	void setOriginFromLayout() noexcept;
+
+	/**
+	 * \brief Records that a text no longer uses a font with a character size.
+	 * \complexity O(S), where S is the number of character sizes of the font.
+	 *
+	 * The page of the size is kept until the pages of the font are released.
+	 *
+	 * \param[in,out] registry The fonts the font belongs to.
+	 * \param[in] font The key of the font, null for the default one. Can be stale.
+	 * \param[in] characterSize The character size.
+	 *
+	 * \note The mutex of the registry must be locked by the caller.
+	 */
+	static void untrackCharacterSize(FontRegistry& registry, SlotMap<FontHolder>::Key font, unsigned int characterSize) noexcept;
+
+	/**
+	 * \brief Returns the memory used by the glyph pages of a font, in bytes.
+	 * \complexity O(S), where S is the number of character sizes of the font.
+	 */
+	[[nodiscard]] static size_t computePagesMemory(const FontHolder& holder) noexcept;
+
+	/**
+	 * \brief Releases all glyph pages of a font.
+	 * \complexity O(S), where S is the number of character sizes of the font.
+	 *
+	 * The sizes still used by texts keep being tracked, since their glyphs are rasterized again when
+	 * the texts are drawn.
+	 */
+	static void releasePages(FontRegistry& registry, FontHolder& holder) noexcept;
+
+
 	/// What `sf::Text` the wrapper is being used for.
 	sf::Text m_wrappedText;
+	/// Reused by `setContent(std::string_view)` to convert the content without allocating.
+	sf::String m_contentBuffer;
 
-	/// Contains all loaded fonts
-	inline static std::list<sf::Font> s_allFonts{};
-	/// Allows to find fonts with a name in O(1) time complexity.
-	inline static std::unordered_map<std::string, std::list<sf::Font>::iterator, TransparentHash, TransparentEqual> s_accessToFonts{};
+	/// The fonts of the context the text was created within.
+	FontRegistry* m_registry;
+	/// The font of the text within `m_registry`, null while the default font is used.
+	SlotMap<FontHolder>::Key m_fontKey;
 	
 	/// A default font that is used to initialize the `sf::Text` before setting its actual font.
 	inline static const sf::Font s_defaultFont{}; 
@@ -624,7 +1212,7 @@ private:
  * - **Shared textures**: Can be used by multiple sprite instances.
  * - **Reserved textures**: Owned exclusively by a single sprite instance.
  *
- * To use a texture, you must first call `createTexture` to load it into the global store. Then, use
+ * To use a texture, you must first call `createTexture` to load it into the store. Then, use
  * `addTexture` on each sprite instance that will use that texture. A reserved texture is claimed by
  * the first instance that adds it using `addTexture`. When reserved, `addTexture` must only be called 
  * if the texture was reserved by its respective sprite instance.
@@ -634,12 +1222,22 @@ private:
  * in which textures are added is preserved.
  *
  * Resource Management:
- * - Use `createTexture` / `removeTexture` to control the global texture store.
+ * - Use `createTexture` / `removeTexture` to control the texture store.
  * - Use `loadTexture` / `unloadTexture` to manage memory without removing references.
  * - `removeTexture` completely deletes a shared texture once no sprite references it.
  * - `unloadTexture` releases GPU memory but keeps texture pointers in texture vectors valid.
  * - Reserved textures cannot be manually removed with `removeTexture`; they are automatically
  *   cleaned up when their owning sprite instance is destroyed. However, they can still be unloaded.
+ * - Use `loadTextureAsync` / `prefetchTextures` to decode textures in the background, and
+ *   `uploadStreamedTextures` once per frame to send them to the GPU without any frame drop.
+ * - Use `setTextureBudget` / `updateTextureResidency` to unload the least recently displayed
+ *   textures automatically when the graphical memory exceeds a budget.
+ * - The store belongs to the `ResourceContext` of the calling thread, and each sprite to the
+ *   context it was created within. Sprites switch textures under a mutex of their context: sprites
+ *   of different windows can thus be animated by different threads at once, as done by
+ *   `FramePreparer`.
+ *
+ * The sprite accepts an `ArenaAllocator`: its textures are listed in the arena of its interface.
  * 
  * A code example is provided at the end of the file.
  *
@@ -651,7 +1249,11 @@ class SpriteWrapper final : public TransformableWrapper
 {
 public:
 
-	/**
+	/// Containers allocated from an arena give it to their sprites.
+	using allocator_type = ArenaAllocator<>;
+
+
+	/**
 	 * \brief Initializes the wrapper.
 	 * \complexity O(1).
 	 * 
@@ -676,9 +1278,20 @@ public:
 	 */
 	SpriteWrapper(std::string_view textureName, sf::Vector2f pos, sf::Vector2f scale, sf::IntRect rect = sf::IntRect{}, sf::Angle rot = sf::degrees(0), Alignment alignment = Alignment::Center, sf::Color color = sf::Color::White);
 
+	/**
+	 * \brief Initializes the wrapper, whose textures are listed in memory given by the allocator.
+	 * \complexity O(1).
+	 *
+	 * Called by the containers allocated from an arena, such as the sprites of an interface.
+	 *
+	 * \see The other constructor.
+	 */
+	SpriteWrapper(std::allocator_arg_t, const allocator_type& allocator, std::string_view textureName, sf::Vector2f pos, sf::Vector2f scale, sf::IntRect rect = sf::IntRect{}, sf::Angle rot = sf::degrees(0), Alignment alignment = Alignment::Center, sf::Color color = sf::Color::White);
+
 	SpriteWrapper() noexcept = delete;
 	SpriteWrapper(const SpriteWrapper&) noexcept = delete; // For reserved texture.
 	SpriteWrapper(SpriteWrapper&&) noexcept;
+	SpriteWrapper(SpriteWrapper&& other, const allocator_type& allocator) noexcept; // Copies the lists of textures if the allocators differ.
 	SpriteWrapper& operator=(const SpriteWrapper&) noexcept = delete; // For reserved texture.
 	SpriteWrapper& operator=(SpriteWrapper&&) noexcept;
 	virtual ~SpriteWrapper() noexcept; /// \complexity O(N) where N is the number of reserved texture to deallocate.
@@ -689,6 +1302,14 @@ public:
 	 */
 	virtual void setColor(sf::Color color) noexcept final;
 
+	/**
+	 * \see `sf::Sprite::getColor`.
+	 */
+	[[nodiscard]] virtual sf::Color getColor() const noexcept final
+	{
+		return m_wrappedSprite.getColor();
+	}
+
 	/**
 	 * \brief Sets the `sf::Transformable`'s origin given alignment.
 	 * \complexity O(1).
@@ -754,6 +1375,10 @@ public:
 	/**
 	 * \see Same as switchToNextTexture but you specify the index.
 	 * 
+	 * No modulo is computed, and nothing happens if the index is the current one: hence, it is the
+	 * function used by `SpriteAnimator`. If the new texture lies in the same texture (or atlas page)
+	 * as the current one, only the displayed rectangle changes.
+	 * 
 	 * \pre The index must not be out of range
 	 * \warning If the index is out if range, the program will assert.
 	 * 
@@ -772,6 +1397,17 @@ public:
 		return m_curTextureIndex;
 	}
 
+	/**
+	 * \brief Returns the number of entries within the texture vector.
+	 * \complexity O(1).
+	 *
+	 * \see `addTexture`.
+	 */
+	[[nodiscard]] inline size_t getNbOfTextures() const noexcept
+	{
+		return m_textures.size();
+	}
+
 	/**
 	 * \brief Adds a texture (with one or more sub-rectangles) to this instance's texture vector.
 	 * 
@@ -815,32 +1451,33 @@ public:
 	template<typename... Ts> requires (std::same_as<Ts, sf::IntRect> && ...)
 	inline bool addTexture(std::string_view name, Ts... rects)
 	{
-		auto mapAccessIterator{ s_accessToTextures.find(name) };
-		if (mapAccessIterator == s_accessToTextures.end()) [[unlikely]]
+		auto mapAccessIterator{ m_registry->accessToTextures.find(name) };
+		if (mapAccessIterator == m_registry->accessToTextures.end()) [[unlikely]]
 			return false; // Texture not there.
 
-		auto mapUniqueIterator{ s_allUniqueTextures.find(&*mapAccessIterator->second) };
+		TextureHolder* texture{ &m_registry->allTextures[mapAccessIterator->second] };
+		auto mapUniqueIterator{ m_registry->allUniqueTextures.find(texture) };
 #ifndef NDEBUG
-		if (mapUniqueIterator != s_allUniqueTextures.end() // is reserved.
+		if (mapUniqueIterator != m_registry->allUniqueTextures.end() // is reserved.
 		&&  mapUniqueIterator->second == true // has already been claimed by an instance...
 		&&  std::find(m_uniqueTextures.begin(), m_uniqueTextures.end(), name) == m_uniqueTextures.end()) [[unlikely]] // ...but not by this one.
 			assert(!"Precondition violated; The reserved texture was not available anymore for this sprite instance when addTexture was called in SpriteWrapper");
 #endif // NDEBUG
 
-		TextureHolder* texture{ &*mapAccessIterator->second };
 		(m_textures.push_back(TextureInfo{ texture, rects }), ...);
+		texture->references += sizeof...(Ts);
 
 #ifndef NDEBUG
-		if (mapUniqueIterator != s_allUniqueTextures.end() && mapUniqueIterator->second == false) // For reserved texture.
+		if (mapUniqueIterator != m_registry->allUniqueTextures.end() && mapUniqueIterator->second == false) // For reserved texture.
 		{
 			mapUniqueIterator->second = true;  // Mark it as true, meaning the reserve state was claimed.
-			m_uniqueTextures.push_back(std::string{ name });
+			m_uniqueTextures.emplace_back(name);
 		}
 #else 
-		if (mapUniqueIterator != s_allUniqueTextures.end()) // For reserved texture.
+		if (mapUniqueIterator != m_registry->allUniqueTextures.end()) // For reserved texture.
 		{
-			m_uniqueTextures.push_back(std::string{ name });
-			s_allUniqueTextures.erase(mapUniqueIterator); // Frees memory, won't be checked in release mode.
+			m_uniqueTextures.emplace_back(name);
+			m_registry->allUniqueTextures.erase(mapUniqueIterator); // Frees memory, won't be checked in release mode.
 		}
 #endif // NDEBUG
 
@@ -911,6 +1548,50 @@ public:
 	 * \see `loadTextureFromFile`, `addTexture`.
 	 */
 	 static void createTexture(std::string name, sf::Texture texture, Reserved shared = Reserved::Yes) noexcept;
+
+	/**
+	 * \brief Creates a texture from what was drawn onto a render texture and registers it under a given name.
+	 * \complexity Amortized O(1), plus O(P * S) if packed, see `TextureAtlas::insert`.
+	 *
+	 * If the texture is shared and the atlas is enabled, the content of the render texture is copied
+	 * straight into an atlas page: no standalone `sf::Texture` is created in between. Otherwise, it is
+	 * copied into its own texture. Either way, the texture is smoothed.
+	 *
+	 * \param[in] name The alias under which the texture will be stored.
+	 * \param[in] rendered The render texture, on which `display` was called. It can be destroyed afterwards.
+	 * \param[in] shared: `No` if the texture is reserved.
+	 *
+	 * \note Like the overload with a `sf::Texture`, the texture can't be unloaded.
+	 * \note Do not start a texture name with an underscore.
+	 *
+	 * \see `createSharedTextureFromDrawables`, `enableAtlas`.
+	 */
+	static void createTexture(std::string name, const sf::RenderTexture& rendered, Reserved shared = Reserved::Yes) noexcept;
+
+	/**
+	 * \brief Creates a texture from an entry of an asset pack and registers it under a given name.
+	 * \complexity Amortized O(1), plus O(log E) when loaded, where E is the number of entries of the pack.
+	 *
+	 * Behaves like the overload with a file name: the texture is loaded, reloaded after being unloaded
+	 * or evicted, and streamed from the pack instead of a file. The pack is kept alive until the
+	 * texture is removed.
+	 *
+	 * \param[in] name The alias under which the texture will be stored.
+	 * \param[in] pack The pack that contains the texture.
+	 * \param[in] entryName The name of the texture within the pack.
+	 * \param[in] shared: `No` if the texture is reserved.
+	 * \param[in] loadImmediately: `true` if you want the texture to be loaded when the function is
+	 *							   called. if so, may throw an exception if failed.
+	 *
+	 * \note Do not start a texture name with an underscore.
+	 *
+	 * \pre `pack` must be a valid ptr.
+	 * \warning The program will assert otherwise.
+	 * \throw LoadingGraphicalResourceFailure Strong exception guarantee: no state is modified on failure.
+	 *
+	 * \see `AssetPack`, `addTexture`.
+	 */
+	static void createTexture(std::string name, std::shared_ptr<const AssetPack> pack, std::string entryName, Reserved shared = Reserved::Yes, bool loadImmediately = false);
 	
 	/**
 	 * \brief Removes a shared texture from the wrapper with the given name. 
@@ -940,7 +1621,9 @@ public:
 	 *
 	 * \param[in] name The alias under which the texture was stored.
 	 *
-	 * \return The address of the texture.
+	 * \return The address of the texture, or of the atlas page that contains it if it was packed.
+	 * 
+	 * \see `enableAtlas`.
 	 */
 	[[nodiscard]] static sf::Texture* getTexture(std::string_view name) noexcept;
 
@@ -986,7 +1669,8 @@ public:
 	 * \param[in] name The alias of the texture to unload.
 	 *
 	 * \return `true` if the texture was successfully unloaded or was already unloaded.
-	 *         `false` if the texture could not be found or if its file path was not set.
+	 *         `false` if the texture could not be found, if its file path was not set or if it was
+	 *		   packed into an atlas page.
 	 *
 	 * \note It is recommended to call this from a separate thread for large textures or to avoid frame drops.
 	 * \note This function is designed not to throw if the texture was not found, to support scenarios
@@ -1000,6 +1684,286 @@ public:
 	 */
 	static bool unloadTexture(std::string_view name) noexcept;
 
+	/**
+	 * \brief Enables or disables the packing of shared textures into atlas pages.
+	 * \complexity O(1).
+	 *
+	 * When enabled, every shared texture that is small enough, smooth and not repeated is copied into
+	 * a large `sf::Texture` page as soon as it is created or loaded, and its own texture is freed. Sprites
+	 * then display a sub-rectangle of that page: switching between textures of the same page is a simple
+	 * rect change, and the batched drawing of interfaces can merge them into a single draw call.
+	 *
+	 * \param[in] enable `true` to pack the textures that are created or loaded from now on.
+	 * \param[in] pageSize The width and height of the pages that will be created.
+	 * \param[in] padding The transparent space kept between two packed textures, in pixels.
+	 *
+	 * \note Textures that are already created or loaded are not affected.
+	 * \note Packed textures can't be unloaded. They are released by `removeTexture`, but their area
+	 *		 within the page is not reused. A page is freed once all its textures are removed.
+	 * \note Sub-rectangles given to `addTexture` remain relative to the texture. They must not exceed its
+	 *		 size, otherwise the neighbours within the page would be displayed.
+	 *
+	 * \see `TextureAtlas`, `createTexture`, `loadTexture`, `BasicInterface::lockInterface`.
+	 */
+	static void enableAtlas(bool enable, unsigned int pageSize = 2048, unsigned int padding = 2) noexcept;
+
+	/**
+	 * \brief Starts loading a texture in the background, without blocking the calling thread.
+	 * \complexity O(1).
+	 *
+	 * The file is decoded into an `sf::Image` by a worker of the shared `ThreadPool`. The texture itself
+	 * is only created by `uploadStreamedTextures`, on the render thread. In the meantime, sprites that
+	 * switch to this texture keep displaying their previous one (or nothing if they had none), and are
+	 * updated as soon as it is uploaded.
+	 *
+	 * \param[in] name The alias of the texture to load.
+	 *
+	 * \return `true` if the texture is being loaded or is already loaded.
+	 *		   `false` if the texture could not be found or if its file path was not set.
+	 *
+	 * \note If the decoding fails, the texture remains unloaded: the next synchronous loading (for
+	 *		 instance by `switchToNextTexture`) reports the error.
+	 * \note Calling `loadTexture` or `unloadTexture` while the texture is being decoded discards the
+	 *		 background result.
+	 *
+	 * \see `uploadStreamedTextures`, `prefetchTextures`, `loadTexture`.
+	 */
+	static bool loadTextureAsync(std::string_view name) noexcept;
+
+	/**
+	 * \brief Creates the textures decoded in the background, within a memory budget.
+	 * \complexity O(N), where N is the number of textures uploaded; plus the GPU uploads.
+	 *
+	 * It should be called once per frame, on the render thread. Textures decoded by `loadTextureAsync`
+	 * are uploaded in the order they were decoded, until the budget is reached; the remaining ones are
+	 * uploaded during the next calls. At least one texture is uploaded per call, even if it exceeds
+	 * the budget on its own.
+	 *
+	 * \param[in] byteBudget The maximum number of bytes to upload (4 bytes per pixel).
+	 *
+	 * \return The number of textures uploaded.
+	 *
+	 * \see `loadTextureAsync`.
+	 */
+	static size_t uploadStreamedTextures(size_t byteBudget = 16'777'216) noexcept;
+
+	/**
+	 * \brief How far the textures requested by `preload` or `preloadAll` are.
+	 *
+	 * \see `getPreloadProgress`.
+	 */
+	struct PreloadProgress
+	{
+		size_t nbOfTextures; // Requested since the previous preload was done.
+		size_t nbOfDone; // Uploaded, failed, or loaded, unloaded or removed in the meantime.
+		size_t nbOfFailures; // Could not be decoded: they remain unloaded.
+
+		/**
+		 * \brief Returns the ratio of done textures, between 0 and 1. 1 if there is nothing to preload.
+		 * \complexity O(1).
+		 */
+		[[nodiscard]] constexpr inline float getRatio() const noexcept
+		{
+			return (nbOfTextures == 0) ? 1.f : static_cast<float>(nbOfDone) / static_cast<float>(nbOfTextures);
+		}
+
+		/**
+		 * \complexity O(1).
+		 */
+		[[nodiscard]] constexpr inline bool isDone() const noexcept
+		{
+			return nbOfDone == nbOfTextures;
+		}
+	};
+
+	/**
+	 * \brief Starts decoding all registered textures that are not loaded yet, in parallel.
+	 * \complexity O(T), where T is the number of textures.
+	 *
+	 * Loading many textures with `loadImmediately` decodes them one after the other on the render
+	 * thread. Instead, register them without loading them, then preload them: each file is decoded by
+	 * a worker of the shared `ThreadPool`, so that the decoding time scales with the number of cores
+	 * rather than with the number of textures. The textures are then uploaded on the render thread by
+	 * `uploadStreamedTextures`, or all at once by `finishPreloading`. Meanwhile, the progress can be
+	 * displayed, typically with `moveProgressBar`.
+	 *
+	 * \return The number of textures requested, including the ones being decoded already.
+	 *
+	 * \note Fonts are not concerned: `TextWrapper::createFont` opens them, and their glyphs can only be
+	 *		 rasterized on the render thread (see `TextWrapper::warmUpFont`).
+	 * \note Textures without a file name, or already loaded, are skipped.
+	 *
+	 * \code
+	 * gui::SpriteWrapper::createTexture("button", "button.png", gui::SpriteWrapper::Reserved::No); // Not loaded yet.
+	 * // ... Dozens more.
+	 *
+	 * gui::SpriteWrapper::preloadAll();
+	 * gui::SpriteWrapper::finishPreloading([&](const gui::SpriteWrapper::PreloadProgress& progress)
+	 * {
+	 *		gui::moveProgressBar(&loadingScreen, "loading", progress.getRatio() * 100.f);
+	 *		window.clear();
+	 *		loadingScreen.draw();
+	 *		window.display();
+	 * });
+	 * \endcode
+	 *
+	 * \see `preload`, `finishPreloading`, `getPreloadProgress`, `loadTextureAsync`.
+	 */
+	static size_t preloadAll() noexcept;
+
+	/**
+	 * \brief Starts decoding some registered textures, in parallel.
+	 * \complexity O(N), where N is the number of names.
+	 *
+	 * \param[in] names The aliases of the textures. Unknown ones are skipped.
+	 *
+	 * \return The number of textures requested, including the ones being decoded already.
+	 *
+	 * \see `preloadAll`.
+	 */
+	static size_t preload(std::span<const std::string_view> names) noexcept;
+
+	/**
+	 * \see Same as `preload(std::span<const std::string_view>)`.
+	 */
+	static inline size_t preload(std::initializer_list<std::string_view> names) noexcept
+	{
+		return preload(std::span<const std::string_view>{ names.begin(), names.size() });
+	}
+
+	/**
+	 * \brief Returns how far the preloaded textures are.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] static PreloadProgress getPreloadProgress() noexcept;
+
+	/**
+	 * \brief Blocks until all preloaded textures are uploaded, uploading them as they are decoded.
+	 * \complexity O(N), where N is the number of preloaded textures; plus the GPU uploads.
+	 *
+	 * Must be called on the render thread. The textures decoded in the meantime are uploaded together,
+	 * then the function is called with the progress, until all of them are done.
+	 *
+	 * \param[in] onProgress Called after each batch of uploads, e.g. to draw a loading screen. Can be empty.
+	 *
+	 * \return The final progress, with the number of failures.
+	 *
+	 * \see `preloadAll`.
+	 */
+	static PreloadProgress finishPreloading(const std::function<void(const PreloadProgress&)>& onProgress = {}) noexcept;
+
+	/**
+	 * \brief Starts loading all the textures of this sprite in the background.
+	 * \complexity O(N), where N is the number of textures within the texture vector.
+	 *
+	 * Useful before an animation starts, so switching between its frames never blocks.
+	 *
+	 * \see `loadTextureAsync`, `addTexture`.
+	 */
+	void prefetchTextures() const noexcept;
+
+	/**
+	 * \brief The graphical memory used by textures.
+	 *
+	 * \see `getTextureMemoryStats`.
+	 */
+	struct TextureMemoryStats
+	{
+		size_t residentBytes; // Loaded textures, including the area of packed ones within their page.
+		size_t evictedBytes; // Unloaded by `updateTextureResidency` so far.
+		size_t nbOfEvictedTextures; // Unloaded by `updateTextureResidency` so far.
+	};
+
+	/**
+	 * \brief Sets the maximum graphical memory that loaded textures should use.
+	 * \complexity O(1).
+	 *
+	 * The budget is enforced by `updateTextureResidency`. There is none by default.
+	 *
+	 * \param[in] byteBudget The maximum number of bytes (4 bytes per pixel).
+	 *
+	 * \see `updateTextureResidency`.
+	 */
+	static void setTextureBudget(size_t byteBudget) noexcept;
+
+	/**
+	 * \brief Starts a new frame, and unloads textures while the memory exceeds the budget.
+	 * \complexity O(T), where T is the number of textures, if the memory is within the budget.
+	 * \complexity O(T * log(T)), otherwise.
+	 *
+	 * It should be called once per frame, on the render thread. Each texture remembers the frame it
+	 * was last displayed during. When over budget, textures that no sprite refers to are unloaded first,
+	 * then the least recently displayed ones. Evicted textures are reloaded transparently when a
+	 * sprite switches to them again (see `switchToNextTexture`).
+	 *
+	 * Only textures with a file path can be evicted. Textures currently displayed by a sprite, and
+	 * packed textures, are never evicted.
+	 *
+	 * \return The number of textures unloaded.
+	 *
+	 * \see `setTextureBudget`, `getTextureMemoryStats`, `unloadTexture`.
+	 */
+	static size_t updateTextureResidency() noexcept;
+
+	/**
+	 * \brief Returns the graphical memory used by all textures, and how much was evicted so far.
+	 * \complexity O(T), where T is the number of textures.
+	 *
+	 * \see `updateTextureResidency`.
+	 */
+	[[nodiscard]] static TextureMemoryStats getTextureMemoryStats() noexcept;
+
+	/**
+	 * \brief Returns the number of entries within the texture vectors of all sprites that refer
+	 *		  to a texture.
+	 * \complexity O(1).
+	 *
+	 * \param[in] name The alias of the texture.
+	 *
+	 * \return The number of references, or 0 if the texture does not exist.
+	 */
+	[[nodiscard]] static std::uint32_t getTextureReferenceCount(std::string_view name) noexcept;
+
+	/**
+	 * \brief Returns a counter that is incremented each time sprites awaiting a texture receive it.
+	 * \complexity O(1).
+	 *
+	 * Anything caching the look of such sprites, like a `StaticLayer`, should render them again.
+	 *
+	 * \see `isAwaitingTexture`, `loadTextureAsync`.
+	 */
+	[[nodiscard]] static std::uint32_t getTextureUploadCount() noexcept;
+
+	/**
+	 * \brief Tells if the sprite waits for a texture being decoded, and displays its previous one meanwhile.
+	 * \complexity O(1).
+	 *
+	 * \see `getTextureUploadCount`.
+	 */
+	[[nodiscard]] inline bool isAwaitingTexture() const noexcept
+	{
+		return m_awaitedTexture != nullptr;
+	}
+
+	/**
+	 * \brief Finds the name of a texture from its address.
+	 * \complexity O(1) if the same area of the texture was found by a previous call, O(T) otherwise,
+	 *			   where T is the number of textures.
+	 *
+	 * Along with the name, returns the generation of the texture: a number given when the texture was
+	 * created, never reused within the `ResourceContext`. Hence, a texture removed and then created
+	 * again under the same name, or at the same address, is not mistaken for the former one.
+	 *
+	 * \param[in] texture The address of the texture, as returned by `getTexture`.
+	 * \param[in] area The part of the texture that is displayed. Tells apart the textures packed into
+	 *			  the same atlas page.
+	 *
+	 * \return The name and the generation of the texture, or nullopt if it is not registered.
+	 *
+	 * \see `createSharedTextureFromDrawables`.
+	 */
+	[[nodiscard]] static std::optional<std::pair<std::string_view, std::uint64_t>> findTexture(const sf::Texture* texture, sf::IntRect area) noexcept;
+
 private:
 
 	/**
@@ -1007,6 +1971,8 @@ private:
 	 * The pointer to the texture allows the user to have it set to nullptr to free memory whenever he
 	 * wants to reduce memory usage. The file name contains the name of the file where the texture is
 	 * stored, within the assets folder.
+	 * If the texture was packed into an atlas, the pointer is nullptr and the texture is located in
+	 * the page instead.
 	 *
 	 * \note You should not unload a texture that has no file name attached to it, as it might be not
 	 *		 loadable after.
@@ -1017,6 +1983,14 @@ private:
 	{
 		std::unique_ptr<sf::Texture> actualTexture;
 		std::string fileName;
+		std::shared_ptr<const AssetPack> pack{}; // If not null, the file name is the name of the entry within this pack.
+		sf::Texture* atlasPage{ nullptr }; // Non null if the texture was packed into an atlas page.
+		sf::IntRect atlasRect{}; // The area of the texture within its page.
+		bool reserved{ false }; // Reserved textures are never packed.
+		std::uint32_t references{ 0 }; // The number of entries within texture vectors that refer to it.
+		std::uint32_t displayCount{ 0 }; // The number of sprites displaying it. Never evicted if not 0.
+		std::uint64_t lastUsedFrame{ 0 }; // The last frame it was displayed during.
+		std::uint64_t generation{ 0 }; // Never reused within the registry: identifies the texture even once its name or address is reused.
 	};
 
 	/**
@@ -1032,28 +2006,228 @@ private:
 	};
 
 
+	/**
+	 * \brief Is sent by a worker thread once a file was decoded.
+	 *
+	 * The holder is only compared to the pending tickets, never dereferenced, unless the ticket still
+	 * matches: the texture might have been removed in the meantime.
+	 */
+	struct StreamedImage
+	{
+		TextureHolder* holder{ nullptr };
+		std::uint64_t ticket{ 0 };
+		std::optional<sf::Image> image{};
+	};
+
+	/**
+	 * \brief The files decoded by the workers, not uploaded yet.
+	 *
+	 * Shared with the workers, so that a context can be destroyed while its files are being decoded.
+	 */
+	struct StreamedImages
+	{
+		std::deque<StreamedImage> images{};
+		std::mutex mutex{}; // Protects the images, which are filled by the workers.
+		std::condition_variable imageReady{}; // Notified by the workers, for `finishPreloading`.
+	};
+
+	/**
+	 * \brief The area of a texture displayed by a drawable. Tells apart the textures of an atlas page.
+	 */
+	struct TextureArea
+	{
+		const sf::Texture* texture;
+		sf::Vector2i position;
+
+		[[nodiscard]] constexpr bool operator==(const TextureArea&) const noexcept = default;
+	};
+
+	/**
+	 * \brief Hashes a `TextureArea`.
+	 */
+	struct TextureAreaHash
+	{
+		[[nodiscard]] inline size_t operator()(const TextureArea& area) const noexcept
+		{
+			const std::uint64_t position{ (static_cast<std::uint64_t>(static_cast<std::uint32_t>(area.position.x)) << 32) | static_cast<std::uint32_t>(area.position.y) };
+			return std::hash<const sf::Texture*>{}(area.texture) ^ std::hash<std::uint64_t>{}(position * 0x9e3779b97f4a7c15ull);
+		}
+	};
+
+	/**
+	 * \brief The textures of a `ResourceContext`, and what is needed to pack, stream and evict them.
+	 */
+	struct TextureRegistry
+	{
+		SlotMap<TextureHolder> allTextures{}; // Loaded or not. They never move: sprites keep a pointer to their textures.
+		FlatMap<std::string, SlotMap<TextureHolder>::Key, TransparentHash, TransparentEqual> accessToTextures{}; // Maps identifiers to textures.
+#ifndef NDEBUG
+		std::unordered_map<TextureHolder*, bool> allUniqueTextures{}; // Textures that can be used just once by a single instance.
+#else // NDEBUG
+		std::unordered_set<TextureHolder*> allUniqueTextures{}; // Textures that can be used just once by a single instance.
+#endif // NDEBUG
+
+		TextureAtlas atlas{}; // Packs shared textures into a few large pages, when enabled.
+		bool isAtlasEnabled{ false }; // If true, shared textures are packed when they are created or loaded.
+
+		std::uint64_t nbOfCreatedTextures{ 0 }; // Gives its generation to each new texture.
+		std::unordered_map<TextureArea, std::pair<std::string, SlotMap<TextureHolder>::Key>, TextureAreaHash> namesOfTextures{}; // Filled by `findTexture`. Checked against the holder before being trusted.
+
+		std::unordered_map<TextureHolder*, std::uint64_t> streamingTickets{}; // The ticket of each texture being decoded.
+		std::uint64_t lastStreamingTicket{ 0 }; // Tickets are never reused, even if a holder address is.
+		std::unordered_map<TextureHolder*, std::vector<SpriteWrapper*>> spritesAwaitingTexture{}; // They display their previous texture until the upload.
+		std::uint32_t nbOfTextureUploads{ 0 }; // Incremented each time awaiting sprites receive their texture.
+		std::shared_ptr<StreamedImages> streamedImages{ std::make_shared<StreamedImages>() };
+
+		std::unordered_set<TextureHolder*> preloadingTextures{}; // Requested by a preload, not done yet.
+		size_t nbOfPreloadedTextures{ 0 }; // Requested since the previous preload was done.
+		size_t nbOfPreloadFailures{ 0 }; // Failed since the previous preload was done.
+
+		size_t textureBudget{ std::numeric_limits<size_t>::max() }; // Enforced by `updateTextureResidency`.
+		std::uint64_t currentFrame{ 0 }; // Incremented by each call of `updateTextureResidency`.
+		size_t evictedBytes{ 0 }; // The memory evicted so far.
+		size_t nbOfEvictedTextures{ 0 }; // The number of textures evicted so far.
+
+		std::mutex mutex{}; // Locked while sprites switch textures: sprites of different windows can be animated by different threads.
+	};
+
+	friend class ResourceContext;
+
+
+	/**
+	 * \brief Returns the textures of the `ResourceContext` of the calling thread.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] static TextureRegistry& currentRegistry() noexcept;
+
+	/**
+	 * \brief Moves the texture of the holder into an atlas page, if the atlas is enabled.
+	 * \complexity O(P * S), see `TextureAtlas::insert`.
+	 *
+	 * \param[in,out] registry The textures the holder belongs to.
+	 * \param[in,out] holder The holder of a loaded texture.
+	 *
+	 * \return `true` if the texture was packed, `false` if it keeps its own texture.
+	 */
+	static bool packIntoAtlas(TextureRegistry& registry, TextureHolder& holder) noexcept;
+
+	/**
+	 * \brief Adds a texture to the store.
+	 * \complexity Amortized O(1).
+	 *
+	 * \param[in,out] registry The store.
+	 * \param[in] name The name of the texture, which does not exist yet.
+	 * \param[in] holder The texture, loaded or not.
+	 *
+	 * \return The stored texture, which never moves until it is removed.
+	 */
+	static TextureHolder& registerTexture(TextureRegistry& registry, std::string name, TextureHolder holder) noexcept;
+
+	/**
+	 * \brief Loads the texture of a holder from its file, or from its pack entry.
+	 * \complexity O(1).
+	 *
+	 * \param[out] errorMessage Will add the error message to this stream if the loading fails.
+	 * \param[in] holder The holder, with a file name.
+	 *
+	 * \return a sf::Texture if the loading was successful, std::nullopt otherwise.
+	 */
+	[[nodiscard]] static std::optional<sf::Texture> loadHolderTexture(std::ostringstream& errorMessage, const TextureHolder& holder) noexcept;
+
+	/**
+	 * \brief Queues the decoding of a texture, unless it is loaded or already being decoded.
+	 * \complexity O(1).
+	 *
+	 * \return `false` if the texture has no file path.
+	 */
+	static bool requestStreaming(TextureRegistry& registry, TextureHolder& holder) noexcept;
+
+	/**
+	 * \brief Starts decoding a texture, and accounts for it in the progress of the preload.
+	 * \complexity O(1).
+	 *
+	 * \return `true` if the texture is being decoded.
+	 */
+	static bool requestPreloading(TextureRegistry& registry, TextureHolder& holder) noexcept;
+
+	/**
+	 * \brief Packs a texture that was just loaded, and updates the sprites that were waiting for it.
+	 * \complexity O(N), where N is the number of sprites waiting for the texture.
+	 */
+	static void onTextureLoaded(TextureRegistry& registry, TextureHolder& holder) noexcept;
+
+	/**
+	 * \brief Discards the background loading of a texture. The sprites waiting for it stop waiting.
+	 * \complexity O(N), where N is the number of sprites waiting for the texture.
+	 */
+	static void cancelStreaming(TextureRegistry& registry, TextureHolder* holder) noexcept;
+
+	/**
+	 * \brief Changes the texture this sprite is waiting for.
+	 * \complexity O(N), where N is the number of sprites waiting for the previous texture.
+	 *
+	 * \param[in] holder The texture being decoded, or nullptr to stop waiting.
+	 */
+	void awaitTexture(TextureHolder* holder) noexcept;
+
+	/**
+	 * \brief Replaces a sprite by another one within the sprites waiting for a texture, after a move.
+	 * \complexity O(N), where N is the number of sprites waiting for the texture.
+	 */
+	static void replaceAwaitingSprite(TextureRegistry& registry, TextureHolder* holder, const SpriteWrapper* previous, SpriteWrapper* current) noexcept;
+
+	/**
+	 * \brief Changes the texture this sprite is accounted as displaying.
+	 * \complexity O(1).
+	 *
+	 * \param[in] holder The texture now displayed, or nullptr.
+	 */
+	void displayTexture(TextureHolder* holder) noexcept;
+
+	/**
+	 * \brief Displays the entry of the texture vector at the current index, loading it if needed.
+	 * \complexity O(1).
+	 *
+	 * \note The mutex of the registry must be locked by the caller, unless no other thread can switch
+	 *		 textures meanwhile.
+	 *
+	 * \throw LoadingGraphicalResourceFailure strong exception guarantee: nothing happens.
+	 */
+	void applyCurrentTexture();
+
+	/**
+	 * \brief Returns the graphical memory used by a texture, 4 bytes per pixel.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] static size_t computeTextureBytes(const TextureHolder& holder) noexcept;
+
+	/**
+	 * \see `TransformableWrapper::computeGlobalBounds`.
+	 */
+	[[nodiscard]] inline virtual sf::FloatRect computeGlobalBounds() const noexcept final
+	{
+		return m_wrappedSprite.getGlobalBounds();
+	}
+
+
 	/// What `sf::Sprite` the wrapper is being used for.
 	sf::Sprite m_wrappedSprite;
 
 	/// The current index within the texture vector.
 	size_t m_curTextureIndex; 
 	/// All textures used by the sprite.
-	std::vector<TextureInfo> m_textures;
+	ArenaVector<TextureInfo> m_textures;
 
 	/// Contains the name of all reserved textures used by this sprite.
-	std::vector<std::string> m_uniqueTextures;
+	ArenaVector<ArenaString> m_uniqueTextures;
 
-	/// Contains all textures, whether they are used or not/loaded or not.
-	inline static std::list<TextureHolder> s_allTextures{};
-	/// Maps identifiers to textures for quick access.
-	inline static std::unordered_map<std::string, std::list<TextureHolder>::iterator, TransparentHash, TransparentEqual> s_accessToTextures{};
-#ifndef NDEBUG
-	/// Textures that can be used just once by a single instance.
-	inline static std::unordered_map<TextureHolder*, bool> s_allUniqueTextures{};
-#else // NDEBUG
-	/// Textures that can be used just once by a single instance.
-	inline static std::unordered_set<TextureHolder*> s_allUniqueTextures{};
-#endif // NDEBUG
+	/// The texture being decoded that should be displayed once uploaded, or nullptr.
+	TextureHolder* m_awaitedTexture;
+	/// The texture currently displayed, accounted for by the residency, or nullptr.
+	TextureHolder* m_displayedTexture;
+
+	/// The textures of the context the sprite was created within.
+	TextureRegistry* m_registry;
 
 	/// A default texture that is used to initialize the `sf::Sprite` before setting its actual texture.
 	inline static const sf::Texture s_defaultTexture{}; 
@@ -1134,6 +2308,22 @@ private:
  */
 [[nodiscard]] std::optional<sf::Texture> loadTextureFromFile(std::ostringstream& errorMessage, std::string_view fileName, std::string_view path = "../assets/") noexcept;
 
+/**
+ * \brief Decodes an image from a file, without creating any graphical resource.
+ * \complexity O(1).
+ *
+ * \param[out] errorMessage: Will add the error message to this stream if the loading fails
+ * \param[in]  fileName: The name of the file.
+ * \param[in]  path: The path to this file.
+ *
+ * \return a sf::Image if the loading was successful, std::nullopt otherwise.
+ *
+ * \note Unlike `loadTextureFromFile`, it can be called from any thread.
+ *
+ * \see `loadTextureFromFile`, `SpriteWrapper::loadTextureAsync`.
+ */
+[[nodiscard]] std::optional<sf::Image> loadImageFromFile(std::ostringstream& errorMessage, std::string_view fileName, std::string_view path = "../assets/") noexcept;
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 /// A `sf::Sprite` wrapper.
 ///////////////////////////////////////////////////////////////////////////////////////////////////
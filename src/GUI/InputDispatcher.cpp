@@ -0,0 +1,124 @@
+#include "InputDispatcher.hpp"
+
+namespace gui
+{
+
+bool InputDispatcher::handleEvent(const sf::Event& event)
+{
+	if (const auto* const moved{ event.getIf<sf::Event::MouseMoved>() }) [[likely]]
+	{
+		const sf::Vector2f position{ m_window->mapPixelToCoords(moved->position) };
+		if (!m_isHeld)
+			queueHover(position);
+
+		m_cursorPos = position;
+		m_hasCursorMoved = true;
+		return true;
+	}
+
+	if (const auto* const pressed{ event.getIf<sf::Event::MouseButtonPressed>() }; pressed != nullptr && pressed->button == sf::Mouse::Button::Left)
+	{
+		queuePress(m_window->mapPixelToCoords(pressed->position));
+		m_isHeld = true;
+		return true;
+	}
+
+	if (const auto* const released{ event.getIf<sf::Event::MouseButtonReleased>() }; released != nullptr && released->button == sf::Mouse::Button::Left)
+	{
+		queueHover(m_window->mapPixelToCoords(released->position));
+		m_isHeld = false;
+		return true;
+	}
+
+	// Touches of the first finger behave like the left button.
+	if (const auto* const began{ event.getIf<sf::Event::TouchBegan>() }; began != nullptr && began->finger == 0)
+	{
+		m_cursorPos = m_window->mapPixelToCoords(began->position);
+		queuePress(m_cursorPos);
+		m_hasCursorMoved = true;
+		m_isHeld = true;
+		return true;
+	}
+
+	if (const auto* const touchMoved{ event.getIf<sf::Event::TouchMoved>() }; touchMoved != nullptr && touchMoved->finger == 0)
+	{
+		m_cursorPos = m_window->mapPixelToCoords(touchMoved->position);
+		m_hasCursorMoved = true;
+		return true;
+	}
+
+	if (const auto* const ended{ event.getIf<sf::Event::TouchEnded>() }; ended != nullptr && ended->finger == 0)
+	{
+		queueHover(m_window->mapPixelToCoords(ended->position));
+		m_isHeld = false;
+		return true;
+	}
+
+	return false;
+}
+
+InteractiveInterface::Item InputDispatcher::dispatch(InteractiveInterface* gui) noexcept
+{
+	if (gui == nullptr) [[unlikely]]
+	{
+		clear();
+		return InteractiveInterface::Item{};
+	}
+
+	size_t nbOfPresses{ 0 };
+	for (const Action& action : m_actions)
+	{
+		const InteractiveInterface::Item item{ gui->eventUpdateHovered(action.position) };
+		if (action.isPress)
+			m_pressedItems[nbOfPresses++] = item;
+	}
+
+	// The functions are called once all queries are done. They may modify the interface: the buttons
+	// are found again from the handles of the items, which ignores the removed ones.
+	for (const InteractiveInterface::Item& item : m_pressedItems)
+		gui->eventPressed(item);
+
+	clear();
+	return gui->getHoveredItem();
+}
+
+void InputDispatcher::clear() noexcept
+{
+	m_actions.clear(); // Keeps the capacity for the next frames.
+	m_pressedItems.clear();
+	m_hasCursorMoved = false;
+}
+
+void InputDispatcher::queueHover(sf::Vector2f position)
+{
+	if (!m_actions.empty() && !m_actions.back().isPress)
+	{	// Coalesced: the previous position is never seen by the user.
+		m_actions.back().position = position;
+		return;
+	}
+
+	m_actions.push_back(Action{ position, false });
+}
+
+void InputDispatcher::queuePress(sf::Vector2f position)
+{
+	m_pressedItems.emplace_back();
+
+	if (!m_actions.empty() && !m_actions.back().isPress)
+	{	// The press queries its own position.
+		m_actions.back() = Action{ position, true };
+		return;
+	}
+
+	try
+	{
+		m_actions.push_back(Action{ position, true });
+	}
+	catch (...)
+	{
+		m_pressedItems.pop_back();
+		throw;
+	}
+}
+
+} // gui namespace
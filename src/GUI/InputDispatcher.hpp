@@ -0,0 +1,196 @@
+/*******************************************************************
+ * \file   InputDispatcher.hpp, InputDispatcher.cpp
+ * \brief  Declare a dispatcher that collects the pointer events of a frame, and forwards them to an
+ *		   interactive interface at once.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note These files depend on the SFML library.
+ * \note All assertions are disabled in release mode. If broken, undefined behavior will occur.
+ *********************************************************************/
+
+#ifndef INPUTDISPATCHER_HPP
+#define INPUTDISPATCHER_HPP
+
+#include "InteractiveInterface.hpp"
+#include <SFML/Graphics.hpp>
+#include <optional>
+#include <vector>
+
+namespace gui
+{
+
+/**
+ * \brief Collects the mouse and touch events of a frame, and replays them on an interface once the
+ *		  events are polled: one hover query per burst of moves, and the buttons pressed in order.
+ *
+ * Calling `eventUpdateHovered` for each `sf::Event::MouseMoved` event queries the interface as many
+ * times as the mouse reports its position, which can be several times per frame for high polling
+ * rate mice, while only the last position is seen by the user. Instead, the events are given to
+ * `handleEvent` within the poll loop, and `dispatch` is called once after it:
+ *
+ * - Consecutive moves are coalesced: only the latest position is queried.
+ * - A press queries the position of the press itself, then presses the hovered item. Presses and
+ *	 releases are replayed in the order they happened, each with the moves in between: a click on a
+ *	 button and a click on another one within the same frame both reach their button.
+ * - While the left button is held, moves do not change the hovered item, like in the examples, so
+ *	 that sliders keep being dragged when the cursor leaves them. The release queries its position.
+ * - The button functions are all called after the queries, in the order of the presses.
+ *
+ * The first finger of touch screens goes through the same path as the left button: a touch began
+ * is a press, a touch moved is a move while held, and a touch ended is a release.
+ *
+ * \note Events are replayed on the interface given to `dispatch`, even if a button function switched
+ *		 to another one: the events of a frame are only dispatched to one interface.
+ * \warning The window must outlive the dispatcher.
+ *
+ * \code
+ * gui::InputDispatcher input{ &window };
+ *
+ * while (window.isOpen())
+ * {
+ *		while (const std::optional event = window.pollEvent())
+ *		{
+ *			if (event->is<sf::Event::Closed>())
+ *				window.close();
+ *			else
+ *				input.handleEvent(*event);
+ *		}
+ *
+ *		currentItem = input.dispatch(currentInterface); // The hovered item, once the buttons are called.
+ *		// ...
+ * }
+ * \endcode
+ *
+ * \see `InteractiveInterface::eventUpdateHovered`, `InteractiveInterface::eventPressed`.
+ */
+class InputDispatcher
+{
+public:
+
+	/**
+	 * \brief Constructs a dispatcher without events.
+	 * \complexity O(1).
+	 *
+	 * \param[in] window The window the events come from, whose view maps them to world coordinates.
+	 *
+	 * \pre The window must be a valid ptr.
+	 * \warning The program will assert otherwise.
+	 */
+	inline explicit InputDispatcher(const sf::RenderWindow* window) noexcept
+		: m_window{ window }, m_actions{}, m_pressedItems{}, m_cursorPos{}, m_hasCursorMoved{ false }, m_isHeld{ false }
+	{
+		ENSURE_VALID_PTR(window, "The window was nullptr when the constructor of InputDispatcher was called");
+	}
+
+	InputDispatcher(const InputDispatcher&) noexcept = delete;
+	InputDispatcher(InputDispatcher&&) noexcept = default;
+	InputDispatcher& operator=(const InputDispatcher&) noexcept = delete;
+	InputDispatcher& operator=(InputDispatcher&&) noexcept = default;
+	~InputDispatcher() noexcept = default;
+
+
+	/**
+	 * \brief Records a pointer event, until the next `dispatch`.
+	 * \complexity Amortized O(1).
+	 *
+	 * Handles mouse moves, the presses and releases of the left button, and the touch events of the
+	 * first finger. Other events are ignored.
+	 *
+	 * \param[in] event The event polled from the window.
+	 *
+	 * \return True if the event is a pointer event that was recorded.
+	 *
+	 * \throw std::bad_alloc. Strong exception guarantee.
+	 */
+	bool handleEvent(const sf::Event& event);
+
+	/**
+	 * \brief Replays the recorded events on an interface, then calls the functions of the pressed
+	 *		  buttons.
+	 * \complexity O(E x H + B), where E is the number of recorded queries, H the complexity of
+	 *			   `eventUpdateHovered` and B the complexity of the button functions.
+	 *
+	 * The recorded events are cleared, even if the interface is nullptr.
+	 *
+	 * \param[in,out] gui The interface the events are replayed on. Can be nullptr, if the current
+	 *				  interface is not interactive.
+	 *
+	 * \return The item hovered in the interface once the buttons are called, or an empty one if the
+	 *		   interface is nullptr.
+	 */
+	InteractiveInterface::Item dispatch(InteractiveInterface* gui) noexcept;
+
+	/**
+	 * \brief Drops the recorded events, without replaying them.
+	 * \complexity O(1).
+	 */
+	void clear() noexcept;
+
+	/**
+	 * \brief Returns the latest position the cursor moved to since the previous `dispatch`, even while
+	 *		  the left button is held, or nothing if it did not move.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline std::optional<sf::Vector2f> getCursorMove() const noexcept
+	{
+		return m_hasCursorMoved ? std::optional<sf::Vector2f>{ m_cursorPos } : std::nullopt;
+	}
+
+	/**
+	 * \brief Returns the number of hover queries the next `dispatch` will run.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t getNbOfPendingQueries() const noexcept
+	{
+		return m_actions.size();
+	}
+
+private:
+
+	/**
+	 * \brief A hover query, and whether the hovered item is pressed afterward.
+	 */
+	struct Action
+	{
+		sf::Vector2f position;
+		bool isPress;
+	};
+
+	/**
+	 * \brief Records a hover query at a position, replacing the previous one if nothing happened in
+	 *		  between.
+	 * \complexity Amortized O(1).
+	 *
+	 * \throw std::bad_alloc. Strong exception guarantee.
+	 */
+	void queueHover(sf::Vector2f position);
+
+	/**
+	 * \brief Records a press at a position, which replaces the previous hover query if nothing happened
+	 *		  in between.
+	 * \complexity Amortized O(1).
+	 *
+	 * \throw std::bad_alloc. Strong exception guarantee.
+	 */
+	void queuePress(sf::Vector2f position);
+
+
+	/// The window the events come from.
+	const sf::RenderWindow* m_window;
+	/// The recorded queries, in order. Never two hover queries in a row.
+	std::vector<Action> m_actions;
+	/// One item per recorded press, written by `dispatch`: allocated with the press, so that `dispatch` never allocates.
+	std::vector<InteractiveInterface::Item> m_pressedItems;
+	/// The latest position of the cursor, in world coordinates.
+	sf::Vector2f m_cursorPos;
+	/// If true, the cursor moved since the previous `dispatch`.
+	bool m_hasCursorMoved;
+	/// If true, the left button, or the first finger, is held.
+	bool m_isHeld;
+};
+
+} // gui namespace
+
+#endif // INPUTDISPATCHER_HPP
@@ -10,24 +10,35 @@ void InteractiveInterface::removeDynamicText(std::string_view identifier) noexce
 	if (mapIterator == m_dynamicTexts.end())
 		return; // No text with that identifier.
 
-	const size_t index{ mapIterator->second };
+	const ElementKey key{ mapIterator->second };
+	const size_t index{ m_textElements[key].index };
+	const bool isInteractive{ index < m_nbOfButtonTexts };
+	// Found before the removal: `identifier` may view the identifier stored by the interface.
+	const auto buttonIterator{ isInteractive ? m_allButtons.find(identifier) : m_allButtons.end() };
+
+	if (m_hoveredItem.text == toHandle<TextWrapper>(key))
+		m_hoveredItem = Item{};
 
 	MutableInterface::removeDynamicText(identifier);
 
-	if (index >= m_nbOfButtonTexts) // Not an interactive text.
+	if (!isInteractive) // Not an interactive text.
 		return;
 
+	m_buttonsOfTextHandles[key.slot] = nullptr;
+
 	// If an interactive is removed, and since there is a swap with the last element, 
 	// the remaining interactives are not continuous anymore. The element with which the
 	// interactive was swapped is now in the middle of the interactive part.
 
 	--m_nbOfButtonTexts;
 	if (m_nbOfButtonTexts < m_texts.size()) // If this is false, it means there is only interactives in the interface - no hole to fix
-		swapElement(index, m_nbOfButtonTexts, m_texts, m_dynamicTexts, m_indexesForEachDynamicTexts); // Guaranteeing the contiguity of interactive texts. 
+		swapElement(index, m_nbOfButtonTexts, m_texts, m_textElements, m_indexesForEachDynamicTexts); // Guaranteeing the contiguity of interactive texts. 
 
-	auto buttonIterator{ m_allButtons.find(identifier) };
-	if ((--buttonIterator->second.second) <= 0) // If a sprite has the same identifier and is interactive, it would be equal to 1.
+	if ((--m_buttons[buttonIterator->second].second) <= 0) // If a sprite has the same identifier and is interactive, it would be equal to 1.
+	{
+		m_buttons.erase(buttonIterator->second);
 		m_allButtons.erase(buttonIterator);
+	}
 }
 
 void InteractiveInterface::removeDynamicSprite(std::string_view identifier) noexcept
@@ -37,24 +48,35 @@ void InteractiveInterface::removeDynamicSprite(std::string_view identifier) noex
 	if (mapIterator == m_dynamicSprites.end())
 		return; // No sprite with that identifier.
 
-	const size_t index{ mapIterator->second };
+	const ElementKey key{ mapIterator->second };
+	const size_t index{ m_spriteElements[key].index };
+	const bool isInteractive{ index < m_nbOfButtonSprites };
+	// Found before the removal: `identifier` may view the identifier stored by the interface.
+	const auto buttonIterator{ isInteractive ? m_allButtons.find(identifier) : m_allButtons.end() };
+
+	if (m_hoveredItem.sprite == toHandle<SpriteWrapper>(key))
+		m_hoveredItem = Item{};
 
 	MutableInterface::removeDynamicSprite(identifier);
 
-	if (index >= m_nbOfButtonSprites) // Not an interactive sprite.
+	if (!isInteractive) // Not an interactive sprite.
 		return;
 
+	m_buttonsOfSpriteHandles[key.slot] = nullptr;
+
 	// If an interactive is removed, and since there is a swap with the last element, 
 	// the remaining interactives are not continuous anymore. The element with which the
 	// interactive was swapped is now in the middle of the interactive part.
 
 	--m_nbOfButtonSprites;
 	if (m_nbOfButtonSprites < m_sprites.size()) // If this is false, it means there is only interactives in the interface - no hole to fix
-		swapElement(index, m_nbOfButtonSprites, m_sprites, m_dynamicSprites, m_indexesForEachDynamicSprites); // Guaranteeing the contiguity of interactive sprites. 
+		swapElement(index, m_nbOfButtonSprites, m_sprites, m_spriteElements, m_indexesForEachDynamicSprites); // Guaranteeing the contiguity of interactive sprites. 
 
-	auto buttonIterator{ m_allButtons.find(identifier) };
-	if ((--buttonIterator->second.second) <= 0) // If a text has the same identifier and is interactive, it would be equal to 1.
+	if ((--m_buttons[buttonIterator->second].second) <= 0) // If a text has the same identifier and is interactive, it would be equal to 1.
+	{
+		m_buttons.erase(buttonIterator->second);
 		m_allButtons.erase(buttonIterator);
+	}
 }
 
 void InteractiveInterface::addInteractive(std::string identifier, ButtonFunction function) noexcept
@@ -70,29 +92,89 @@ void InteractiveInterface::addInteractive(std::string identifier, ButtonFunction
 	if (!doesTextExist && !doesSpriteExist)
 		return;
 
-	// The check "textIterator->second >= m_nb" verifies if the text is not already an interactive.
+	// The check "index >= m_nb" verifies if the text is not already an interactive.
 	// We guarantee that all interactive elements are at the beginning of the vector by swapping with the
 	// element at index m_nbOfButtonTexts, before adding one to report the new number of interactive texts.
-	if (doesTextExist && textIterator->second >= m_nbOfButtonTexts)
-		swapElement(textIterator->second, m_nbOfButtonTexts++, m_texts, m_dynamicTexts, m_indexesForEachDynamicTexts); // Swapping asserts if the interface is locked
+	if (doesTextExist && m_textElements[textIterator->second].index >= m_nbOfButtonTexts)
+		swapElement(m_textElements[textIterator->second].index, m_nbOfButtonTexts++, m_texts, m_textElements, m_indexesForEachDynamicTexts); // Swapping asserts if the interface is locked
 
 	// Same goes here
-	if (doesSpriteExist && spriteIterator->second >= m_nbOfButtonSprites)
-		swapElement(spriteIterator->second, m_nbOfButtonSprites++, m_sprites, m_dynamicSprites, m_indexesForEachDynamicSprites);
+	if (doesSpriteExist && m_spriteElements[spriteIterator->second].index >= m_nbOfButtonSprites)
+		swapElement(m_spriteElements[spriteIterator->second].index, m_nbOfButtonSprites++, m_sprites, m_spriteElements, m_indexesForEachDynamicSprites);
 	
 	short elemsThatUseFunction{ static_cast<short>(doesSpriteExist) + static_cast<short>(doesTextExist) };
-	m_allButtons.insert_or_assign(std::move(identifier), std::make_pair(std::move(function), elemsThatUseFunction));
+	ButtonElement* button{ nullptr };
+
+	if (const auto buttonIterator{ m_allButtons.find(identifier) }; buttonIterator != m_allButtons.end())
+	{
+		button = &m_buttons[buttonIterator->second];
+		*button = std::make_pair(std::move(function), elemsThatUseFunction);
+	}
+	else
+	{
+		const auto buttonKey{ m_buttons.emplace(std::move(function), elemsThatUseFunction) };
+		m_allButtons.try_emplace(std::move(identifier), buttonKey);
+		button = &m_buttons[buttonKey];
+	}
+
+	// Buttons are never moved, so they are dispatched without hashing.
+	if (doesTextExist)
+	{
+		const std::uint32_t slot{ textIterator->second.slot };
+		if (m_buttonsOfTextHandles.size() <= slot)
+			m_buttonsOfTextHandles.resize(m_textElements.capacity(), nullptr);
+		m_buttonsOfTextHandles[slot] = button;
+	}
+	if (doesSpriteExist)
+	{
+		const std::uint32_t slot{ spriteIterator->second.slot };
+		if (m_buttonsOfSpriteHandles.size() <= slot)
+			m_buttonsOfSpriteHandles.resize(m_spriteElements.capacity(), nullptr);
+		m_buttonsOfSpriteHandles[slot] = button;
+	}
 }
 
-void InteractiveInterface::lockInterface(bool shrinkToFit) noexcept
+void InteractiveInterface::lockInterface(bool shrinkToFit, bool batchedDrawing) noexcept
 {
-	BasicInterface::lockInterface(shrinkToFit);
+	BasicInterface::lockInterface(shrinkToFit, batchedDrawing);
 
 	// We don't clear 'm_indexesForEachDynamicTexts' and 'm_indexesForEachDynamicSprites' because we need them for interactives.
+	m_hoverGrid.build(m_texts, m_nbOfButtonTexts, m_sprites, m_nbOfButtonSprites, m_hiddenTexts.data(), m_hiddenSprites.data()); // After shrinking, elements won't move anymore.
+	m_hoveredItem = Item{}; // Its pointer was taken before shrinking, and is only trusted once locked.
+}
+
+InteractiveInterface::MQBHandle InteractiveInterface::addMQBState(std::string_view identifier, MQBState state) noexcept
+{
+	if (const auto iterator{ m_mqbsByIdentifier.find(identifier) }; iterator != m_mqbsByIdentifier.end())
+		return iterator->second;
+
+	const MQBHandle handle{ m_mqbs.emplace(std::move(state)) };
+	m_mqbsByIdentifier.try_emplace(identifier, handle);
+	return handle;
+}
+
+void InteractiveInterface::removeMQBState(std::string_view identifier) noexcept
+{
+	const auto iterator{ m_mqbsByIdentifier.find(identifier) };
+	if (iterator == m_mqbsByIdentifier.end())
+		return;
+
+	m_mqbs.erase(iterator->second);
+	m_mqbsByIdentifier.erase(iterator);
+}
+
+InteractiveInterface::MQBHandle InteractiveInterface::getMQBHandle(std::string_view identifier) const noexcept
+{
+	const auto iterator{ m_mqbsByIdentifier.find(identifier) };
+	return (iterator == m_mqbsByIdentifier.end()) ? MQBHandle{} : iterator->second;
 }
 
 InteractiveInterface::Item InteractiveInterface::eventUpdateHovered(sf::Vector2f cursorPos) noexcept
 {
+	PROFILE_SCOPE(hoverTime);
+	PROFILE_COUNT(hoverQueries, 1);
+	applyPendingResize(); // Hit tests need the current bounds.
+
 	// Chances are that the hovered item is the same as previously between one frame and the other.
 	// Therefore, we first check if the previously hovered item is still hovered.
 	// However, if the interface is not locked, we can't guarantee that the pointer is still valid,
@@ -100,19 +182,38 @@ InteractiveInterface::Item InteractiveInterface::eventUpdateHovered(sf::Vector2f
 	if (m_lockState && !std::holds_alternative<std::monostate>(m_hoveredItem.ptr))
 	{
 		bool holdText{ std::holds_alternative<TextWrapper*>(m_hoveredItem.ptr) }; // If false, it holds a SpriteWrapper*
-		if ((holdText && std::get<TextWrapper*>(m_hoveredItem.ptr)->getText().getGlobalBounds().contains(cursorPos)) // Almost guaranteed to not have cache misses
-		|| (!holdText && std::get<SpriteWrapper*>(m_hoveredItem.ptr)->getSprite().getGlobalBounds().contains(cursorPos))) [[likely]] // Most of the time, the same thing is hovered during the next frame.
+		if ((holdText && std::get<TextWrapper*>(m_hoveredItem.ptr)->getGlobalBounds().contains(cursorPos)) // Almost guaranteed to not have cache misses
+		|| (!holdText && std::get<SpriteWrapper*>(m_hoveredItem.ptr)->getGlobalBounds().contains(cursorPos))) [[likely]] // Most of the time, the same thing is hovered during the next frame.
+		{
+			PROFILE_COUNT(hoverCacheHits, 1);
 			goto endReturn; // Avoid multiple return statements 
+		}
 	}
 
 	m_hoveredItem = Item{};
 
+	if (m_lockState) [[likely]]
+	{	// Only the interactives close to the cursor are tested. Texts have the lowest slots, so they keep their priority.
+		const std::optional<size_t> slot{ m_hoverGrid.query(cursorPos) };
+
+		if (!slot.has_value())
+			goto endReturn;
+
+		if (slot.value() < m_nbOfButtonTexts)
+			m_hoveredItem = makeTextItem(slot.value());
+		else
+			m_hoveredItem = makeSpriteItem(slot.value() - m_nbOfButtonTexts);
+
+		goto endReturn;
+	}
+
 	for (size_t i{ 0 }; i < m_nbOfButtonTexts; ++i)
 	{
 		TextWrapper& text{ m_texts[i] };
-		if (!text.hide && text.getText().getGlobalBounds().contains(cursorPos)) [[unlikely]] // The vast majority of the time, no text is hovered.
+		PROFILE_COUNT(hoverScannedElements, 1);
+		if (!text.hide && text.getGlobalBounds().contains(cursorPos)) [[unlikely]] // The vast majority of the time, no text is hovered.
 		{	// getText() does not dereference a pointer, so no cache miss here.
-			m_hoveredItem = Item{ m_indexesForEachDynamicTexts.at(i)->first, &text };
+			m_hoveredItem = makeTextItem(i);
 			goto endReturn; // Avoid multiple return statements
 		}
 	}
@@ -120,9 +221,10 @@ InteractiveInterface::Item InteractiveInterface::eventUpdateHovered(sf::Vector2f
 	for (size_t i{ 0 }; i < m_nbOfButtonSprites; ++i)
 	{
 		SpriteWrapper& sprite{ m_sprites[i] }; 
-		if (!sprite.hide && sprite.getSprite().getGlobalBounds().contains(cursorPos)) [[unlikely]] // The vast majority of the time, no sprite is hovered.
+		PROFILE_COUNT(hoverScannedElements, 1);
+		if (!sprite.hide && sprite.getGlobalBounds().contains(cursorPos)) [[unlikely]] // The vast majority of the time, no sprite is hovered.
 		{	// getSprite() does not dereference a pointer, so no cache miss here.
-			m_hoveredItem = Item{ m_indexesForEachDynamicSprites.at(i)->first, &sprite };
+			m_hoveredItem = makeSpriteItem(i);
 			break;
 		}
 	}
@@ -133,12 +235,35 @@ endReturn:
 
 void InteractiveInterface::eventPressed() noexcept
 {
-	if (m_hoveredItem.identifier.empty())
-		return;
+	eventPressed(m_hoveredItem);
+}
+
+void InteractiveInterface::eventPressed(const Item& item) noexcept
+{
+	// The item may come from another interface, or hold a non-interactive element: its slot may have
+	// no button, or lie beyond the buttons, which only grow with the interactives.
+	ButtonElement* button{ nullptr };
+	if (m_textElements.get(toKey(item.text)) != nullptr && item.text.slot < m_buttonsOfTextHandles.size())
+		button = m_buttonsOfTextHandles[item.text.slot];
+	else if (m_spriteElements.get(toKey(item.sprite)) != nullptr && item.sprite.slot < m_buttonsOfSpriteHandles.size())
+		button = m_buttonsOfSpriteHandles[item.sprite.slot];
+
+	if (button != nullptr && button->first != nullptr)
+		button->first(this);
+}
+
+InteractiveInterface::Item InteractiveInterface::makeTextItem(size_t index) noexcept
+{
+	const ElementKey key{ m_indexesForEachDynamicTexts.find(index)->second }; // Interactives are always dynamic.
+
+	return Item{ m_textElements[key].identifier, toHandle<TextWrapper>(key), &m_texts[index] };
+}
+
+InteractiveInterface::Item InteractiveInterface::makeSpriteItem(size_t index) noexcept
+{
+	const ElementKey key{ m_indexesForEachDynamicSprites.find(index)->second }; // Interactives are always dynamic.
 
-	ButtonFunction* const buttonFunction{ &m_allButtons[m_hoveredItem.identifier].first };
-	if ((*buttonFunction) != nullptr)
-		(*buttonFunction)(this);
+	return Item{ m_spriteElements[key].identifier, toHandle<SpriteWrapper>(key), &m_sprites[index] };
 }
 
 } // gui namespace
\ No newline at end of file
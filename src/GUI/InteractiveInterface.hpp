@@ -12,12 +12,13 @@
 #define INTERACTIVEINTERFACE_HPP
 
 #include "MutableInterface.hpp"
+#include "SpatialGrid.hpp"
 #include <SFML/Graphics.hpp>
 #include <string>
 #include <string_view>
-#include <unordered_map>
 #include <variant>
 #include <functional>
+#include <vector>
 #include <cstdint>
 
 namespace gui
@@ -58,18 +59,21 @@ public:
 	{			
 	public:
 
-		std::string identifier; // The item that is hovered, either a text or a sprite.
+		std::string_view identifier; // The item that is hovered, either a text or a sprite.
+		// Views the identifier stored by the interface: invalidated once the element is removed.
+		TextHandle text; // The handle of the hovered text, null if a sprite is hovered.
+		SpriteHandle sprite; // The handle of the hovered sprite, null if a text is hovered.
 		std::variant<std::monostate, TextWrapper*, SpriteWrapper*> ptr; // A pointer to the actual transformable.
 		// Watch out if the interface is not locked, this pointer might be invalidated at any time.
 
-		constexpr Item(std::string id, SpriteWrapper* spritePtr) noexcept
-			: identifier{ id }, ptr{ spritePtr } {}
+		constexpr Item(std::string_view id, SpriteHandle handle, SpriteWrapper* spritePtr) noexcept
+			: identifier{ id }, text{}, sprite{ handle }, ptr{ spritePtr } {}
 
-		constexpr Item(std::string id, TextWrapper* textPtr) noexcept
-			: identifier{ id }, ptr{ textPtr } {}
+		constexpr Item(std::string_view id, TextHandle handle, TextWrapper* textPtr) noexcept
+			: identifier{ id }, text{ handle }, sprite{}, ptr{ textPtr } {}
 
 		constexpr Item() noexcept 
-			: identifier{ "" }, ptr{ std::monostate{} } {}
+			: identifier{}, text{}, sprite{}, ptr{ std::monostate{} } {}
 
 		constexpr Item(const Item& item) noexcept = default;
 		constexpr Item(Item&& item) noexcept = default;
@@ -78,6 +82,24 @@ public:
 		constexpr ~Item() noexcept = default;
 	};
 
+	/**
+	 * \brief The state of a multiple question box (see `addMQB`).
+	 *
+	 * Stored by the interface, so that checking a box or reading which ones are checked never looks
+	 * up the boxes with their identifiers.
+	 */
+	struct MQBState
+	{
+		std::vector<SpriteHandle> boxes; // The sprite of each box, in order.
+		std::vector<std::uint64_t> checkedBits; // One bit per box, set if it is checked.
+		unsigned short nbOfCheckedBoxes;
+		unsigned short checkedBox; // The last box checked, 1-indexed, if it still is; 0 otherwise. The only one if not multiple choices.
+		bool multipleChoices;
+		bool atLeastOne;
+	};
+
+	using MQBHandle = SlotMap<MQBState>::Key;
+
 
 	/**
 	 * \brief Constructs the graphical interface.
@@ -100,13 +122,15 @@ public:
 	 *			  - A window of size 7680x2160 (32/9) → factor = 1080/2160 = 2.0
 	 *
 	 *			  If set to 0, no scaling is applied regardless of the window size.
+	 * \param[in] resource Where the elements and their identifiers are allocated from. See
+	 *			  `BasicInterface::BasicInterface`.
 	 *
 	 * \pre `window` must be a valid.
 	 * \post An interface is constructed.
 	 * \warning The program will assert otherwise.
 	 */
-	inline explicit InteractiveInterface(sf::RenderWindow* window, unsigned int relativeScalingDefinition = 1080) noexcept
-		: MutableInterface{ window, relativeScalingDefinition }, m_hoveredItem{}, m_nbOfButtonTexts{}, m_nbOfButtonSprites{}, m_allButtons{}
+	inline explicit InteractiveInterface(sf::RenderWindow* window, unsigned int relativeScalingDefinition = 1080, std::pmr::memory_resource* resource = nullptr) noexcept
+		: MutableInterface{ window, relativeScalingDefinition, resource }, m_hoveredItem{}, m_nbOfButtonTexts{}, m_nbOfButtonSprites{}, m_buttons{ getMemoryResource() }, m_allButtons{ getMemoryResource() }, m_buttonsOfTextHandles{ getMemoryResource() }, m_buttonsOfSpriteHandles{ getMemoryResource() }, m_hoverGrid{}, m_mqbs{ getMemoryResource() }, m_mqbsByIdentifier{ getMemoryResource() }
 	{}
 
 	InteractiveInterface() noexcept = default;
@@ -145,6 +169,9 @@ public:
 	 */
 	virtual void removeDynamicSprite(std::string_view identifier) noexcept override;
 
+	using MutableInterface::removeDynamicText; // Removal with handles.
+	using MutableInterface::removeDynamicSprite;
+
 	/**
 	 * \brief Turns an existing transformable into an interactive element.
 	 * \complexity O(1)
@@ -177,6 +204,8 @@ public:
 	/**
 	 * \brief Updates the hovered element when the mouse mouve, if the gui is interactive.	 
 	 * \complexity O(1), if the interactive element stills contain the mouse the same as previously.
+	 * \complexity O(K), otherwise, if the interface is locked; where K is the number of interactive elements
+	 *			   close to the cursor (see `SpatialGrid`).
 	 * \complexity O(N), otherwise; where N is the number of interactive elements in your active interface.
 	 * 
 	 * You may choose not to update the hovered element on every mouse move—for example,
@@ -195,6 +224,7 @@ public:
 	 * \return The item that is currently hovered.
 	 * 
 	 * \note If there are no interactives, you don't have to call this function.
+	 * \note `InputDispatcher` calls it once per frame, instead of once per mouse move.
 	 */
 	Item eventUpdateHovered(sf::Vector2f cursorPos) noexcept;
 
@@ -205,11 +235,34 @@ public:
 	 * \note If there are no buttons, you don't have to call this function.
 	 */
 	void eventPressed() noexcept;
+
+	/**
+	 * \brief Activates the button of an item, if it is still in the interface.
+	 * \complexity O(1).
+	 *
+	 * The button is found from the handles of the item: the item can be one returned earlier by
+	 * `eventUpdateHovered`, even if elements were removed since.
+	 *
+	 * \param[in] item The item, typically hovered when the mouse was pressed.
+	 *
+	 * \see `InputDispatcher`, which presses the items of a frame at once.
+	 */
+	void eventPressed(const Item& item) noexcept;
+
+	/**
+	 * \brief Returns the item hovered during the last call to `eventUpdateHovered`.
+	 * \complexity O(1).
+	 *
+	 * \note The item is reset when its element is removed, or when the interface is locked.
+	 */
+	[[nodiscard]] inline const Item& getHoveredItem() const noexcept
+	{
+		return m_hoveredItem;
+	}
 	
 	/**
 	 * \brief Prevents any addition of new elements to the interface.
-	 * \complexity O(1) if shrinkToFit is false
-	 * \complexity O(N + M) otherwise. N is the number of texts and M the number of sprites.
+	 * \complexity O(N + M), where N is the number of texts and M the number of sprites.
 	 *
 	 * Once you have added all your elements, you can lock the interface to avoid futur modifications.
 	 * Contrary to MutableInterface and similar to BasicInterface, memory can only be reduced if
@@ -224,11 +277,60 @@ public:
 	 *
 	 * It helps with eventUpdateHovered() optimizations as well, as it can directly use the pointer of
 	 * the previously hovered element to check if the mouse is still over it, avoiding a full recheck.
+	 * Interactive elements are also indexed into a spatial grid, so that only the ones close to the
+	 * cursor are tested. The grid is updated whenever they are modified.
 	 *
 	 * \param[in] shrinkToFit If true, the function will call `shrink_to_fit` on both the texts and
 	 *						  sprites.
+	 * \param[in] batchedDrawing If true, `draw` groups the elements sharing a texture (or a font) into
+	 *							 cached vertex arrays. See `BasicInterface::lockInterface`.
+	 */
+	virtual void lockInterface(bool shrinkToFit = true, bool batchedDrawing = false) noexcept override;
+
+	/**
+	 * \brief Stores the state of a multiple question box. Nothing happens if it already exists.
+	 * \complexity Amortized O(1).
+	 *
+	 * \param[in] identifier The identifier of the mqb.
+	 * \param[in] state Its state.
+	 *
+	 * \return The handle of the state, even if it already existed.
+	 *
+	 * \note Used by `addMQB`, which adds the boxes as well.
+	 */
+	MQBHandle addMQBState(std::string_view identifier, MQBState state) noexcept;
+
+	/**
+	 * \brief Removes the state of a multiple question box, but not its boxes. No effect if not there.
+	 * \complexity O(1).
+	 *
+	 * \note Used by `removeMQB`, which removes the boxes as well.
+	 */
+	void removeMQBState(std::string_view identifier) noexcept;
+
+	/**
+	 * \brief Returns the handle of the state of a multiple question box, or a stale handle if it does
+	 *		  not exist.
+	 * \complexity O(1).
 	 */
-	virtual void lockInterface(bool shrinkToFit = true) noexcept override;
+	[[nodiscard]] MQBHandle getMQBHandle(std::string_view identifier) const noexcept;
+
+	/**
+	 * \brief Returns the state of a multiple question box, or nullptr if it does not exist.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline MQBState* getMQBState(MQBHandle handle) noexcept
+	{
+		return m_mqbs.get(handle);
+	}
+
+	/**
+	 * \see Same as `getMQBState(MQBHandle)`.
+	 */
+	[[nodiscard]] inline MQBState* getMQBState(std::string_view identifier) noexcept
+	{
+		return m_mqbs.get(getMQBHandle(identifier));
+	}
 
 private:
 	 
@@ -238,7 +340,27 @@ private:
 	size_t m_nbOfButtonSprites; // The number of interactive sprites.
 
 	using ButtonElement = std::pair<ButtonFunction, short>;
-	std::unordered_map<std::string, ButtonElement, TransparentHash, TransparentEqual> m_allButtons; // Contains all buttons.
+	SlotMap<ButtonElement> m_buttons; // Contains all buttons, never moved while they exist.
+	FlatMap<ArenaString, SlotMap<ButtonElement>::Key, TransparentHash, TransparentEqual> m_allButtons; // Finds buttons with their identifier.
+	ArenaVector<ButtonElement*> m_buttonsOfTextHandles; // The button of each interactive text, indexed by the slot of its handle.
+	ArenaVector<ButtonElement*> m_buttonsOfSpriteHandles; // The button of each interactive sprite, indexed by the slot of its handle.
+
+	/**
+	 * \brief Returns the item of an interactive text.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] Item makeTextItem(size_t index) noexcept;
+
+	/**
+	 * \brief Returns the item of an interactive sprite.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] Item makeSpriteItem(size_t index) noexcept;
+
+	SpatialGrid m_hoverGrid; // Indexes the interactive elements once the interface is locked.
+
+	SlotMap<MQBState> m_mqbs; // The states of the multiple question boxes, never moved while they exist.
+	FlatMap<ArenaString, MQBHandle, TransparentHash, TransparentEqual> m_mqbsByIdentifier; // Finds states with their identifier.
 };
 
 
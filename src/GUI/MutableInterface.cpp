@@ -1,4 +1,6 @@
 #include "MutableInterface.hpp"
+#include "CompoundElements.hpp"
+#include <algorithm>
 
 namespace gui
 {
@@ -9,8 +11,7 @@ void MutableInterface::addDynamicSprite(std::string identifier, std::string_view
 		return;
 
 	addSprite(textureName, pos, scale, rect, rot, alignment, color); // Actual addition of the sprite.
-	auto mapIterator{ m_dynamicSprites.insert(std::make_pair(std::move(identifier), m_sprites.size() - 1)).first }; // Insert returns a pair, where the first element is an iterator to the inserted element.
-	m_indexesForEachDynamicSprites[m_sprites.size() - 1] = mapIterator; // Mapping the index to the iterator for O(1) removal.
+	registerDynamicSprite(std::move(identifier));
 }
 
 void MutableInterface::addDynamicSprite(std::string identifier, sf::Texture texture, sf::Vector2f pos, sf::Vector2f scale, sf::IntRect rect, sf::Angle rot, Alignment alignment, sf::Color color) noexcept
@@ -19,8 +20,7 @@ void MutableInterface::addDynamicSprite(std::string identifier, sf::Texture text
 		return;
 
 	addSprite(texture, pos, scale, rect, rot, alignment, color); // Actual addition of the sprite.
-	auto mapIterator{ m_dynamicSprites.insert(std::make_pair(std::move(identifier), m_sprites.size() - 1)).first }; // Insert returns a pair, where the first element is an iterator to the inserted element.
-	m_indexesForEachDynamicSprites[m_sprites.size() - 1] = mapIterator; // Mapping the index to the iterator for O(1) removal.
+	registerDynamicSprite(std::move(identifier));
 }
 
 void MutableInterface::removeDynamicText(std::string_view identifier) noexcept
@@ -32,10 +32,13 @@ void MutableInterface::removeDynamicText(std::string_view identifier) noexcept
 	if (mapIterator == m_dynamicTexts.end())
 		return;
 
+	const ElementKey key{ mapIterator->second };
+
 	// Swapping the element with the last one to maintain O(1) complexity.
-	swapElement(mapIterator->second, m_texts.size()-1, m_texts, m_dynamicTexts, m_indexesForEachDynamicTexts); 
+	swapElement(m_textElements[key].index, m_texts.size()-1, m_texts, m_textElements, m_indexesForEachDynamicTexts); 
 	m_indexesForEachDynamicTexts.erase(m_texts.size() - 1);
-	m_dynamicTexts.erase(mapIterator); 
+	m_dynamicTexts.erase(mapIterator); // Before the element, whose identifier is viewed by the map.
+	m_textElements.erase(key);
 	m_texts.pop_back();
 }
 
@@ -48,38 +51,182 @@ void MutableInterface::removeDynamicSprite(std::string_view identifier) noexcept
 	if (mapIterator == m_dynamicSprites.end())
 		return;
 
+	const ElementKey key{ mapIterator->second };
+
 	// Swapping the element with the last one to maintain O(1) complexity.
-	swapElement(m_sprites.size() - 1, mapIterator->second, m_sprites, m_dynamicSprites, m_indexesForEachDynamicSprites);
+	swapElement(m_sprites.size() - 1, m_spriteElements[key].index, m_sprites, m_spriteElements, m_indexesForEachDynamicSprites);
 	m_indexesForEachDynamicSprites.erase(m_sprites.size() - 1);
-	m_dynamicSprites.erase(mapIterator); 
+	m_dynamicSprites.erase(mapIterator); // Before the element, whose identifier is viewed by the map.
+	m_spriteElements.erase(key);
 	m_sprites.pop_back();
 }
 
 TextWrapper* MutableInterface::getDynamicText(std::string_view identifier) noexcept
 {
+	applyPendingResize(); // The caller may read the text.
+
 	const auto mapIterator{ m_dynamicTexts.find(identifier) };
 
 	if (mapIterator == m_dynamicTexts.end())
 		return nullptr;
 
-	return &m_texts[mapIterator->second];
+	return &m_texts[m_textElements[mapIterator->second].index];
 }
 
 SpriteWrapper* MutableInterface::getDynamicSprite(std::string_view identifier) noexcept
 {
+	applyPendingResize(); // The caller may read the sprite.
+
 	const auto mapIterator{ m_dynamicSprites.find(identifier) };
 
 	if (mapIterator == m_dynamicSprites.end())
 		return nullptr;
 
-	return &m_sprites[mapIterator->second];
+	return &m_sprites[m_spriteElements[mapIterator->second].index];
+}
+
+MutableInterface::TextHandle MutableInterface::getTextHandle(std::string_view identifier) const noexcept
+{
+	const auto mapIterator{ m_dynamicTexts.find(identifier) };
+
+	if (mapIterator == m_dynamicTexts.end())
+		return TextHandle{};
+
+	return toHandle<TextWrapper>(mapIterator->second);
+}
+
+MutableInterface::SpriteHandle MutableInterface::getSpriteHandle(std::string_view identifier) const noexcept
+{
+	const auto mapIterator{ m_dynamicSprites.find(identifier) };
+
+	if (mapIterator == m_dynamicSprites.end())
+		return SpriteHandle{};
+
+	return toHandle<SpriteWrapper>(mapIterator->second);
 }
 
-void MutableInterface::lockInterface(bool shrinkToFit) noexcept
+size_t MutableInterface::applyPending() noexcept
 {
-	BasicInterface::lockInterface(shrinkToFit);
+	return m_pendingCommands.consume([this](Command& command) noexcept
+	{
+		TextWrapper* const text{ getDynamicText(command.identifier) };
+		SpriteWrapper* const sprite{ getDynamicSprite(command.identifier) };
+
+		if (const auto* setContent{ std::get_if<SetContent>(&command.action) })
+		{
+			if (text != nullptr)
+				text->setContent(setContent->content);
+		}
+		else if (const auto* setTransform{ std::get_if<SetTransform>(&command.action) })
+		{
+			for (TransformableWrapper* const wrapper : { static_cast<TransformableWrapper*>(text), static_cast<TransformableWrapper*>(sprite) })
+			{
+				if (wrapper == nullptr)
+					continue;
+
+				if (setTransform->position.has_value())
+					wrapper->setPosition(setTransform->position.value());
+				if (setTransform->scale.has_value())
+					wrapper->setScale(setTransform->scale.value());
+				if (setTransform->rotation.has_value())
+					wrapper->setRotation(setTransform->rotation.value());
+			}
+		}
+		else if (const auto* setHide{ std::get_if<SetHide>(&command.action) })
+		{
+			if (text != nullptr)
+				text->hide = setHide->hide;
+			if (sprite != nullptr)
+				sprite->hide = setHide->hide;
+		}
+		else if (const auto* switchTexture{ std::get_if<SwitchTexture>(&command.action) })
+		{
+			if (sprite == nullptr)
+				return;
+
+			try
+			{
+				sprite->switchToTexture(switchTexture->index);
+			}
+			catch (const LoadingGraphicalResourceFailure&)
+			{}	// The sprite keeps its current texture.
+		}
+		else if (const auto* moveBar{ std::get_if<MoveProgressBar>(&command.action) })
+		{
+			try
+			{
+				moveProgressBar(this, command.identifier, std::clamp(moveBar->progress, 0.f, 1.f));
+			}
+			catch (const std::invalid_argument&)
+			{}	// Not a progress bar.
+		}
+	});
+}
+
+void MutableInterface::reserve(size_t nbOfNewTexts, size_t nbOfNewSprites) noexcept
+{
+	BasicInterface::reserve(nbOfNewTexts, nbOfNewSprites);
+
+	reserveRoomFor(m_textElements, nbOfNewTexts);
+	reserveRoomFor(m_spriteElements, nbOfNewSprites);
+	reserveRoomFor(m_dynamicTexts, nbOfNewTexts);
+	reserveRoomFor(m_dynamicSprites, nbOfNewSprites);
+	reserveRoomFor(m_indexesForEachDynamicTexts, nbOfNewTexts);
+	reserveRoomFor(m_indexesForEachDynamicSprites, nbOfNewSprites);
+}
+
+void MutableInterface::lockInterface(bool shrinkToFit, bool batchedDrawing) noexcept
+{
+	BasicInterface::lockInterface(shrinkToFit, batchedDrawing);
 	m_indexesForEachDynamicTexts.clear(); // Used for removal in O(1), but useless when locked.
 	m_indexesForEachDynamicSprites.clear();
 }
 
+void MutableInterface::removeAddedElements(size_t nbOfTexts, size_t nbOfSprites) noexcept
+{
+	while (m_texts.size() > nbOfTexts)
+	{
+		const auto indexIterator{ m_indexesForEachDynamicTexts.find(m_texts.size() - 1) };
+		if (indexIterator != m_indexesForEachDynamicTexts.end())
+		{
+			const ElementKey key{ indexIterator->second };
+			m_dynamicTexts.erase(std::string_view{ m_textElements[key].identifier });
+			m_indexesForEachDynamicTexts.erase(indexIterator);
+			m_textElements.erase(key);
+		}
+
+		m_texts.pop_back();
+	}
+
+	while (m_sprites.size() > nbOfSprites)
+	{
+		const auto indexIterator{ m_indexesForEachDynamicSprites.find(m_sprites.size() - 1) };
+		if (indexIterator != m_indexesForEachDynamicSprites.end())
+		{
+			const ElementKey key{ indexIterator->second };
+			m_dynamicSprites.erase(std::string_view{ m_spriteElements[key].identifier });
+			m_indexesForEachDynamicSprites.erase(indexIterator);
+			m_spriteElements.erase(key);
+		}
+
+		m_sprites.pop_back();
+	}
+}
+
+void MutableInterface::flagDynamicElements(std::vector<bool>& dynamicSprites, std::vector<bool>& dynamicTexts) const noexcept
+{
+	for (const DynamicElement& element : m_spriteElements)
+		dynamicSprites[element.index] = true;
+	for (const DynamicElement& element : m_textElements)
+		dynamicTexts[element.index] = true;
+}
+
+void MutableInterface::registerDynamicElement(std::string_view identifier, size_t index, DynamicElements& elements, IdentifierMap& identifierMap, IndexMap& indexMap) noexcept
+{
+	const ElementKey key{ elements.emplace(identifier, index) };
+
+	identifierMap.try_emplace(std::string_view{ elements[key].identifier }, key); // The element never moves.
+	indexMap.insert_or_assign(index, key); // Mapping the index to the key for O(1) removal.
+}
+
 } // gui namespace
\ No newline at end of file
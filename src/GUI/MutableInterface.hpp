@@ -13,12 +13,20 @@
 #define MUTABLEINTERFACE_HPP
 
 #include "BasicInterface.hpp"
+#include "CommandQueue.hpp"
+#include "FlatMap.hpp"
+#include "SlotMap.hpp"
 #include <SFML/Graphics.hpp>
 #include <string>
 #include <string_view>
-#include <unordered_map>
 #include <utility>
+#include <optional>
+#include <variant>
 #include <cstdint>
+#include <concepts>
+#include <vector>
+#include <ranges>
+#include <type_traits>
 #ifndef NDEBUG
 #include <cassert>
 #endif //NDEBUG
@@ -60,6 +68,90 @@ class MutableInterface : public BasicInterface
 {
 public:
 
+	/**
+	 * \brief Refers to a dynamic element, for O(1) accesses without hashing its identifier.
+	 *
+	 * Resolve the identifier once with `getTextHandle` or `getSpriteHandle`, then use the handle. It
+	 * remains valid as long as its element exists, whatever the additions, removals or swaps of other
+	 * elements. Once the element is removed, the handle is stale: functions taking it do nothing, or
+	 * return nullptr, even if another element reuses its slot.
+	 *
+	 * \code
+	 * const MGUI::TextHandle fps{ gui.getTextHandle("fps") };
+	 * // Every frame.
+	 * gui.getDynamicText(fps)->setContent(frameRate);
+	 * \endcode
+	 */
+	template<typename T> requires (std::same_as<T, TextWrapper> || std::same_as<T, SpriteWrapper>)
+	struct Handle
+	{
+		std::uint32_t slot{ 0 };
+		std::uint32_t generation{ 0 }; // 0 for null handles: slots start at generation 1.
+
+		[[nodiscard]] constexpr bool isNull() const noexcept
+		{
+			return generation == 0;
+		}
+
+		[[nodiscard]] constexpr bool operator==(const Handle&) const noexcept = default;
+	};
+
+	using TextHandle = Handle<TextWrapper>;
+	using SpriteHandle = Handle<SpriteWrapper>;
+
+	/**
+	 * \brief Sets the content of the dynamic text.
+	 */
+	struct SetContent
+	{
+		std::string content;
+	};
+
+	/**
+	 * \brief Sets the transform of the dynamic text and sprite. Empty members are left unchanged.
+	 */
+	struct SetTransform
+	{
+		std::optional<sf::Vector2f> position{};
+		std::optional<sf::Vector2f> scale{};
+		std::optional<sf::Angle> rotation{};
+	};
+
+	/**
+	 * \brief Hides or shows the dynamic text and sprite.
+	 */
+	struct SetHide
+	{
+		bool hide;
+	};
+
+	/**
+	 * \brief Switches the dynamic sprite to a texture of its texture vector (see `SpriteWrapper::switchToTexture`).
+	 */
+	struct SwitchTexture
+	{
+		size_t index;
+	};
+
+	/**
+	 * \brief Moves the progress bar (see `moveProgressBar`). The progress is clamped between 0 and 1.
+	 */
+	struct MoveProgressBar
+	{
+		float progress;
+	};
+
+	/**
+	 * \brief A modification of the dynamic elements with a given identifier, sent from any thread.
+	 *
+	 * \see `queueCommand`.
+	 */
+	struct Command
+	{
+		std::string identifier;
+		std::variant<SetContent, SetTransform, SetHide, SwitchTexture, MoveProgressBar> action;
+	};
+
 	/**
 	 * \brief Constructs the graphical interface.
 	 * \complexity O(1)
@@ -81,13 +173,15 @@ public:
 	 *			  - A window of size 7680x2160 (32/9) → factor = 1080/2160 = 2.0
 	 *
 	 *			  If set to 0, no scaling is applied regardless of the window size.
+	 * \param[in] resource Where the elements and their identifiers are allocated from. See
+	 *			  `BasicInterface::BasicInterface`.
 	 *
 	 * \pre `window` must be a valid.
 	 * \post An interface is constructed.
 	 * \warning The program will assert otherwise.
 	 */
-	inline explicit MutableInterface(sf::RenderWindow* window, unsigned int relativeScalingDefinition = 1080) noexcept
-		: BasicInterface{ window, relativeScalingDefinition }, m_dynamicTexts{}, m_dynamicSprites{}, m_indexesForEachDynamicTexts{}, m_indexesForEachDynamicSprites{}
+	inline explicit MutableInterface(sf::RenderWindow* window, unsigned int relativeScalingDefinition = 1080, std::pmr::memory_resource* resource = nullptr) noexcept
+		: BasicInterface{ window, relativeScalingDefinition, resource }, m_textElements{ getMemoryResource() }, m_spriteElements{ getMemoryResource() }, m_dynamicTexts{ getMemoryResource() }, m_dynamicSprites{ getMemoryResource() }, m_indexesForEachDynamicTexts{ getMemoryResource() }, m_indexesForEachDynamicSprites{ getMemoryResource() }, m_pendingCommands{}
 	{}
 
 	MutableInterface() noexcept = default;
@@ -144,8 +238,7 @@ public:
 			return;
 
 		addText(content, pos, characterSize, color, fontName, alignment, style, scale, rot); // Actual addition of the text.
-		auto mapIterator{ m_dynamicTexts.insert(std::make_pair(std::move(identifier), m_texts.size() - 1)).first }; // Insert returns a pair, where the first element is an iterator to the inserted element.
-		m_indexesForEachDynamicTexts[m_texts.size() - 1] = mapIterator; // Mapping the index to the iterator for O(1) removal.
+		registerDynamicText(std::move(identifier));
 	}
 
 	/**
@@ -186,6 +279,155 @@ public:
 	 */
 	void addDynamicSprite(std::string identifier, sf::Texture texture, sf::Vector2f pos, sf::Vector2f scale = sf::Vector2f{ 1.f, 1.f }, sf::IntRect rect = sf::IntRect{}, sf::Angle rot = sf::degrees(0), Alignment alignment = Alignment::Center, sf::Color color = sf::Color::White) noexcept;
 
+	/**
+	 * \brief The arguments of `addDynamicText`, for bulk additions. Designated initializers keep
+	 *		  the default values: `{ .identifier = "score", .content = "0", .pos = { 500, 50 } }`.
+	 *
+	 * \see `addDynamicTexts`.
+	 */
+	struct TextDescriptor
+	{
+		std::string identifier;
+		std::string content; // UTF-8.
+		sf::Vector2f pos;
+		unsigned int characterSize{ 30u };
+		sf::Color color{ sf::Color::White };
+		std::string_view fontName{ s_defaultFontName };
+		Alignment alignment{ Alignment::Center };
+		std::uint32_t style{ 0 };
+		sf::Vector2f scale{ 1.f, 1.f };
+		sf::Angle rot{ sf::degrees(0) };
+	};
+
+	/**
+	 * \brief The arguments of `addDynamicSprite`, for bulk additions.
+	 *
+	 * \see `addDynamicSprites`.
+	 */
+	struct SpriteDescriptor
+	{
+		std::string identifier;
+		std::string_view textureName;
+		sf::Vector2f pos;
+		sf::Vector2f scale{ 1.f, 1.f };
+		sf::IntRect rect{};
+		sf::Angle rot{ sf::degrees(0) };
+		Alignment alignment{ Alignment::Center };
+		sf::Color color{ sf::Color::White };
+	};
+
+	/**
+	 * \brief Adds many mutable texts at once.
+	 * \complexity O(N), where N is the number of descriptors.
+	 *
+	 * Same as calling `addDynamicText` for each descriptor, but the memory is reserved up front (if
+	 * the range is sized), the scaling factor is computed once, and texts are constructed in place.
+	 *
+	 * Descriptors whose identifier already exists are skipped.
+	 *
+	 * \param[in] descriptors The texts to add, in order.
+	 *
+	 * \note May invalidate any pointers of any TransformableWrapper in this gui.
+	 *
+	 * \throw LoadingGraphicalRessourceFailure, std::invalid_argument Strong exception guarantee:
+	 *		  none of the texts are added (see `addDynamicText`).
+	 *
+	 * \pre The interface must not be locked.
+	 * \warning The program will assert otherwise.
+	 *
+	 * \see `addDynamicText`, `reserve`.
+	 */
+	template<std::ranges::input_range R> requires std::same_as<std::ranges::range_value_t<R>, TextDescriptor>
+	inline void addDynamicTexts(R&& descriptors)
+	{
+		ENSURE_SFML_WINDOW_VALIDITY(m_window, "The window is invalid in the function addDynamicTexts of MutableInterface");
+		assert((!m_lockState) && "Precondition violated; the interface is locked in the function addDynamicTexts of MutableInterface");
+		applyPendingResize();
+		loadDefaultFont();
+
+		if constexpr (std::ranges::sized_range<R>)
+			reserve(static_cast<size_t>(std::ranges::size(descriptors)), 0);
+
+		const float relativeScalingValue{ computeRelativeScaling() };
+		const size_t previousNbOfSprites{ m_sprites.size() };
+		const size_t previousNbOfTexts{ m_texts.size() };
+
+		try
+		{
+			for (auto&& descriptor : descriptors)
+			{
+				if (m_dynamicTexts.contains(descriptor.identifier))
+					continue;
+
+				m_texts.emplace_back(descriptor.content, descriptor.fontName, descriptor.characterSize, descriptor.pos, descriptor.scale * relativeScalingValue, descriptor.color, descriptor.alignment, descriptor.style, descriptor.rot);
+				registerDynamicText(descriptor.identifier);
+			}
+		}
+		catch (...)
+		{
+			removeAddedElements(previousNbOfTexts, previousNbOfSprites);
+			throw;
+		}
+	}
+
+	/**
+	 * \brief Adds many mutable sprites at once.
+	 * \complexity O(N), where N is the number of descriptors.
+	 *
+	 * Same as calling `addDynamicSprite` for each descriptor, but the memory is reserved up front (if
+	 * the range is sized), the scaling factor is computed once, and sprites are constructed in place.
+	 *
+	 * Descriptors whose identifier already exists are skipped.
+	 *
+	 * \param[in] descriptors The sprites to add, in order.
+	 *
+	 * \note May invalidate any pointers of any TransformableWrapper in this gui.
+	 *
+	 * \throw std::invalid_argument Strong exception guarantee: none of the sprites are added (see `addDynamicSprite`).
+	 *
+	 * \pre The interface must not be locked.
+	 * \warning The program will assert otherwise.
+	 *
+	 * \see `addDynamicSprite`, `reserve`.
+	 */
+	template<std::ranges::input_range R> requires std::same_as<std::ranges::range_value_t<R>, SpriteDescriptor>
+	inline void addDynamicSprites(R&& descriptors)
+	{
+		ENSURE_SFML_WINDOW_VALIDITY(m_window, "The window is invalid in the function addDynamicSprites of MutableInterface");
+		assert((!m_lockState) && "Precondition violated; the interface is locked in the function addDynamicSprites of MutableInterface");
+		applyPendingResize();
+
+		if constexpr (std::ranges::sized_range<R>)
+			reserve(0, static_cast<size_t>(std::ranges::size(descriptors)));
+
+		const float relativeScalingValue{ computeRelativeScaling() };
+		const size_t previousNbOfSprites{ m_sprites.size() };
+		const size_t previousNbOfTexts{ m_texts.size() };
+
+		try
+		{
+			for (auto&& descriptor : descriptors)
+			{
+				if (m_dynamicSprites.contains(descriptor.identifier))
+					continue;
+
+				m_sprites.emplace_back(descriptor.textureName, descriptor.pos, descriptor.scale * relativeScalingValue, descriptor.rect, descriptor.rot, descriptor.alignment, descriptor.color);
+				registerDynamicSprite(descriptor.identifier);
+			}
+		}
+		catch (...)
+		{
+			removeAddedElements(previousNbOfTexts, previousNbOfSprites);
+			throw;
+		}
+	}
+
+	/**
+	 * \see `BasicInterface::reserve`. Also reserves the maps of identifiers, as if all new elements
+	 *		 were dynamic.
+	 */
+	virtual void reserve(size_t nbOfNewTexts, size_t nbOfNewSprites) noexcept override;
+
 	/**
 	 * \brief Removes a text from the GUI. No effet if not there.
 	 * \complexity O(1).
@@ -214,6 +456,30 @@ public:
 	 */
 	virtual void removeDynamicSprite(std::string_view identifier) noexcept;
 
+	/**
+	 * \see Same as `removeDynamicText`. No effect if the handle is stale.
+	 * \note The identifier is still hashed once, to remove it from the map of identifiers. Unlike the
+	 *		 identifier, a stale handle never removes a newer element with the same identifier. Forwards
+	 *		 to the overload taking the identifier, so that derived interfaces forget the element too.
+	 */
+	inline void removeDynamicText(TextHandle handle) noexcept
+	{
+		if (const DynamicElement* const element{ m_textElements.get(toKey(handle)) })
+			removeDynamicText(std::string_view{ element->identifier });
+	}
+
+	/**
+	 * \see Same as `removeDynamicSprite`. No effect if the handle is stale.
+	 * \note The identifier is still hashed once, to remove it from the map of identifiers. Unlike the
+	 *		 identifier, a stale handle never removes a newer element with the same identifier. Forwards
+	 *		 to the overload taking the identifier, so that derived interfaces forget the element too.
+	 */
+	inline void removeDynamicSprite(SpriteHandle handle) noexcept
+	{
+		if (const DynamicElement* const element{ m_spriteElements.get(toKey(handle)) })
+			removeDynamicSprite(std::string_view{ element->identifier });
+	}
+
 	/**
 	 * \brief Returns a text Wrapper ptr, or nullptr if it does not exist.
 	 * \complexity O(1).
@@ -244,10 +510,134 @@ public:
 	 */
 	[[nodiscard]] SpriteWrapper* getDynamicSprite(std::string_view identifier) noexcept;
 
+	/**
+	 * \brief Returns the handle of a text, or a null handle if it does not exist.
+	 * \complexity O(1).
+	 *
+	 * \param[in] identifier: The identifier of the text.
+	 *
+	 * \see `Handle`.
+	 */
+	[[nodiscard]] TextHandle getTextHandle(std::string_view identifier) const noexcept;
+
+	/**
+	 * \brief Returns the handle of a sprite, or a null handle if it does not exist.
+	 * \complexity O(1).
+	 *
+	 * \param[in] identifier: The identifier of the sprite.
+	 *
+	 * \see `Handle`.
+	 */
+	[[nodiscard]] SpriteHandle getSpriteHandle(std::string_view identifier) const noexcept;
+
+	/**
+	 * \brief Returns a text Wrapper ptr, or nullptr if the handle is stale.
+	 * \complexity O(1), without hashing.
+	 *
+	 * \warning The returned pointer is not guaranteed to be valid after ANY addition or removal of a
+	 *			dynamic text, unlike the handle.
+	 *
+	 * \see `getDynamicText(std::string_view)`, `Handle`.
+	 */
+	[[nodiscard]] inline TextWrapper* getDynamicText(TextHandle handle) noexcept
+	{
+		const DynamicElement* const element{ m_textElements.get(toKey(handle)) };
+		if (element == nullptr) [[unlikely]]
+			return nullptr;
+
+		applyPendingResize(); // The caller may read the text.
+		return &m_texts[element->index];
+	}
+
+	/**
+	 * \brief Returns a sprite Wrapper ptr, or nullptr if the handle is stale.
+	 * \complexity O(1), without hashing.
+	 *
+	 * \warning The returned pointer is not guaranteed to be valid after ANY addition or removal of a
+	 *			dynamic sprite, unlike the handle.
+	 *
+	 * \see `getDynamicSprite(std::string_view)`, `Handle`.
+	 */
+	[[nodiscard]] inline SpriteWrapper* getDynamicSprite(SpriteHandle handle) noexcept
+	{
+		const DynamicElement* const element{ m_spriteElements.get(toKey(handle)) };
+		if (element == nullptr) [[unlikely]]
+			return nullptr;
+
+		applyPendingResize(); // The caller may read the sprite.
+		return &m_sprites[element->index];
+	}
+
+	/**
+	 * \brief Returns the identifier of a text, or an empty string if the handle is stale.
+	 * \complexity O(1).
+	 *
+	 * \warning The returned view is invalidated once the text is removed.
+	 */
+	[[nodiscard]] inline std::string_view getIdentifier(TextHandle handle) const noexcept
+	{
+		const DynamicElement* const element{ m_textElements.get(toKey(handle)) };
+		return (element != nullptr) ? std::string_view{ element->identifier } : std::string_view{};
+	}
+
+	/**
+	 * \brief Returns the identifier of a sprite, or an empty string if the handle is stale.
+	 * \complexity O(1).
+	 *
+	 * \warning The returned view is invalidated once the sprite is removed.
+	 */
+	[[nodiscard]] inline std::string_view getIdentifier(SpriteHandle handle) const noexcept
+	{
+		const DynamicElement* const element{ m_spriteElements.get(toKey(handle)) };
+		return (element != nullptr) ? std::string_view{ element->identifier } : std::string_view{};
+	}
+
+	/**
+	 * \brief Queues a modification of dynamic elements. Can be called from any thread.
+	 * \complexity O(1), lock-free.
+	 *
+	 * Interfaces and wrappers are not thread-safe: other threads (e.g. a simulation) should not modify
+	 * elements directly. Instead, they queue commands, which are executed by `applyPending` on the
+	 * render thread. Producers never block.
+	 *
+	 * \param[in] command The identifier of the elements, and what to do with them.
+	 *
+	 * \code
+	 * // From a simulation thread.
+	 * gui.queueCommand({ "fps", gui::MutableInterface::SetContent{ std::to_string(fps) } });
+	 * gui.queueCommand({ "loading", gui::MutableInterface::MoveProgressBar{ 0.5f } });
+	 * \endcode
+	 *
+	 * \warning No thread may queue a command while the interface is moved or destroyed.
+	 *
+	 * \see `applyPending`, `Command`.
+	 */
+	inline void queueCommand(Command command) noexcept
+	{
+		m_pendingCommands.push(std::move(command));
+	}
+
+	/**
+	 * \brief Executes all queued commands, in the order they were queued.
+	 * \complexity O(N), where N is the number of queued commands.
+	 *
+	 * It should be called once per frame on the render thread, before `draw` and `eventUpdateHovered`.
+	 * If no command was queued, it only costs an atomic exchange.
+	 *
+	 * Commands whose identifier does not match any dynamic element are ignored, as well as texture
+	 * switches that fail to load the texture.
+	 *
+	 * \return The number of commands executed.
+	 *
+	 * \pre Must be called from a single thread, the one that draws the interface.
+	 *
+	 * \see `queueCommand`.
+	 */
+	size_t applyPending() noexcept;
+
 	/**
 	 * \brief Prevents any addition of new elements to the interface.
-	 * \complexity O(1) if shrinkToFit is false
-	 * \complexity O(N + M) otherwise. N is the number of texts and M the number of sprites.
+	 * \complexity O(N + M), where N is the number of texts and M the number of sprites.
 	 *
 	 * Once you have added all your elements, you can lock the interface to avoid futur modifications.
 	 * Contrary to BasicInterface, even if `shrinkToFit` is false, locking still reduces memory usage
@@ -261,18 +651,110 @@ public:
 	 *
 	 * \param[in] shrinkToFit If true, the function will call `shrink_to_fit` on both the texts and
 	 *						  sprites.
+	 * \param[in] batchedDrawing If true, `draw` groups the elements sharing a texture (or a font) into
+	 *							 cached vertex arrays. See `BasicInterface::lockInterface`.
 	 */
-	virtual void lockInterface(bool shrinkToFit = true) noexcept override;
+	virtual void lockInterface(bool shrinkToFit = true, bool batchedDrawing = false) noexcept override;
 
 protected:
 
-	using MutableElementUmap = std::unordered_map<std::string, size_t, TransparentHash, TransparentEqual>;
-	MutableElementUmap m_dynamicTexts; // All indexes of dynamic texts in the interface.
-	MutableElementUmap m_dynamicSprites; // All indexes of dynamic sprites in the interface.
+	/**
+	 * \see `BasicInterface::flagDynamicElements`.
+	 */
+	virtual void flagDynamicElements(std::vector<bool>& dynamicSprites, std::vector<bool>& dynamicTexts) const noexcept override;
 
-	using UmapMutablesIterator = MutableElementUmap::iterator;
-	std::unordered_map<size_t, UmapMutablesIterator> m_indexesForEachDynamicTexts; // Allows removal of dynamic texts in O(1).
-	std::unordered_map<size_t, UmapMutablesIterator> m_indexesForEachDynamicSprites; // Allows removal of dynamic sprites in O(1).
+	/**
+	 * \brief Removes the last elements, with their identifiers, until the sizes are the given ones.
+	 * \complexity O(N), where N is the number of removed elements.
+	 *
+	 * Used to roll back a bulk addition that failed midway.
+	 *
+	 * \param[in] nbOfTexts The number of texts to keep.
+	 * \param[in] nbOfSprites The number of sprites to keep.
+	 */
+	void removeAddedElements(size_t nbOfTexts, size_t nbOfSprites) noexcept;
+
+	/**
+	 * \brief The identifier of a dynamic element, and where it is. Never moved while it exists, so that
+	 *		  the identifier maps can view its identifier.
+	 *
+	 * The identifier is copied into the arena of the interface, given by the slot map.
+	 */
+	struct DynamicElement
+	{
+		using allocator_type = ArenaAllocator<>;
+
+		inline DynamicElement(std::allocator_arg_t, const allocator_type& allocator, std::string_view identifier, size_t index)
+			: identifier{ identifier, allocator }, index{ index }
+		{}
+
+		ArenaString identifier; // Never changes.
+		size_t index; // Changes when the element is swapped.
+	};
+
+	using DynamicElements = SlotMap<DynamicElement>;
+	using ElementKey = DynamicElements::Key; // Same slot and generation as the handle of the element.
+	DynamicElements m_textElements; // All dynamic texts in the interface.
+	DynamicElements m_spriteElements; // All dynamic sprites in the interface.
+
+	using IdentifierMap = FlatMap<std::string_view, ElementKey, TransparentHash, TransparentEqual>;
+	IdentifierMap m_dynamicTexts; // Finds dynamic texts with their identifier.
+	IdentifierMap m_dynamicSprites; // Finds dynamic sprites with their identifier.
+
+	using IndexMap = FlatMap<size_t, ElementKey>;
+	IndexMap m_indexesForEachDynamicTexts; // Allows removal of dynamic texts in O(1).
+	IndexMap m_indexesForEachDynamicSprites; // Allows removal of dynamic sprites in O(1).
+
+	CommandQueue<Command> m_pendingCommands; // Commands queued by any thread, executed by `applyPending`.
+
+
+	/**
+	 * \brief Registers the last text as a dynamic one, and gives it a handle.
+	 * \complexity Amortized O(1).
+	 *
+	 * \param[in] identifier The identifier of the text, which does not exist yet.
+	 */
+	inline void registerDynamicText(std::string_view identifier) noexcept
+	{
+		registerDynamicElement(identifier, m_texts.size() - 1, m_textElements, m_dynamicTexts, m_indexesForEachDynamicTexts);
+	}
+
+	/**
+	 * \brief Registers the last sprite as a dynamic one, and gives it a handle.
+	 * \complexity Amortized O(1).
+	 *
+	 * \param[in] identifier The identifier of the sprite, which does not exist yet.
+	 */
+	inline void registerDynamicSprite(std::string_view identifier) noexcept
+	{
+		registerDynamicElement(identifier, m_sprites.size() - 1, m_spriteElements, m_dynamicSprites, m_indexesForEachDynamicSprites);
+	}
+
+	/**
+	 * \brief Inserts an element, and maps its identifier and its index to its key.
+	 * \complexity Amortized O(1).
+	 */
+	static void registerDynamicElement(std::string_view identifier, size_t index, DynamicElements& elements, IdentifierMap& identifierMap, IndexMap& indexMap) noexcept;
+
+	/**
+	 * \brief Converts a handle to the key of its element.
+	 * \complexity O(1).
+	 */
+	template<typename T>
+	[[nodiscard]] inline static constexpr ElementKey toKey(Handle<T> handle) noexcept
+	{
+		return ElementKey{ handle.slot, handle.generation };
+	}
+
+	/**
+	 * \brief Converts the key of an element to its handle.
+	 * \complexity O(1).
+	 */
+	template<typename T>
+	[[nodiscard]] inline static constexpr Handle<T> toHandle(ElementKey key) noexcept
+	{
+		return Handle<T>{ key.slot, key.generation };
+	}
 
 
 	/**
@@ -282,7 +764,7 @@ protected:
 	 * \param[in] index1 The first  index of the vector to swap.
 	 * \param[in] index2 The second index of the vector to swap.
 	 * \param[out] vector The vector that contains the elements to swap.
-	 * \param[out] identifierMap The map that enables accessing the container's elements using their identifier.
+	 * \param[out] elements The elements whose index is updated.
 	 * \param[in,out] indexMap The map that enables accessing the container's elements using indexes.
 	 * 
 	 * \pre No index should be out of range.
@@ -291,7 +773,7 @@ protected:
 	 * \warning Asserts otherwise.
 	 */
 	template<typename T> requires (std::same_as<T, TextWrapper> || std::same_as<T, SpriteWrapper>)
-	inline void swapElement(size_t index1, size_t index2, std::vector<T>& vector, MutableElementUmap& identifierMap, std::unordered_map<size_t, UmapMutablesIterator>& indexMap) noexcept
+	inline void swapElement(size_t index1, size_t index2, ArenaVector<T>& vector, DynamicElements& elements, IndexMap& indexMap) noexcept
 	{
 		ENSURE_NOT_OUT_OF_RANGE(index1, vector.size(), "Precondition violated; the first index to swap is out of range when the function swapElement of MutableInterface was called");
 		ENSURE_NOT_OUT_OF_RANGE(index2, vector.size(), "Precondition violated; the second index to swap is out of range when the function swapElement of MutableInterface was called");
@@ -307,16 +789,20 @@ protected:
 
 		if (mapIteratorIndex1 != indexMap.end()
 		&&  mapIteratorIndex2 != indexMap.end())
-		{	// When both are dynamics
-			std::swap(identifierMap[mapIteratorIndex2->second->first], identifierMap[mapIteratorIndex1->second->first]);
-			std::swap(indexMap[index1], indexMap[index2]);
+		{	// When both are dynamics. Keys are not swapped with the indexes: they follow their element.
+			std::swap(mapIteratorIndex1->second, mapIteratorIndex2->second);
+			elements[mapIteratorIndex1->second].index = index1;
+			elements[mapIteratorIndex2->second].index = index2;
 		}
 		else if (mapIteratorIndex1 != indexMap.end() || mapIteratorIndex2 != indexMap.end())
 		{   // When only one is dynamic.
 			const auto dynamicElementIterator{ (mapIteratorIndex1 != indexMap.end()) ? mapIteratorIndex1 : mapIteratorIndex2 }; // Chooses the dynamic element
-			dynamicElementIterator->second->second = +index2 +index1 -dynamicElementIterator->second->second; // The previous index of the dynamic element cancels out.
-			indexMap[dynamicElementIterator->second->second] = dynamicElementIterator->second;
-			indexMap.erase(dynamicElementIterator);
+			const ElementKey key{ dynamicElementIterator->second };
+			const size_t newIndex{ (dynamicElementIterator == mapIteratorIndex1) ? index2 : index1 };
+
+			indexMap.erase(dynamicElementIterator); // Before inserting, which may move the elements of the map.
+			indexMap.try_emplace(newIndex, key);
+			elements[key].index = newIndex;
 		}
 	}
 };
@@ -0,0 +1,185 @@
+/*******************************************************************
+ * \file   Profiler.hpp
+ * \brief  Declare the statistics gathered by the library during each frame, in debug mode.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note This file only depends on the standard library.
+ *********************************************************************/
+
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <chrono>
+#include <cstddef>
+
+#ifndef NDEBUG
+
+#define PROFILE_CONCATENATE_IMPL(lhs, rhs) lhs##rhs
+#define PROFILE_CONCATENATE(lhs, rhs) PROFILE_CONCATENATE_IMPL(lhs, rhs)
+
+#define PROFILE_COUNT(field, amount) \
+	(::gui::Profiler::getCurrentFrame().field += (amount))
+
+#define PROFILE_SCOPE(field) \
+	const ::gui::ScopedTimer PROFILE_CONCATENATE(scopedTimer, __LINE__){ ::gui::Profiler::getCurrentFrame().field }
+
+#else
+#define PROFILE_COUNT(field, amount) ((void)0)
+#define PROFILE_SCOPE(field)
+#endif
+
+namespace gui
+{
+
+/**
+ * \brief What the library did during a frame. Durations are accumulated over the whole frame.
+ *
+ * \note Only the render thread records statistics: the decoding of streamed textures by the workers
+ *		 is not accounted for, but their upload is. Neither are the resizes applied by a `FramePreparer`.
+ *
+ * \see `Profiler`.
+ */
+struct FrameStats
+{
+	size_t drawCalls{ 0 }; // Calls to `sf::RenderTarget::draw`, including the rendering of cached layers.
+	size_t drawnElements{ 0 }; // Visible elements drawn on their own, neither batched nor cached.
+	size_t hiddenElementsSkipped{ 0 }; // Hidden elements skipped while drawing them on their own.
+	std::chrono::nanoseconds drawTime{ 0 }; // Spent in `BasicInterface::draw`.
+
+	size_t hoverQueries{ 0 }; // Calls to `InteractiveInterface::eventUpdateHovered`.
+	size_t hoverCacheHits{ 0 }; // The previously hovered element was still hovered.
+	size_t hoverScannedElements{ 0 }; // Elements tested against the cursor.
+	std::chrono::nanoseconds hoverTime{ 0 }; // Spent in `InteractiveInterface::eventUpdateHovered`.
+
+	size_t resizes{ 0 }; // Interfaces whose elements were rescaled after a resize of the window.
+	std::chrono::nanoseconds resizeTime{ 0 }; // Spent rescaling the elements.
+
+	size_t textureLoads{ 0 }; // Textures loaded from a file, synchronously.
+	size_t textureLoadBytes{ 0 }; // Size of the loaded textures, 4 bytes per pixel.
+	std::chrono::nanoseconds textureLoadTime{ 0 }; // Spent in `loadTextureFromFile`.
+	size_t textureUploads{ 0 }; // Textures decoded in the background, then uploaded.
+	size_t textureUploadBytes{ 0 }; // Size of the uploaded textures, 4 bytes per pixel.
+	std::chrono::nanoseconds textureUploadTime{ 0 }; // Spent uploading them.
+	size_t fontLoads{ 0 }; // Fonts loaded from a file.
+	std::chrono::nanoseconds fontLoadTime{ 0 }; // Spent in `loadFontFromFile`.
+
+	size_t setContentUpdates{ 0 }; // Calls to `TextWrapper::setContent` that changed the text.
+	size_t setContentSkips{ 0 }; // Calls to `TextWrapper::setContent` with the content already displayed.
+};
+
+/**
+ * \brief Gathers the statistics of the current frame, in debug mode.
+ *
+ * The library records what it does into the current frame: call `endFrame` once per frame to get
+ * its statistics and start the next one. In release mode (NDEBUG defined), nothing is recorded: the
+ * instrumentation compiles to nothing, the same way the `ENSURE_` macros do, and all statistics are 0.
+ *
+ * \code
+ * const gui::FrameStats& stats{ gui::Profiler::endFrame() };
+ * if (stats.textureLoads != 0)
+ *     std::cout << stats.textureLoads << " textures loaded in " << stats.textureLoadTime << '\n';
+ * \endcode
+ *
+ * \note Each thread records into its own frame, so that workers never race with the render thread.
+ *		 Only the statistics of the render thread are meant to be read.
+ *
+ * \see `FrameStats`, `ScopedTimer`.
+ */
+class Profiler
+{
+public:
+
+	Profiler() noexcept = delete;
+
+
+	/**
+	 * \brief Returns the statistics being gathered.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline static FrameStats& getCurrentFrame() noexcept
+	{
+		return s_currentFrame;
+	}
+
+	/**
+	 * \brief Ends the current frame, and starts a new one.
+	 * \complexity O(1).
+	 *
+	 * \return The statistics of the frame that was ended.
+	 */
+	inline static const FrameStats& endFrame() noexcept
+	{
+		s_lastFrame = s_currentFrame;
+		s_currentFrame = FrameStats{};
+		return s_lastFrame;
+	}
+
+	/**
+	 * \brief Returns the statistics of the last frame that was ended by the calling thread.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline static const FrameStats& getLastFrame() noexcept
+	{
+		return s_lastFrame;
+	}
+
+
+	/// Whether the library records statistics, which is only the case in debug mode.
+#ifndef NDEBUG
+	inline static constexpr bool s_isEnabled{ true };
+#else
+	inline static constexpr bool s_isEnabled{ false };
+#endif
+
+private:
+
+	/// The statistics being gathered by the calling thread.
+	inline static thread_local FrameStats s_currentFrame{};
+	/// The statistics of the last frame that was ended by the calling thread.
+	inline static thread_local FrameStats s_lastFrame{};
+};
+
+/**
+ * \brief Adds the time spent within a scope to a duration.
+ *
+ * Used by the library for the durations of `FrameStats`, and available to time your own code.
+ *
+ * \code
+ * std::chrono::nanoseconds physicsTime{ 0 };
+ * {
+ *     gui::ScopedTimer timer{ physicsTime };
+ *     world.step();
+ * }
+ * \endcode
+ */
+class ScopedTimer
+{
+public:
+
+	inline explicit ScopedTimer(std::chrono::nanoseconds& accumulator) noexcept
+		: m_accumulator{ accumulator }, m_start{ std::chrono::steady_clock::now() }
+	{}
+
+	ScopedTimer(const ScopedTimer&) noexcept = delete;
+	ScopedTimer(ScopedTimer&&) noexcept = delete;
+	ScopedTimer& operator=(const ScopedTimer&) noexcept = delete;
+	ScopedTimer& operator=(ScopedTimer&&) noexcept = delete;
+
+	inline ~ScopedTimer() noexcept
+	{
+		m_accumulator += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start);
+	}
+
+private:
+
+	/// Where the time is added.
+	std::chrono::nanoseconds& m_accumulator;
+	/// When the scope was entered.
+	std::chrono::steady_clock::time_point m_start;
+};
+
+} // gui namespace
+
+#endif // PROFILER_HPP
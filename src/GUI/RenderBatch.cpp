@@ -0,0 +1,356 @@
+#include "RenderBatch.hpp"
+#include <cmath>
+#include <algorithm>
+
+namespace gui
+{
+
+/**
+ * \brief Tells whether two rectangles share at least one point that is not on their edges.
+ * \complexity O(1).
+ */
+static bool overlaps(const sf::FloatRect& lhs, const sf::FloatRect& rhs) noexcept
+{
+	return lhs.findIntersection(rhs).has_value();
+}
+
+/**
+ * \brief Appends the two triangles of a glyph, the same way `sf::Text` does.
+ * \complexity O(1).
+ *
+ * \param[out] vertices Where the triangles are appended.
+ * \param[in]  transform The transform of the text.
+ * \param[in]  pen The position of the glyph, in local coordinates.
+ * \param[in]  color The fill color of the text.
+ * \param[in]  glyph The glyph to append.
+ * \param[in]  italicShear The shear of the text, 0 if not italic.
+ */
+static void appendGlyph(std::vector<sf::Vertex>& vertices, const sf::Transform& transform, sf::Vector2f pen, sf::Color color, const sf::Glyph& glyph, float italicShear) noexcept
+{
+	constexpr float padding{ 1.f };
+
+	const float left  { glyph.bounds.position.x - padding };
+	const float top   { glyph.bounds.position.y - padding };
+	const float right { glyph.bounds.position.x + glyph.bounds.size.x + padding };
+	const float bottom{ glyph.bounds.position.y + glyph.bounds.size.y + padding };
+
+	const float u1{ static_cast<float>(glyph.textureRect.position.x) - padding };
+	const float v1{ static_cast<float>(glyph.textureRect.position.y) - padding };
+	const float u2{ static_cast<float>(glyph.textureRect.position.x + glyph.textureRect.size.x) + padding };
+	const float v2{ static_cast<float>(glyph.textureRect.position.y + glyph.textureRect.size.y) + padding };
+
+	const sf::Vertex topLeft    { transform.transformPoint(pen + sf::Vector2f{ left  - italicShear * top,    top    }), color, sf::Vector2f{ u1, v1 } };
+	const sf::Vertex topRight   { transform.transformPoint(pen + sf::Vector2f{ right - italicShear * top,    top    }), color, sf::Vector2f{ u2, v1 } };
+	const sf::Vertex bottomLeft { transform.transformPoint(pen + sf::Vector2f{ left  - italicShear * bottom, bottom }), color, sf::Vector2f{ u1, v2 } };
+	const sf::Vertex bottomRight{ transform.transformPoint(pen + sf::Vector2f{ right - italicShear * bottom, bottom }), color, sf::Vector2f{ u2, v2 } };
+
+	vertices.insert(vertices.end(), { topLeft, topRight, bottomLeft, bottomLeft, topRight, bottomRight });
+}
+
+
+void RenderBatch::prepare(const ArenaVector<SpriteWrapper>& sprites, const ArenaVector<TextWrapper>& texts, std::uint32_t frame) noexcept
+{
+	const size_t nbOfSprites{ sprites.size() };
+	bool needsRebuild{ m_elements.size() != nbOfSprites + texts.size() || m_fontGeneration != TextWrapper::getFontGeneration() };
+
+	for (std::uint32_t i{ 0 }; i < m_elements.size() && !needsRebuild; ++i)
+	{
+		Element& element{ m_elements[i] };
+		const TransformableWrapper* wrapper{ (i < nbOfSprites) ? static_cast<const TransformableWrapper*>(&sprites[i]) : &texts[i - nbOfSprites] };
+
+		if (element.wrapper != wrapper) [[unlikely]]
+		{	// The collection was reallocated.
+			needsRebuild = true;
+			break;
+		}
+
+		if (element.hide != wrapper->hide) [[unlikely]]
+		{	// Hidden elements keep their place in their batch, so the order is not affected.
+			element.hide = wrapper->hide;
+			m_batches[element.batch].dirty = true;
+		}
+
+		if (element.revision == wrapper->getRevision()) [[likely]]
+			continue;
+
+		const sf::Texture* previousTexture{ element.texture };
+		const sf::FloatRect previousBounds{ element.bounds };
+		const bool wasDirect{ element.direct };
+
+		if (i < nbOfSprites)
+			updateElement(element, sprites[i]);
+		else
+			updateElement(element, texts[i - nbOfSprites]);
+
+		m_batches[element.batch].dirty = true;
+
+		if (element.texture != previousTexture || element.direct != wasDirect) [[unlikely]]
+			needsRebuild = true; // The element does not belong to its batch anymore.
+		else if (element.bounds != previousBounds && !isOrderPreserved(i)) [[unlikely]]
+			needsRebuild = true; // The element now overlaps another one it was reordered with.
+	}
+
+	if (needsRebuild) [[unlikely]]
+		rebuild(sprites, texts);
+
+	for (Batch& batch : m_batches)
+	{
+		if (!batch.dirty)
+			continue;
+
+		// Only the batches that contain a modified element are rebuilt.
+		batch.vertexArray.clear();
+
+		for (const std::uint32_t index : batch.elements)
+			if (!m_elements[index].hide)
+				for (const sf::Vertex& vertex : m_elements[index].vertices)
+					batch.vertexArray.append(vertex);
+
+		batch.dirty = false;
+	}
+
+	m_isPrepared = true;
+	m_preparedFrame = frame;
+}
+
+void RenderBatch::draw(sf::RenderTarget& target, const ArenaVector<SpriteWrapper>& sprites, const ArenaVector<TextWrapper>& texts, std::uint32_t frame) noexcept
+{
+	if (!m_isPrepared || m_preparedFrame != frame || m_fontGeneration != TextWrapper::getFontGeneration()) // Prepared during an earlier frame, but never drawn, or before glyph pages were released.
+		prepare(sprites, texts, frame);
+	m_isPrepared = false; // The next frame is prepared again.
+
+	for (const Batch& batch : m_batches)
+	{
+		if (batch.directText != nullptr) [[unlikely]]
+		{
+			if (!m_elements[batch.elements.front()].hide)
+			{
+				target.draw(*batch.directText);
+				PROFILE_COUNT(drawCalls, 1);
+			}
+		}
+		else if (batch.vertexArray.getVertexCount() != 0)
+		{
+			sf::RenderStates states{};
+			states.texture = batch.texture;
+			target.draw(batch.vertexArray, states);
+			PROFILE_COUNT(drawCalls, 1);
+		}
+	}
+}
+
+void RenderBatch::clear() noexcept
+{
+	m_elements.clear();
+	m_batches.clear();
+	m_isPrepared = false;
+}
+
+void RenderBatch::rebuild(const ArenaVector<SpriteWrapper>& sprites, const ArenaVector<TextWrapper>& texts) noexcept
+{
+	clear();
+	m_elements.resize(sprites.size() + texts.size());
+
+	if (const std::uint32_t fontGeneration{ TextWrapper::getFontGeneration() }; fontGeneration != m_fontGeneration)
+	{	// Glyph pages were replaced, or a font was removed and its address may be reused.
+		m_glyphCaches.clear();
+		m_fontGeneration = fontGeneration;
+	}
+
+	for (std::uint32_t i{ 0 }; i < m_elements.size(); ++i)
+	{
+		Element& element{ m_elements[i] };
+
+		if (i < sprites.size())
+		{
+			element.wrapper = &sprites[i];
+			updateElement(element, sprites[i]);
+		}
+		else
+		{
+			element.wrapper = &texts[i - sprites.size()];
+			updateElement(element, texts[i - sprites.size()]);
+		}
+		element.hide = element.wrapper->hide;
+
+		// Looking backward for a batch with the same texture. We can't go past a batch that overlaps
+		// the element, since the element would then be drawn below something that should be below it.
+		size_t candidate{ m_batches.size() };
+		if (!element.direct)
+		{
+			for (size_t j{ m_batches.size() }; j-- > 0;)
+			{
+				if (m_batches[j].directText == nullptr && m_batches[j].texture == element.texture)
+				{
+					candidate = j;
+					break;
+				}
+
+				if (overlaps(m_batches[j].bounds, element.bounds))
+					break;
+			}
+		}
+
+		if (candidate == m_batches.size())
+		{
+			const sf::Text* directText{ element.direct ? &texts[i - sprites.size()].getText() : nullptr }; // Sprites are never direct.
+			m_batches.push_back(Batch{ element.texture, directText, element.bounds, {}, sf::VertexArray{ sf::PrimitiveType::Triangles }, true });
+		}
+		else
+		{
+			sf::FloatRect& bounds{ m_batches[candidate].bounds };
+			const sf::Vector2f topLeft{ std::min(bounds.position.x, element.bounds.position.x), std::min(bounds.position.y, element.bounds.position.y) };
+			const sf::Vector2f bottomRight{ std::max(bounds.position.x + bounds.size.x, element.bounds.position.x + element.bounds.size.x), std::max(bounds.position.y + bounds.size.y, element.bounds.position.y + element.bounds.size.y) };
+			bounds = sf::FloatRect{ topLeft, bottomRight - topLeft };
+		}
+
+		element.batch = static_cast<std::uint32_t>(candidate);
+		m_batches[candidate].elements.push_back(i);
+	}
+}
+
+bool RenderBatch::isOrderPreserved(std::uint32_t index) const noexcept
+{
+	const Element& element{ m_elements[index] };
+
+	// Elements that were drawn before this one must still be drawn before it, and vice versa,
+	// unless they do not overlap.
+	for (std::uint32_t i{ 0 }; i < m_elements.size(); ++i)
+	{
+		const bool reordered{ (i < index && m_elements[i].batch > element.batch) || (i > index && m_elements[i].batch < element.batch) };
+
+		if (reordered && overlaps(m_elements[i].bounds, element.bounds))
+			return false;
+	}
+
+	return true;
+}
+
+void RenderBatch::updateElement(Element& element, const SpriteWrapper& sprite) noexcept
+{
+	const sf::Sprite& wrappedSprite{ sprite.getSprite() };
+
+	element.revision = sprite.getRevision();
+	element.texture = &wrappedSprite.getTexture();
+	element.direct = false;
+	element.bounds = sprite.getGlobalBounds();
+
+	const sf::Transform& transform{ wrappedSprite.getTransform() };
+	const sf::FloatRect rect{ wrappedSprite.getTextureRect() };
+	const sf::Vector2f size{ std::abs(rect.size.x), std::abs(rect.size.y) };
+	const sf::Color color{ wrappedSprite.getColor() };
+
+	const sf::Vertex topLeft    { transform.transformPoint(sf::Vector2f{ 0.f,    0.f    }), color, rect.position };
+	const sf::Vertex topRight   { transform.transformPoint(sf::Vector2f{ size.x, 0.f    }), color, sf::Vector2f{ rect.position.x + rect.size.x, rect.position.y } };
+	const sf::Vertex bottomLeft { transform.transformPoint(sf::Vector2f{ 0.f,    size.y }), color, sf::Vector2f{ rect.position.x, rect.position.y + rect.size.y } };
+	const sf::Vertex bottomRight{ transform.transformPoint(size), color, rect.position + rect.size };
+
+	element.vertices.assign({ topLeft, topRight, bottomLeft, bottomLeft, topRight, bottomRight });
+}
+
+void RenderBatch::updateElement(Element& element, const TextWrapper& text) noexcept
+{
+	const sf::Text& wrappedText{ text.getText() };
+	const unsigned int characterSize{ wrappedText.getCharacterSize() };
+	const std::uint32_t style{ wrappedText.getStyle() };
+	const bool isBold{ (style & sf::Text::Bold) != 0 };
+	std::mutex& fontMutex{ text.m_registry->mutex }; // Fonts are shared with the interfaces prepared by other threads.
+	GlyphCache& cache{ findGlyphCache(wrappedText.getFont(), characterSize, isBold, fontMutex) };
+
+	element.revision = text.getRevision();
+	element.texture = cache.page;
+	element.direct = (wrappedText.getOutlineThickness() != 0.f) || ((style & (sf::Text::Underlined | sf::Text::StrikeThrough)) != 0);
+	element.vertices.clear();
+
+	if (element.direct) [[unlikely]]
+	{	// Laid out by `sf::Text` itself, which reads the font.
+		element.bounds = text.getGlobalBounds();
+		return;
+	}
+
+	// Same layout and bounds as `sf::Text`, but the vertices are directly transformed into world
+	// coordinates, and the glyphs are read from the cache.
+	const float italicShear{ ((style & sf::Text::Italic) != 0) ? sf::degrees(12).asRadians() : 0.f };
+	const float letterSpacing{ (cache.whitespaceWidth / 3.f) * (wrappedText.getLetterSpacing() - 1.f) };
+	const float whitespaceWidth{ cache.whitespaceWidth + letterSpacing };
+	const float lineSpacing{ cache.lineSpacing * wrappedText.getLineSpacing() };
+
+	const sf::Transform& transform{ wrappedText.getTransform() };
+	const sf::Color color{ wrappedText.getFillColor() };
+
+	sf::Vector2f pen{ 0.f, static_cast<float>(characterSize) };
+	sf::Vector2f boundsMin{ static_cast<float>(characterSize), static_cast<float>(characterSize) };
+	sf::Vector2f boundsMax{ 0.f, 0.f };
+	char32_t previousChar{ 0 };
+	for (const char32_t currentChar : wrappedText.getString())
+	{
+		if (currentChar == U'\r')
+			continue;
+
+		pen.x += getKerning(cache, fontMutex, previousChar, currentChar);
+		previousChar = currentChar;
+
+		if (currentChar == U' ' || currentChar == U'\t' || currentChar == U'\n')
+		{
+			boundsMin = sf::Vector2f{ std::min(boundsMin.x, pen.x), std::min(boundsMin.y, pen.y) };
+
+			if (currentChar == U' ')
+				pen.x += whitespaceWidth;
+			else if (currentChar == U'\t')
+				pen.x += whitespaceWidth * 4;
+			else
+				pen = sf::Vector2f{ 0.f, pen.y + lineSpacing };
+
+			boundsMax = sf::Vector2f{ std::max(boundsMax.x, pen.x), std::max(boundsMax.y, pen.y) };
+			continue;
+		}
+
+		const sf::Glyph glyph{ getGlyph(cache, fontMutex, currentChar) };
+		appendGlyph(element.vertices, transform, pen, color, glyph, italicShear);
+
+		const float top{ glyph.bounds.position.y };
+		const float bottom{ glyph.bounds.position.y + glyph.bounds.size.y };
+		boundsMin = sf::Vector2f{ std::min(boundsMin.x, pen.x + glyph.bounds.position.x - italicShear * bottom), std::min(boundsMin.y, pen.y + top) };
+		boundsMax = sf::Vector2f{ std::max(boundsMax.x, pen.x + glyph.bounds.position.x + glyph.bounds.size.x - italicShear * top), std::max(boundsMax.y, pen.y + bottom) };
+
+		pen.x += glyph.advance + letterSpacing;
+	}
+
+	const sf::FloatRect localBounds{ wrappedText.getString().isEmpty() ? sf::FloatRect{} : sf::FloatRect{ boundsMin, boundsMax - boundsMin } };
+	element.bounds = transform.transformRect(localBounds);
+}
+
+RenderBatch::GlyphCache& RenderBatch::findGlyphCache(const sf::Font& font, unsigned int characterSize, bool isBold, std::mutex& fontMutex) noexcept
+{
+	for (GlyphCache& cache : m_glyphCaches)
+		if (cache.font == &font && cache.characterSize == characterSize && cache.isBold == isBold) [[likely]]
+			return cache;
+
+	std::lock_guard lock{ fontMutex };
+	const float whitespaceWidth{ font.getGlyph(U' ', characterSize, isBold).advance };
+	return m_glyphCaches.emplace_back(GlyphCache{ .font = &font, .characterSize = characterSize, .isBold = isBold, .page = &font.getTexture(characterSize), .whitespaceWidth = whitespaceWidth, .lineSpacing = font.getLineSpacing(characterSize) });
+}
+
+sf::Glyph RenderBatch::getGlyph(GlyphCache& cache, std::mutex& fontMutex, char32_t character) noexcept
+{
+	if (const auto cached{ cache.glyphs.find(character) }; cached != cache.glyphs.end()) [[likely]]
+		return cached->second;
+
+	std::lock_guard lock{ fontMutex }; // Rasterizes the glyph into the page if no text displayed it yet.
+	return cache.glyphs.try_emplace(character, cache.font->getGlyph(character, cache.characterSize, cache.isBold)).first->second;
+}
+
+float RenderBatch::getKerning(GlyphCache& cache, std::mutex& fontMutex, char32_t previous, char32_t current) noexcept
+{
+	if (previous == 0)
+		return 0.f; // Same as `sf::Font::getKerning`.
+
+	const std::uint64_t pair{ (static_cast<std::uint64_t>(previous) << 32) | current };
+	if (const auto cached{ cache.kernings.find(pair) }; cached != cache.kernings.end()) [[likely]]
+		return cached->second;
+
+	std::lock_guard lock{ fontMutex };
+	return cache.kernings.try_emplace(pair, cache.font->getKerning(previous, current, cache.characterSize, cache.isBold)).first->second;
+}
+
+} // gui namespace
@@ -0,0 +1,237 @@
+/*******************************************************************
+ * \file   RenderBatch.hpp, RenderBatch.cpp
+ * \brief  Declare a renderer that groups the drawables of an interface into a few vertex arrays.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note These files depend on the SFML library.
+ *********************************************************************/
+
+#ifndef RENDERBATCH_HPP
+#define RENDERBATCH_HPP
+
+#include "GraphicalResources.hpp"
+#include "FlatMap.hpp"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+
+namespace gui
+{
+
+/**
+ * \brief Draws sprites and texts with as few draw calls as possible.
+ *
+ * Consecutive elements sharing the same texture (the texture of a sprite, or the glyph page of a
+ * font for a given character size) are merged into a single `sf::VertexArray`. An element may also
+ * join an earlier batch that uses the same texture, as long as it does not overlap any element drawn
+ * in between: the visual result is therefore identical to drawing every element one by one.
+ *
+ * Vertices are cached. At each call of `draw`, the revision and the hide flag of every wrapper are
+ * compared with the cached ones: only the elements that actually changed have their vertices
+ * recomputed, and only the batches they belong to are rebuilt. Batches are regrouped from scratch if a
+ * texture changes, or if an element moves over another one it was reordered with.
+ *
+ * Texts with an outline, underlined or striked through are not batched; they are drawn directly.
+ * Others are laid out from the glyphs cached by the batch: their font is only read the first time a
+ * glyph, or a pair of characters, is met.
+ *
+ * \note The collections of elements must not be modified while the batch is used (which is the case
+ *		 for locked interfaces). If their address changes, everything is rebuilt.
+ *
+ * \see `BasicInterface::lockInterface`, `TransformableWrapper::getRevision`.
+ */
+class RenderBatch
+{
+public:
+
+	constexpr RenderBatch() noexcept = default;
+	RenderBatch(const RenderBatch&) noexcept = delete;
+	RenderBatch(RenderBatch&&) noexcept = default;
+	RenderBatch& operator=(const RenderBatch&) noexcept = delete;
+	RenderBatch& operator=(RenderBatch&&) noexcept = default;
+	~RenderBatch() noexcept = default;
+
+
+	/**
+	 * \brief Updates the cached vertex arrays if needed, without drawing anything.
+	 * \complexity O(N), where N is the number of elements, if nothing changed or if only a few elements
+	 *			   changed. O(N * B) when everything is regrouped, where B is the number of batches.
+	 *
+	 * Only touches memory: it can be called by a worker thread, as long as no other thread uses the
+	 * elements. The next call of `draw` then only issues the draw calls. Fonts are shared with the
+	 * interfaces prepared by other threads: they are only read under the mutex of their registry, when
+	 * a glyph or a pair of characters is not cached yet, or when a text drawn directly changed.
+	 *
+	 * \param[in] sprites The sprites to draw.
+	 * \param[in] texts The texts to draw.
+	 * \param[in] frame The frame the vertices are prepared for.
+	 *
+	 * \see `FramePreparer`.
+	 */
+	void prepare(const ArenaVector<SpriteWrapper>& sprites, const ArenaVector<TextWrapper>& texts, std::uint32_t frame) noexcept;
+
+	/**
+	 * \brief Updates the cached vertex arrays if needed, then draws them.
+	 * \complexity O(B), where B is the number of batches, if `prepare` was called for this frame since
+	 *			   the previous draw. Otherwise, same as `prepare`.
+	 *
+	 * Sprites are drawn before texts, in the order of their collection.
+	 *
+	 * \param[out] target Where the elements are drawn.
+	 * \param[in]  sprites The sprites to draw.
+	 * \param[in]  texts The texts to draw.
+	 * \param[in]  frame The frame being drawn. Vertices prepared for another frame are not trusted: the
+	 *			   elements may have changed since, so they are prepared again. So are the vertices
+	 *			   prepared before the glyph pages of a font were released.
+	 *
+	 * \note Elements modified between `prepare` and `draw` within the same frame are displayed as they
+	 *		 were when prepared, until the next frame.
+	 */
+	void draw(sf::RenderTarget& target, const ArenaVector<SpriteWrapper>& sprites, const ArenaVector<TextWrapper>& texts, std::uint32_t frame) noexcept;
+
+	/**
+	 * \brief Drops every cached vertex. The next call of `draw` rebuilds everything.
+	 * \complexity O(N), where N is the number of elements.
+	 */
+	void clear() noexcept;
+
+	/**
+	 * \brief Returns the number of batches, which is the maximum number of draw calls of a frame.
+	 * \complexity O(1).
+	 *
+	 * \return The number of batches built during the last call of `draw`.
+	 */
+	[[nodiscard]] inline size_t getBatchCount() const noexcept
+	{
+		return m_batches.size();
+	}
+
+private:
+
+	/**
+	 * \brief The cached state of an element.
+	 */
+	struct Element
+	{
+		const TransformableWrapper* wrapper; // The element this cache was built from.
+		const sf::Texture* texture; // The texture used to draw the element.
+		std::uint32_t revision; // The revision of the wrapper when the vertices were computed.
+		std::uint32_t batch; // The index of its batch.
+		bool hide; // The hide flag of the wrapper when the batch was built.
+		bool direct; // If true, the element can't be batched and is drawn by itself.
+		sf::FloatRect bounds; // The global bounds of the element.
+		std::vector<sf::Vertex> vertices; // Triangles, in world coordinates.
+	};
+
+	/**
+	 * \brief A group of elements drawn with a single draw call.
+	 */
+	struct Batch
+	{
+		const sf::Texture* texture; // The texture shared by all elements.
+		const sf::Text* directText; // Non null if this batch draws a single text that could not be batched.
+		sf::FloatRect bounds; // The union of the bounds of all elements, hidden or not.
+		std::vector<std::uint32_t> elements; // Indexes of the elements, in drawing order.
+		sf::VertexArray vertexArray; // The concatenation of the vertices of the visible elements.
+		bool dirty; // If true, the vertex array must be rebuilt.
+	};
+
+	/**
+	 * \brief What the layout of texts needs from a font, for a character size and a style.
+	 *
+	 * Filled as texts are laid out, so that the font, which rasterizes its glyphs on demand, is only
+	 * read the first time a glyph or a pair of characters is met.
+	 */
+	struct GlyphCache
+	{
+		const sf::Font* font;
+		unsigned int characterSize;
+		bool isBold;
+		const sf::Texture* page; // The glyph page of the character size. Its address is kept until the pages are released.
+		float whitespaceWidth; // The advance of a space, letter spacing excluded.
+		float lineSpacing; // Line spacing factor excluded.
+		FlatMap<char32_t, sf::Glyph> glyphs{};
+		FlatMap<std::uint64_t, float> kernings{}; // The previous character in the upper bits, the current one in the lower bits.
+	};
+
+
+	/**
+	 * \brief Regroups all elements into batches.
+	 * \complexity O(N * B), where N is the number of elements and B the number of batches.
+	 */
+	void rebuild(const ArenaVector<SpriteWrapper>& sprites, const ArenaVector<TextWrapper>& texts) noexcept;
+
+	/**
+	 * \brief Tells whether an element that moved can stay in its batch without changing the visual result.
+	 * \complexity O(N), where N is the number of elements.
+	 *
+	 * \param[in] index The index of the element that moved.
+	 *
+	 * \return `true` if the element does not overlap any element it was reordered with.
+	 */
+	[[nodiscard]] bool isOrderPreserved(std::uint32_t index) const noexcept;
+
+	/**
+	 * \brief Recomputes the cached state of an element from its wrapper.
+	 * \complexity O(L), where L is the length of the text (O(1) for sprites).
+	 */
+	static void updateElement(Element& element, const SpriteWrapper& sprite) noexcept;
+
+	/**
+	 * \see `updateElement`.
+	 */
+	void updateElement(Element& element, const TextWrapper& text) noexcept;
+
+	/**
+	 * \brief Returns the cache of a font for a character size and a style, creating it if needed.
+	 * \complexity O(C), where C is the number of caches.
+	 *
+	 * \param[in] font The font of the text.
+	 * \param[in] characterSize The character size of the text.
+	 * \param[in] isBold If true, the bold glyphs are cached.
+	 * \param[in] fontMutex Locked while the font is read.
+	 */
+	[[nodiscard]] GlyphCache& findGlyphCache(const sf::Font& font, unsigned int characterSize, bool isBold, std::mutex& fontMutex) noexcept;
+
+	/**
+	 * \brief Returns a glyph, read from the font if it is not cached yet.
+	 * \complexity O(1).
+	 *
+	 * \param[in,out] cache Where the glyph is cached.
+	 * \param[in] fontMutex Locked while the font is read.
+	 * \param[in] character The character of the glyph.
+	 */
+	[[nodiscard]] static sf::Glyph getGlyph(GlyphCache& cache, std::mutex& fontMutex, char32_t character) noexcept;
+
+	/**
+	 * \brief Returns the kerning between two characters, read from the font if it is not cached yet.
+	 * \complexity O(1).
+	 *
+	 * \param[in,out] cache Where the kerning is cached.
+	 * \param[in] fontMutex Locked while the font is read.
+	 * \param[in] previous The previous character, 0 if none.
+	 * \param[in] current The current character.
+	 */
+	[[nodiscard]] static float getKerning(GlyphCache& cache, std::mutex& fontMutex, char32_t previous, char32_t current) noexcept;
+
+
+	/// The cached state of all elements. Sprites first, then texts.
+	std::vector<Element> m_elements{};
+	/// All batches, in drawing order.
+	std::vector<Batch> m_batches{};
+	/// The glyphs met by the texts, for each font, character size and style. Searched linearly: there are only a few.
+	std::vector<GlyphCache> m_glyphCaches{};
+	/// The font generation when the glyphs were cached: glyph pages may have been replaced since.
+	std::uint32_t m_fontGeneration{ 0 };
+	/// If true, `prepare` was called since the previous draw: the vertex arrays are up to date.
+	bool m_isPrepared{ false };
+	/// The frame `prepare` was last called for. Prepared vertices are only drawn during that frame.
+	std::uint32_t m_preparedFrame{ 0 };
+};
+
+} // gui namespace
+
+#endif // RENDERBATCH_HPP
@@ -0,0 +1,23 @@
+#include "ResourceContext.hpp"
+
+namespace gui
+{
+
+ResourceContext::~ResourceContext() noexcept
+{
+	assert(m_interfaces.empty() && "Precondition violated; an interface still belonged to the context when the destructor of ResourceContext was called");
+
+	if (s_current == this)
+		s_current = nullptr; // The thread falls back on the default context.
+
+	// The stores are destroyed with the context: each frees its memory at once, without looking up
+	// any name. Files still being decoded are pushed into a queue the workers share, and discarded.
+}
+
+ResourceContext& ResourceContext::getDefault() noexcept
+{
+	static ResourceContext defaultContext{};
+	return defaultContext;
+}
+
+} // gui namespace
@@ -0,0 +1,161 @@
+/*******************************************************************
+ * \file   ResourceContext.hpp, ResourceContext.cpp
+ * \brief  Declare the owner of the textures, fonts and interfaces that are used together.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note These files depend on the SFML library.
+ * \note All assertions are disabled in release mode. If broken, undefined behavior will occur.
+ *********************************************************************/
+
+#ifndef RESOURCECONTEXT_HPP
+#define RESOURCECONTEXT_HPP
+
+#include "GraphicalResources.hpp"
+#include <SFML/Graphics.hpp>
+#include <unordered_map>
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+namespace gui
+{
+
+class BasicInterface;
+
+/**
+ * \brief Owns textures and fonts, and knows the interfaces that use them.
+ *
+ * The static functions of `TextWrapper` and `SpriteWrapper` (`createTexture`, `getFont`,
+ * `uploadStreamedTextures`...) act on the context of the calling thread. Wrappers and interfaces
+ * belong to the context that was current when they were constructed. Threads that never bind a
+ * context share the default one, which behaves as if there was no context at all.
+ *
+ * Two contexts share nothing: independent interfaces, such as an editor window and a preview window,
+ * can run on separate threads without any contention, each thread binding its own context. Destroying
+ * a context frees all of its textures and fonts at once, instead of removing them one name at a time.
+ *
+ * \note A context is not thread-safe: it should only be used by one thread at a time. The default
+ *		 one is current on every thread that did not bind another one.
+ *
+ * \code
+ * std::jthread preview{ [&previewWindow]()
+ * {
+ *		gui::ResourceContext context{};
+ *		gui::ResourceContext::Binding binding{ context }; // This thread uses its own resources.
+ *
+ *		gui::SpriteWrapper::createTexture("scene", "scene.png");
+ *		gui::BasicInterface interface{ &previewWindow };
+ *		// ...
+ * } }; // The interface is destroyed, then the context and all its resources.
+ * \endcode
+ *
+ * \see `TextWrapper`, `SpriteWrapper`, `BasicInterface`.
+ */
+class ResourceContext
+{
+public:
+
+	/**
+	 * \brief Makes a context current on the calling thread, until the end of the scope.
+	 *
+	 * Bindings can be nested: the previous context is current again once the binding is destroyed.
+	 */
+	class Binding
+	{
+	public:
+
+		inline explicit Binding(ResourceContext& context) noexcept
+			: m_previous{ std::exchange(s_current, &context) }
+		{}
+
+		Binding(const Binding&) noexcept = delete;
+		Binding(Binding&&) noexcept = delete;
+		Binding& operator=(const Binding&) noexcept = delete;
+		Binding& operator=(Binding&&) noexcept = delete;
+
+		inline ~Binding() noexcept
+		{
+			s_current = m_previous;
+		}
+
+	private:
+
+		/// The context that was current before, or nullptr for the default one.
+		ResourceContext* m_previous;
+	};
+
+
+	inline ResourceContext() noexcept
+		: m_fonts{}, m_textures{}, m_interfaces{}, m_frame{ 0 }
+	{}
+
+	ResourceContext(const ResourceContext&) noexcept = delete;
+	ResourceContext(ResourceContext&&) noexcept = delete;
+	ResourceContext& operator=(const ResourceContext&) noexcept = delete;
+	ResourceContext& operator=(ResourceContext&&) noexcept = delete;
+	~ResourceContext() noexcept; /// \complexity O(N), where N is the number of textures and fonts.
+
+
+	/**
+	 * \brief Returns the context of the calling thread: the last one bound, or the default one.
+	 * \complexity O(1).
+	 *
+	 * \see `Binding`, `getDefault`.
+	 */
+	[[nodiscard]] inline static ResourceContext& current() noexcept
+	{
+		return (s_current != nullptr) ? *s_current : getDefault();
+	}
+
+	/**
+	 * \brief Returns the context of the threads that did not bind any.
+	 * \complexity O(1).
+	 *
+	 * The context is created the first time this function is called.
+	 */
+	[[nodiscard]] static ResourceContext& getDefault() noexcept;
+
+	/**
+	 * \brief Returns the number of textures, whether they are loaded or not.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t getTextureCount() const noexcept
+	{
+		return m_textures.allTextures.size();
+	}
+
+	/**
+	 * \brief Returns the number of fonts.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t getFontCount() const noexcept
+	{
+		return m_fonts.allFonts.size();
+	}
+
+private:
+
+	friend class TextWrapper;
+	friend class SpriteWrapper;
+	friend class BasicInterface;
+	friend class FramePreparer;
+
+
+	/// All fonts of the context.
+	TextWrapper::FontRegistry m_fonts;
+	/// All textures of the context.
+	SpriteWrapper::TextureRegistry m_textures;
+	/// Collection of all interfaces to perform resizing. Stored by window.
+	std::unordered_map<sf::RenderWindow*, std::vector<BasicInterface*>> m_interfaces;
+	/// Incremented by each `FramePreparer::prepare`: vertices prepared for an earlier frame are not drawn.
+	std::uint32_t m_frame;
+
+	/// The context bound on each thread, or nullptr for the default one.
+	inline static thread_local ResourceContext* s_current{ nullptr };
+};
+
+} // gui namespace
+
+#endif // RESOURCECONTEXT_HPP
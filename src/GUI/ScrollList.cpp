@@ -0,0 +1,199 @@
+#include "ScrollList.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace gui
+{
+
+inline const static std::string scrollListIdPrefix{ "_sl_" };
+constexpr static float rowTolerance{ 0.01f }; // Accumulated scrolls must not hide rows aligned with the viewport.
+
+ScrollList::ScrollList(MutableInterface* gui, std::string identifier, sf::FloatRect viewport, float rowHeight, size_t nbOfColumns, unsigned int characterSize, std::string_view textureName)
+	: m_gui{ gui }, m_initialPositionFactor{ (gui != nullptr) ? gui->getPositionFactor() : sf::Vector2f{ 1.f, 1.f } }, m_viewport{ viewport }, m_rowHeight{ rowHeight }, m_columnWidth{ 0.f }, m_nbOfColumns{ nbOfColumns }, m_nbOfCellRows{ 0 }, m_texts{}, m_sprites{}, m_fill{}, m_nbOfItems{ 0 }, m_offset{ 0.f }, m_firstFilledRow{}, m_isHidden{ false }
+{
+	ENSURE_VALID_PTR(gui, "The gui was nullptr when the constructor of ScrollList was called");
+	assert(rowHeight > 0.f && rowHeight <= viewport.size.y && "Precondition violated; the row height is not within the viewport when the constructor of ScrollList was called");
+	assert(nbOfColumns > 0 && "Precondition violated; there is no column when the constructor of ScrollList was called");
+
+	m_columnWidth = viewport.size.x / static_cast<float>(nbOfColumns);
+	m_nbOfCellRows = static_cast<size_t>(viewport.size.y / rowHeight) + 1; // One more row, for partially scrolled positions.
+
+	const size_t nbOfCells{ m_nbOfCellRows * m_nbOfColumns };
+	const std::string cellIdPrefix{ scrollListIdPrefix + identifier + '_' };
+
+	m_texts.reserve(nbOfCells);
+	m_sprites.reserve(textureName.empty() ? 0 : nbOfCells);
+	gui->reserve(nbOfCells, textureName.empty() ? 0 : nbOfCells);
+
+	try
+	{
+		for (size_t i{ 0 }; i < nbOfCells; ++i)
+		{
+			const std::string cellId{ cellIdPrefix + std::to_string(i) };
+
+			if (!textureName.empty()) // Added first, so that the sprite is drawn below the text.
+			{
+				gui->addDynamicSprite(cellId, textureName, viewport.position, sf::Vector2f{ 1.f, 1.f }, sf::IntRect{}, sf::degrees(0), Alignment::Left | Alignment::Top);
+				m_sprites.push_back(gui->getSpriteHandle(cellId));
+				gui->getDynamicSprite(m_sprites.back())->hide = true;
+			}
+
+			gui->addDynamicText(cellId, "", viewport.position, characterSize, sf::Color::White, "__default", Alignment::Left | Alignment::Top);
+			m_texts.push_back(gui->getTextHandle(cellId));
+			gui->getDynamicText(m_texts.back())->hide = true; // Until there are items.
+		}
+	}
+	catch (...)
+	{
+		remove();
+		throw;
+	}
+}
+
+void ScrollList::setItems(size_t nbOfItems, CellFunction fill)
+{
+	assert(fill != nullptr && "Precondition violated; the function is empty when the function setItems of ScrollList was called");
+
+	m_fill = std::move(fill);
+	setNbOfItems(nbOfItems);
+}
+
+void ScrollList::setNbOfItems(size_t nbOfItems)
+{
+	m_nbOfItems = nbOfItems;
+	m_offset = std::min(m_offset, getMaxOffset());
+	layout(true);
+}
+
+void ScrollList::refresh()
+{
+	layout(true);
+}
+
+void ScrollList::scroll(float delta)
+{
+	scrollTo(m_offset + delta);
+}
+
+void ScrollList::scrollTo(float offset)
+{
+	offset = std::clamp(offset, 0.f, getMaxOffset());
+	if (offset == m_offset && m_firstFilledRow.has_value())
+		return; // Nothing moves: no cell is touched.
+
+	m_offset = offset;
+	layout(false);
+}
+
+void ScrollList::scrollToItem(size_t item)
+{
+	scrollTo(static_cast<float>(item / m_nbOfColumns) * m_rowHeight);
+}
+
+std::optional<size_t> ScrollList::getItemAt(sf::Vector2f pos) const noexcept
+{
+	const sf::Vector2f resizeRatio{ computeResizeRatio() };
+	pos = sf::Vector2f{ pos.x / resizeRatio.x, pos.y / resizeRatio.y }; // Into the coordinates of the viewport.
+
+	if (m_isHidden || !m_viewport.contains(pos))
+		return std::nullopt;
+
+	const size_t row{ static_cast<size_t>((pos.y - m_viewport.position.y + m_offset) / m_rowHeight) };
+	const float rowTop{ m_viewport.position.y + static_cast<float>(row) * m_rowHeight - m_offset };
+	if (rowTop < m_viewport.position.y - rowTolerance || rowTop + m_rowHeight > m_viewport.position.y + m_viewport.size.y + rowTolerance)
+		return std::nullopt; // Partially visible rows are hidden.
+
+	const size_t column{ std::min(static_cast<size_t>((pos.x - m_viewport.position.x) / m_columnWidth), m_nbOfColumns - 1) };
+	const size_t item{ row * m_nbOfColumns + column };
+
+	return (item < m_nbOfItems) ? std::optional<size_t>{ item } : std::nullopt;
+}
+
+void ScrollList::setHidden(bool hide)
+{
+	m_isHidden = hide;
+
+	if (hide)
+	{
+		for (const MutableInterface::TextHandle text : m_texts)
+			if (TextWrapper* const cell{ m_gui->getDynamicText(text) }; cell != nullptr)
+				cell->hide = true;
+		for (const MutableInterface::SpriteHandle sprite : m_sprites)
+			if (SpriteWrapper* const cell{ m_gui->getDynamicSprite(sprite) }; cell != nullptr)
+				cell->hide = true;
+	}
+	else
+	{
+		layout(false); // Shows back the visible cells only. Filled cells are not refilled, unless the last fill threw.
+	}
+}
+
+void ScrollList::remove() noexcept
+{
+	for (const MutableInterface::TextHandle text : m_texts)
+		m_gui->removeDynamicText(text);
+	for (const MutableInterface::SpriteHandle sprite : m_sprites)
+		m_gui->removeDynamicSprite(sprite);
+
+	m_texts.clear();
+	m_sprites.clear();
+	m_nbOfItems = 0;
+	m_firstFilledRow.reset();
+}
+
+float ScrollList::getMaxOffset() const noexcept
+{
+	const size_t nbOfRows{ (m_nbOfItems + m_nbOfColumns - 1) / m_nbOfColumns };
+	return std::max(static_cast<float>(nbOfRows) * m_rowHeight - m_viewport.size.y, 0.f);
+}
+
+void ScrollList::layout(bool refillAll)
+{
+	if (m_texts.empty()) [[unlikely]]
+		return; // Removed.
+
+	const size_t firstRow{ static_cast<size_t>(m_offset / m_rowHeight) };
+	const sf::Vector2f resizeRatio{ computeResizeRatio() };
+	const float viewportBottom{ m_viewport.position.y + m_viewport.size.y };
+	const std::optional<size_t> previousFirstRow{ std::exchange(m_firstFilledRow, std::nullopt) }; // Everything is refilled next time if the function throws.
+
+	for (size_t row{ firstRow }; row < firstRow + m_nbOfCellRows; ++row)
+	{
+		// Rows still displayed since the previous layout keep their content: they are only moved.
+		const bool isFilled{ !refillAll && previousFirstRow.has_value() && row >= *previousFirstRow && row < *previousFirstRow + m_nbOfCellRows };
+		const float rowTop{ m_viewport.position.y + static_cast<float>(row) * m_rowHeight - m_offset };
+		const bool isVisible{ !m_isHidden && rowTop >= m_viewport.position.y - rowTolerance && rowTop + m_rowHeight <= viewportBottom + rowTolerance };
+		const size_t firstCell{ (row % m_nbOfCellRows) * m_nbOfColumns };
+
+		for (size_t column{ 0 }; column < m_nbOfColumns; ++column)
+		{
+			const size_t item{ row * m_nbOfColumns + column };
+			TextWrapper* const text{ m_gui->getDynamicText(m_texts[firstCell + column]) };
+			SpriteWrapper* const sprite{ m_sprites.empty() ? nullptr : m_gui->getDynamicSprite(m_sprites[firstCell + column]) };
+
+			if (item >= m_nbOfItems || m_fill == nullptr)
+			{
+				text->hide = true;
+				if (sprite != nullptr)
+					sprite->hide = true;
+				continue;
+			}
+
+			if (!isFilled) // Cells are filled even if their row is partially visible, so that they only need to be shown once scrolled.
+				m_fill(item, *text, sprite);
+
+			const sf::Vector2f cellPos{ (m_viewport.position.x + static_cast<float>(column) * m_columnWidth) * resizeRatio.x, rowTop * resizeRatio.y };
+			text->setPosition(cellPos);
+			text->hide = !isVisible;
+			if (sprite != nullptr)
+			{
+				sprite->setPosition(cellPos);
+				sprite->hide = !isVisible;
+			}
+		}
+	}
+
+	m_firstFilledRow = firstRow;
+}
+
+} // gui namespace
@@ -0,0 +1,295 @@
+/*******************************************************************
+ * \file   ScrollList.hpp, ScrollList.cpp
+ * \brief  Declare a scrolling list, or grid, that displays any number of items with a fixed number
+ *		   of elements.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note These files depend on the SFML library.
+ * \note All assertions are disabled in release mode. If broken, undefined behavior will occur.
+ *********************************************************************/
+
+#ifndef SCROLLLIST_HPP
+#define SCROLLLIST_HPP
+
+#include "MutableInterface.hpp"
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <string_view>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace gui
+{
+
+/**
+ * \brief Displays a scrolling list, or grid, of items, creating only the elements needed to fill
+ *		  its viewport.
+ *
+ * Compound elements like mqbs create elements for each of their entries, which does not scale to
+ * large data sets. Instead, a scroll list creates cells for the rows visible in its viewport, plus
+ * one row for partially scrolled positions, whatever the number of items. Each cell is a dynamic
+ * text, and optionally a dynamic sprite drawn below it (a background, or an icon). The content of
+ * the cells is written by a user function, called with the index of the item.
+ *
+ * Cells are recycled as the list scrolls: the rows that stay visible are only moved, and the cells of
+ * the rows that leave the viewport are given to the rows that enter it. Scrolling by a few rows thus
+ * calls the user function for these few rows only, and a jump refills the viewport once.
+ *
+ * Cells are not interactive elements: `getItemAt` finds the hovered item in O(1) from the position,
+ * so that hovering only concerns the visible slice, never the whole data set. Call it instead of, or
+ * in addition to, `InteractiveInterface::eventUpdateHovered`.
+ *
+ * \note Interfaces do not clip their elements: rows that are only partially within the viewport are
+ *		 hidden.
+ * \note The viewport, the row height and the offsets are expressed in the coordinates the interface
+ *		 had when the list was created. The list follows the resizes of the window like any element of
+ *		 the interface: the cells are positioned, and the positions given to `getItemAt` converted,
+ *		 with the position factor of the interface.
+ * \note The cells are dynamic elements, with identifiers `_sl_identifier_i`, where i is the index of
+ *		 the cell. The interface must not be locked while the list is created, but can be afterward.
+ * \note The list does not own its cells: `remove` them before destroying the list, unless the
+ *		 interface is destroyed as well.
+ * \warning The interface must outlive the list.
+ *
+ * \code
+ * std::vector<std::string> names{ ... }; // 100 000 names.
+ * gui::ScrollList list{ &myInterface, "names", sf::FloatRect{ { 100, 100 }, { 400, 600 } }, 40.f };
+ * list.setItems(names.size(), [&names](size_t item, gui::TextWrapper& text, gui::SpriteWrapper*) { text.setContent(names[item]); });
+ * myInterface.lockInterface();
+ *
+ * // In the event loop.
+ * if (const auto* wheel{ event->getIf<sf::Event::MouseWheelScrolled>() })
+ *		list.scroll(-wheel->delta * 40.f);
+ * if (const auto* moved{ event->getIf<sf::Event::MouseMoved>() })
+ *		hoveredName = list.getItemAt(window.mapPixelToCoords(moved->position));
+ * \endcode
+ *
+ * \see `MutableInterface`, `InteractiveInterface::eventUpdateHovered`.
+ */
+class ScrollList
+{
+public:
+
+	/**
+	 * \brief Writes the content of an item into its cell.
+	 *
+	 * The text and the sprite are positioned by the list: the function sets their content, color,
+	 * texture and so on. The sprite is nullptr if the list has no sprites.
+	 */
+	using CellFunction = std::function<void(size_t item, TextWrapper& text, SpriteWrapper* sprite)>;
+
+
+	/**
+	 * \brief Adds the cells of the list to an interface. The list is empty until `setItems` is called.
+	 * \complexity O(C), where C is the number of cells: the number of rows within the viewport plus one,
+	 *			   times the number of columns.
+	 *
+	 * \param[out] gui The interface the cells are added to.
+	 * \param[in]  identifier The unique identifier of the list.
+	 * \param[in]  viewport The area the list is displayed in.
+	 * \param[in]  rowHeight The height of each row.
+	 * \param[in]  nbOfColumns The number of items per row: 1 for a list, more for a grid.
+	 * \param[in]  characterSize The character size of the texts.
+	 * \param[in]  textureName The texture of the sprites of the cells, or empty for no sprites.
+	 *
+	 * \pre The gui must be a valid ptr, and must not be locked.
+	 * \pre The row height must be strictly positive, and at most the height of the viewport.
+	 * \pre There must be at least one column.
+	 * \warning The program will assert otherwise.
+	 *
+	 * \throw LoadingGraphicalResourceFailure, std::invalid_argument if the texture does not exist, or
+	 *		  std::bad_alloc. Strong exception guarantee: no cell is added.
+	 */
+	ScrollList(MutableInterface* gui, std::string identifier, sf::FloatRect viewport, float rowHeight, size_t nbOfColumns = 1, unsigned int characterSize = 30, std::string_view textureName = {});
+
+	ScrollList(const ScrollList&) noexcept = delete;
+	ScrollList(ScrollList&&) noexcept = default;
+	ScrollList& operator=(const ScrollList&) noexcept = delete;
+	ScrollList& operator=(ScrollList&&) noexcept = default;
+	~ScrollList() noexcept = default;
+
+
+	/**
+	 * \brief Sets the items of the list, and refills all visible cells.
+	 * \complexity O(C), where C is the number of cells.
+	 *
+	 * The offset is kept, unless there are fewer items than before.
+	 *
+	 * \param[in] nbOfItems The number of items.
+	 * \param[in] fill Writes the content of an item into its cell.
+	 *
+	 * \pre The function must not be empty.
+	 * \warning The program will assert otherwise.
+	 * \throw What the function throws. Basic exception guarantee.
+	 */
+	void setItems(size_t nbOfItems, CellFunction fill);
+
+	/**
+	 * \brief Changes the number of items, with the same function, and refills all visible cells.
+	 * \complexity O(C), where C is the number of cells.
+	 *
+	 * \throw What the function throws. Basic exception guarantee.
+	 */
+	void setNbOfItems(size_t nbOfItems);
+
+	/**
+	 * \brief Refills all visible cells, when the displayed data changed.
+	 * \complexity O(C), where C is the number of cells.
+	 *
+	 * \throw What the function throws. Basic exception guarantee.
+	 */
+	void refresh();
+
+	/**
+	 * \brief Scrolls the list, by a distance clamped to its bounds.
+	 * \complexity O(C + R), where C is the number of cells and R the number of rows entering the viewport,
+	 *			   whose cells are refilled.
+	 *
+	 * \param[in] delta The distance: positive values scroll toward the last items.
+	 *
+	 * \throw What the function throws. Basic exception guarantee.
+	 */
+	void scroll(float delta);
+
+	/**
+	 * \brief Scrolls the list to an offset, clamped to its bounds.
+	 * \complexity O(C + R), as `scroll`.
+	 *
+	 * \param[in] offset The distance between the top of the first row and the top of the viewport.
+	 *
+	 * \throw What the function throws. Basic exception guarantee.
+	 */
+	void scrollTo(float offset);
+
+	/**
+	 * \brief Scrolls the list so that the row of an item is at the top of the viewport, or as close
+	 *		  as the bounds allow.
+	 * \complexity O(C + R), as `scroll`.
+	 *
+	 * \throw What the function throws. Basic exception guarantee.
+	 */
+	void scrollToItem(size_t item);
+
+	/**
+	 * \brief Returns the item displayed at a position, if any.
+	 * \complexity O(1).
+	 *
+	 * \param[in] pos The position, usually the one of the cursor, in the current coordinates.
+	 *
+	 * \return The index of the item, or nothing if the position is not over a visible item.
+	 */
+	[[nodiscard]] std::optional<size_t> getItemAt(sf::Vector2f pos) const noexcept;
+
+	/**
+	 * \brief Hides or shows all cells of the list.
+	 * \complexity O(C), where C is the number of cells.
+	 *
+	 * Showing the list refills its cells if a previous fill threw.
+	 *
+	 * \throw What the function throws. Basic exception guarantee.
+	 */
+	void setHidden(bool hide);
+
+	/**
+	 * \brief Removes the cells of the list from its interface. The list must not be used afterward.
+	 * \complexity O(C), where C is the number of cells.
+	 *
+	 * \pre The interface must not be locked.
+	 * \warning The program will assert otherwise.
+	 */
+	void remove() noexcept;
+
+	/**
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t getNbOfItems() const noexcept
+	{
+		return m_nbOfItems;
+	}
+
+	/**
+	 * \brief Returns the distance between the top of the first row and the top of the viewport.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline float getOffset() const noexcept
+	{
+		return m_offset;
+	}
+
+	/**
+	 * \brief Returns the largest offset: the one at which the last row is at the bottom of the viewport.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] float getMaxOffset() const noexcept;
+
+	/**
+	 * \brief Returns the number of cells, whatever the number of items.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t getNbOfCells() const noexcept
+	{
+		return m_texts.size();
+	}
+
+private:
+
+	/**
+	 * \brief Positions the cells of the rows from the first displayed one, fills the cells of the rows
+	 *		  that were not displayed before, and hides the others.
+	 * \complexity O(C + R), where C is the number of cells and R the number of refilled rows.
+	 *
+	 * \param[in] refillAll If true, all cells are refilled.
+	 */
+	void layout(bool refillAll);
+
+	/**
+	 * \brief Returns the factor from the coordinates at construction to the current ones.
+	 * \complexity O(1).
+	 *
+	 * \see `BasicInterface::getPositionFactor`.
+	 */
+	[[nodiscard]] inline sf::Vector2f computeResizeRatio() const noexcept
+	{
+		const sf::Vector2f positionFactor{ m_gui->getPositionFactor() };
+		return sf::Vector2f{ positionFactor.x / m_initialPositionFactor.x, positionFactor.y / m_initialPositionFactor.y };
+	}
+
+
+	/// The interface that contains the cells.
+	MutableInterface* m_gui;
+	/// The position factor of the interface when the list was created, in whose coordinates the geometry is stored.
+	sf::Vector2f m_initialPositionFactor;
+	/// The area the list is displayed in.
+	sf::FloatRect m_viewport;
+	/// The height of each row.
+	float m_rowHeight;
+	/// The width of each column: the width of the viewport divided by the number of columns.
+	float m_columnWidth;
+	/// The number of items per row.
+	size_t m_nbOfColumns;
+	/// The number of rows of cells. The cells of the row r display the items of the row r % m_nbOfCellRows.
+	size_t m_nbOfCellRows;
+
+	/// The texts of the cells, row after row.
+	std::vector<MutableInterface::TextHandle> m_texts;
+	/// The sprites of the cells, at the same index as their text. Empty if the list has no sprites.
+	std::vector<MutableInterface::SpriteHandle> m_sprites;
+
+	/// Writes the content of an item into its cell.
+	CellFunction m_fill;
+	/// The number of items.
+	size_t m_nbOfItems;
+	/// The distance between the top of the first row and the top of the viewport.
+	float m_offset;
+	/// The first row whose cells were filled, or nothing if none is.
+	std::optional<size_t> m_firstFilledRow;
+	/// If true, all cells are hidden.
+	bool m_isHidden;
+};
+
+} // gui namespace
+
+#endif // SCROLLLIST_HPP
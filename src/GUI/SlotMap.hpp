@@ -0,0 +1,373 @@
+/*******************************************************************
+ * \file   SlotMap.hpp
+ * \brief  Declare a container whose elements never move, accessed by generation-checked keys.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note This file only depends on the standard library.
+ *********************************************************************/
+
+#ifndef SLOTMAP_HPP
+#define SLOTMAP_HPP
+
+#include "ArenaAllocator.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <iterator>
+#include <cassert>
+
+namespace gui
+{
+
+/**
+ * \brief Stores elements by chunks, so that their address never changes while they exist.
+ *
+ * Inserting an element returns a key: a slot and the generation of this slot. Erasing the element
+ * increments the generation, so that the keys of removed elements are detected as stale even once their
+ * slot is reused. Slots are reused before new chunks are allocated, and chunks are never freed
+ * until the container is cleared or destroyed.
+ *
+ * Unlike a `std::list`, the elements of a chunk are contiguous, and a lookup costs two dependent
+ * reads (the chunk, then the element) instead of a node chase.
+ *
+ * The chunks may be allocated from a memory resource, which is also given to the elements that accept
+ * an allocator. Moving the container moves the resource along with the chunks.
+ *
+ * \note Pointers and references to an element remain valid until it is erased, whatever is inserted
+ *		 or erased in the meantime.
+ *
+ * \see `FlatMap`, to find elements with a key of your own.
+ */
+template<typename T>
+class SlotMap
+{
+private:
+
+	struct Slot
+	{
+		alignas(T) std::byte storage[sizeof(T)];
+		std::uint32_t generation{ 1 }; // 0 is kept for null keys.
+		bool isAlive{ false };
+
+		[[nodiscard]] inline T* get() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+		[[nodiscard]] inline const T* get() const noexcept { return std::launder(reinterpret_cast<const T*>(storage)); }
+	};
+
+public:
+
+	/**
+	 * \brief Refers to an element. Default constructed keys are null.
+	 */
+	struct Key
+	{
+		std::uint32_t slot{ 0 };
+		std::uint32_t generation{ 0 };
+
+		[[nodiscard]] constexpr bool isNull() const noexcept
+		{
+			return generation == 0;
+		}
+
+		[[nodiscard]] constexpr bool operator==(const Key&) const noexcept = default;
+	};
+
+	template<bool IsConst>
+	class Iterator
+	{
+	public:
+
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using pointer = std::conditional_t<IsConst, const T*, T*>;
+		using reference = std::conditional_t<IsConst, const T&, T&>;
+		using Container = std::conditional_t<IsConst, const SlotMap, SlotMap>;
+
+		constexpr Iterator() noexcept = default;
+
+		inline Iterator(Container* container, std::uint32_t slot) noexcept
+			: m_container{ container }, m_slot{ slot }
+		{
+			skipFreeSlots();
+		}
+
+		[[nodiscard]] inline reference operator*() const noexcept { return *m_container->slotAt(m_slot).get(); }
+		[[nodiscard]] inline pointer operator->() const noexcept { return m_container->slotAt(m_slot).get(); }
+
+		/**
+		 * \brief Returns the key of the element.
+		 * \complexity O(1).
+		 */
+		[[nodiscard]] inline Key key() const noexcept
+		{
+			return Key{ m_slot, m_container->slotAt(m_slot).generation };
+		}
+
+		inline Iterator& operator++() noexcept
+		{
+			++m_slot;
+			skipFreeSlots();
+			return *this;
+		}
+
+		inline Iterator operator++(int) noexcept
+		{
+			Iterator previous{ *this };
+			++(*this);
+			return previous;
+		}
+
+		[[nodiscard]] inline bool operator==(const Iterator& other) const noexcept
+		{
+			return m_slot == other.m_slot;
+		}
+
+	private:
+
+		inline void skipFreeSlots() noexcept
+		{
+			while (m_slot < m_container->m_nbOfSlots && !m_container->slotAt(m_slot).isAlive)
+				++m_slot;
+		}
+
+		Container* m_container{ nullptr };
+		std::uint32_t m_slot{ 0 };
+	};
+
+	using iterator = Iterator<false>;
+	using const_iterator = Iterator<true>;
+
+
+	inline SlotMap() noexcept
+		: m_chunks{}, m_freeSlots{}, m_nbOfSlots{ 0 }, m_size{ 0 }
+	{}
+
+	/**
+	 * \param[in] resource Where the chunks are allocated from, or nullptr for the global heap. It must
+	 *					   outlive the container.
+	 */
+	inline explicit SlotMap(std::pmr::memory_resource* resource) noexcept
+		: m_chunks{ ArenaAllocator<Slot*>{ resource } }, m_freeSlots{ ArenaAllocator<std::uint32_t>{ resource } }, m_nbOfSlots{ 0 }, m_size{ 0 }
+	{}
+
+	SlotMap(const SlotMap&) noexcept = delete;
+	SlotMap& operator=(const SlotMap&) noexcept = delete;
+
+	inline SlotMap(SlotMap&& other) noexcept
+		: m_chunks{ std::move(other.m_chunks) }, m_freeSlots{ std::move(other.m_freeSlots) }, m_nbOfSlots{ std::exchange(other.m_nbOfSlots, 0) }, m_size{ std::exchange(other.m_size, 0) }
+	{}
+
+	inline SlotMap& operator=(SlotMap&& other) noexcept
+	{
+		if (this != &other)
+		{
+			clear(); // The other container is given the resource of this one, empty.
+			m_chunks.swap(other.m_chunks);
+			m_freeSlots.swap(other.m_freeSlots);
+			m_nbOfSlots = std::exchange(other.m_nbOfSlots, 0);
+			m_size = std::exchange(other.m_size, 0);
+		}
+
+		return *this;
+	}
+
+	inline ~SlotMap() noexcept
+	{
+		clear();
+	}
+
+
+	[[nodiscard]] inline iterator begin() noexcept { return iterator{ this, 0 }; }
+	[[nodiscard]] inline const_iterator begin() const noexcept { return const_iterator{ this, 0 }; }
+	[[nodiscard]] inline iterator end() noexcept { return iterator{ this, m_nbOfSlots }; }
+	[[nodiscard]] inline const_iterator end() const noexcept { return const_iterator{ this, m_nbOfSlots }; }
+
+	[[nodiscard]] inline size_t size() const noexcept { return m_size; }
+	[[nodiscard]] inline bool empty() const noexcept { return m_size == 0; }
+
+	/**
+	 * \brief Returns the number of elements that can exist without allocating a chunk.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t capacity() const noexcept
+	{
+		return m_chunks.size() * s_chunkSize;
+	}
+
+
+	/**
+	 * \brief Constructs an element in place.
+	 * \complexity Amortized O(1).
+	 *
+	 * \return The key of the element.
+	 *
+	 * \throw std::bad_alloc, or what the constructor of the element throws. Strong exception guarantee.
+	 */
+	template<typename... Args>
+	inline Key emplace(Args&&... args)
+	{
+		std::uint32_t slotIndex{ m_nbOfSlots };
+		if (!m_freeSlots.empty())
+			slotIndex = m_freeSlots.back();
+		else if (m_nbOfSlots == capacity())
+			addChunk();
+
+		Slot& slot{ slotAt(slotIndex) };
+		std::uninitialized_construct_using_allocator(reinterpret_cast<T*>(slot.storage), m_chunks.get_allocator(), std::forward<Args>(args)...); // Nothing changed if it throws.
+		slot.isAlive = true;
+
+		if (!m_freeSlots.empty())
+			m_freeSlots.pop_back();
+		else
+			++m_nbOfSlots;
+
+		++m_size;
+		return Key{ slotIndex, slot.generation };
+	}
+
+	/**
+	 * \brief Returns the element, or nullptr if the key is stale or null.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline T* get(Key key) noexcept
+	{
+		if (key.slot >= m_nbOfSlots) [[unlikely]]
+			return nullptr;
+
+		Slot& slot{ slotAt(key.slot) };
+		return (slot.generation == key.generation && slot.isAlive) ? slot.get() : nullptr;
+	}
+
+	[[nodiscard]] inline const T* get(Key key) const noexcept
+	{
+		return const_cast<SlotMap*>(this)->get(key);
+	}
+
+	/**
+	 * \brief Returns the element.
+	 * \complexity O(1).
+	 *
+	 * \pre The key must refer to an existing element.
+	 * \warning Asserts otherwise.
+	 */
+	[[nodiscard]] inline T& operator[](Key key) noexcept
+	{
+		assert(get(key) != nullptr && "Precondition violated; the key was stale when operator[] of SlotMap was called");
+		return *slotAt(key.slot).get();
+	}
+
+	[[nodiscard]] inline const T& operator[](Key key) const noexcept
+	{
+		assert(get(key) != nullptr && "Precondition violated; the key was stale when operator[] of SlotMap was called");
+		return *slotAt(key.slot).get();
+	}
+
+	/**
+	 * \brief Destroys an element. Its key, and any copy of it, becomes stale.
+	 * \complexity O(1).
+	 *
+	 * \return `false` if the key was already stale.
+	 */
+	inline bool erase(Key key) noexcept
+	{
+		if (get(key) == nullptr)
+			return false;
+
+		Slot& slot{ slotAt(key.slot) };
+		std::destroy_at(slot.get());
+		slot.isAlive = false;
+
+		if (++slot.generation == 0) [[unlikely]]
+			slot.generation = 1;
+
+		m_freeSlots.push_back(key.slot); // Never allocates: reserved for all slots when chunks are added.
+		--m_size;
+		return true;
+	}
+
+	/**
+	 * \brief Destroys all elements, and frees the memory.
+	 * \complexity O(C), where C is the number of slots.
+	 *
+	 * \warning The keys given before are not detected as stale afterwards: the generations restart.
+	 */
+	inline void clear() noexcept
+	{
+		for (std::uint32_t i{ 0 }; i < m_nbOfSlots; ++i)
+			if (slotAt(i).isAlive)
+				std::destroy_at(slotAt(i).get());
+
+		ArenaAllocator<Slot> allocator{ m_chunks.get_allocator() };
+		for (Slot* chunk : m_chunks)
+			allocator.deallocate(chunk, s_chunkSize); // Slots are trivially destructible.
+
+		m_chunks.clear();
+		m_freeSlots.clear();
+		m_nbOfSlots = 0;
+		m_size = 0;
+	}
+
+	/**
+	 * \brief Makes room for a number of elements, so that inserting them does not allocate.
+	 * \complexity O(N / 64), where N is the number of elements.
+	 *
+	 * \throw std::bad_alloc. Basic exception guarantee: some chunks might have been allocated.
+	 */
+	inline void reserve(size_t nbOfElements)
+	{
+		while (capacity() < nbOfElements)
+			addChunk();
+	}
+
+private:
+
+	/// The number of elements per chunk.
+	static constexpr size_t s_chunkSize{ 64 };
+
+
+	/**
+	 * \brief Allocates a chunk, and enough room to free all slots.
+	 * \throw std::bad_alloc. Strong exception guarantee.
+	 */
+	inline void addChunk()
+	{
+		static_assert(std::is_trivially_destructible_v<Slot>, "Chunks are freed without destroying their slots");
+
+		m_freeSlots.reserve(capacity() + s_chunkSize);
+		m_chunks.reserve(m_chunks.size() + 1);
+
+		ArenaAllocator<Slot> allocator{ m_chunks.get_allocator() };
+		Slot* const chunk{ allocator.allocate(s_chunkSize) };
+		std::uninitialized_default_construct_n(chunk, s_chunkSize); // Never throws.
+		m_chunks.push_back(chunk);
+	}
+
+	[[nodiscard]] inline Slot& slotAt(std::uint32_t slot) noexcept
+	{
+		return m_chunks[slot / s_chunkSize][slot % s_chunkSize];
+	}
+
+	[[nodiscard]] inline const Slot& slotAt(std::uint32_t slot) const noexcept
+	{
+		return m_chunks[slot / s_chunkSize][slot % s_chunkSize];
+	}
+
+
+	/// The storage of the elements, never moved.
+	ArenaVector<Slot*> m_chunks;
+	/// The slots of erased elements, reused first.
+	ArenaVector<std::uint32_t> m_freeSlots;
+	/// The number of slots ever used, alive or not.
+	std::uint32_t m_nbOfSlots;
+	/// The number of elements.
+	size_t m_size;
+};
+
+} // gui namespace
+
+#endif // SLOTMAP_HPP
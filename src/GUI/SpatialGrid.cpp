@@ -0,0 +1,225 @@
+#include "SpatialGrid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace gui
+{
+
+SpatialGrid::SpatialGrid(SpatialGrid&& other) noexcept
+	: m_texts{ std::move(other.m_texts) }, m_sprites{ std::move(other.m_sprites) }, m_hiddenTexts{ other.m_hiddenTexts }, m_hiddenSprites{ other.m_hiddenSprites }, m_bounds{ std::move(other.m_bounds) }, m_cells{ std::move(other.m_cells) }
+	, m_origin{ other.m_origin }, m_cellSize{ other.m_cellSize }, m_nbOfCells{ other.m_nbOfCells }, m_dirtySlots{ std::move(other.m_dirtySlots) }, m_isDirty{ std::move(other.m_isDirty) }
+{
+	other.clear();
+	linkWrappers();
+}
+
+SpatialGrid& SpatialGrid::operator=(SpatialGrid&& other) noexcept
+{
+	if (this == &other)
+		return *this;
+
+	clear();
+	m_texts = std::move(other.m_texts);
+	m_sprites = std::move(other.m_sprites);
+	m_hiddenTexts = other.m_hiddenTexts;
+	m_hiddenSprites = other.m_hiddenSprites;
+	m_bounds = std::move(other.m_bounds);
+	m_cells = std::move(other.m_cells);
+	m_origin = other.m_origin;
+	m_cellSize = other.m_cellSize;
+	m_nbOfCells = other.m_nbOfCells;
+	m_dirtySlots = std::move(other.m_dirtySlots);
+	m_isDirty = std::move(other.m_isDirty);
+
+	other.clear();
+	linkWrappers();
+	return *this;
+}
+
+SpatialGrid::~SpatialGrid() noexcept
+{
+	clear();
+}
+
+void SpatialGrid::build(ArenaVector<TextWrapper>& texts, size_t nbOfTexts, ArenaVector<SpriteWrapper>& sprites, size_t nbOfSprites, const std::uint8_t* hiddenTexts, const std::uint8_t* hiddenSprites) noexcept
+{
+	clear();
+	m_hiddenTexts = hiddenTexts;
+	m_hiddenSprites = hiddenSprites;
+
+	for (size_t i{ 0 }; i < nbOfTexts; ++i)
+		m_texts.push_back(&texts[i]);
+	for (size_t i{ 0 }; i < nbOfSprites; ++i)
+		m_sprites.push_back(&sprites[i]);
+
+	const std::uint32_t nbOfElements{ static_cast<std::uint32_t>(nbOfTexts + nbOfSprites) };
+	m_bounds.resize(nbOfElements);
+	m_isDirty.assign(nbOfElements, false);
+
+	if (nbOfElements == 0)
+		return;
+
+	sf::Vector2f topLeft{ std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+	sf::Vector2f bottomRight{ std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+
+	linkWrappers();
+
+	for (std::uint32_t slot{ 0 }; slot < nbOfElements; ++slot)
+	{
+		const sf::FloatRect bounds{ computeBounds(slot) };
+		m_bounds[slot] = bounds;
+
+		topLeft.x = std::min(topLeft.x, bounds.position.x);
+		topLeft.y = std::min(topLeft.y, bounds.position.y);
+		bottomRight.x = std::max(bottomRight.x, bounds.position.x + bounds.size.x);
+		bottomRight.y = std::max(bottomRight.y, bounds.position.y + bounds.size.y);
+	}
+
+	// About one cell per element: most cells then hold a single element, or a few if they overlap.
+	const unsigned int cellsPerAxis{ std::clamp(static_cast<unsigned int>(std::ceil(std::sqrt(static_cast<float>(nbOfElements)))), 1u, 256u) };
+	m_origin = topLeft;
+	m_nbOfCells = sf::Vector2u{ cellsPerAxis, cellsPerAxis };
+	m_cellSize = sf::Vector2f{ std::max((bottomRight.x - topLeft.x) / cellsPerAxis, 1.f), std::max((bottomRight.y - topLeft.y) / cellsPerAxis, 1.f) };
+	m_cells.resize(static_cast<size_t>(cellsPerAxis) * cellsPerAxis);
+
+	for (std::uint32_t slot{ 0 }; slot < nbOfElements; ++slot)
+		updateCells(slot, true);
+}
+
+void SpatialGrid::clear() noexcept
+{
+	for (TextWrapper* text : m_texts)
+		text->m_spatialLink = TransformableWrapper::SpatialLink{};
+	for (SpriteWrapper* sprite : m_sprites)
+		sprite->m_spatialLink = TransformableWrapper::SpatialLink{};
+
+	m_texts.clear();
+	m_sprites.clear();
+	m_hiddenTexts = nullptr;
+	m_hiddenSprites = nullptr;
+	m_bounds.clear();
+	m_cells.clear();
+	m_nbOfCells = sf::Vector2u{ 0, 0 };
+	m_dirtySlots.clear();
+	m_isDirty.clear();
+}
+
+std::optional<size_t> SpatialGrid::query(sf::Vector2f point) noexcept
+{
+	if (m_cells.empty()) [[unlikely]]
+		return std::nullopt;
+
+	if (!m_dirtySlots.empty()) [[unlikely]]
+		refresh();
+
+	const CellRange cell{ computeCellRange(sf::FloatRect{ point, sf::Vector2f{ 0.f, 0.f } }) };
+	const std::vector<std::uint32_t>& candidates{ m_cells[static_cast<size_t>(cell.top) * m_nbOfCells.x + cell.left] };
+	std::optional<size_t> hovered{};
+	PROFILE_COUNT(hoverScannedElements, candidates.size());
+
+	for (const std::uint32_t slot : candidates)
+	{
+		if (hovered.has_value() && slot >= hovered.value())
+			continue; // Only the lowest slot is kept, as a linear scan would find it first.
+
+		const bool hidden{ (slot < m_texts.size()) ? m_hiddenTexts[slot] : m_hiddenSprites[slot - m_texts.size()] };
+		if (!hidden && m_bounds[slot].contains(point))
+			hovered = slot;
+	}
+
+	return hovered;
+}
+
+void SpatialGrid::markDirty(std::uint32_t slot) noexcept
+{
+	if (m_isDirty[slot])
+		return;
+
+	m_isDirty[slot] = true;
+	m_dirtySlots.push_back(slot);
+}
+
+void SpatialGrid::refresh() noexcept
+{
+	for (const std::uint32_t slot : m_dirtySlots)
+	{
+		m_isDirty[slot] = false;
+
+		const sf::FloatRect bounds{ computeBounds(slot) };
+		if (bounds == m_bounds[slot])
+			continue; // Color or style change.
+
+		const CellRange previousCells{ computeCellRange(m_bounds[slot]) };
+		const CellRange newCells{ computeCellRange(bounds) };
+
+		if (previousCells.left == newCells.left && previousCells.top == newCells.top && previousCells.right == newCells.right && previousCells.bottom == newCells.bottom)
+		{	// Small moves are frequent, e.g. hover animations.
+			m_bounds[slot] = bounds;
+			continue;
+		}
+
+		updateCells(slot, false);
+		m_bounds[slot] = bounds;
+		updateCells(slot, true);
+	}
+
+	m_dirtySlots.clear();
+}
+
+sf::FloatRect SpatialGrid::computeBounds(std::uint32_t slot) const noexcept
+{
+	if (slot < m_texts.size())
+		return m_texts[slot]->getGlobalBounds();
+
+	return m_sprites[slot - m_texts.size()]->getGlobalBounds();
+}
+
+SpatialGrid::CellRange SpatialGrid::computeCellRange(const sf::FloatRect& bounds) const noexcept
+{
+	// Clamping keeps the order of coordinates: an element containing a point still shares a cell
+	// with it, even when both are outside of the grid.
+	const auto toCell{ [](float coordinate, float origin, float cellSize, unsigned int nbOfCells) noexcept -> unsigned int
+	{
+		const float cell{ std::floor((coordinate - origin) / cellSize) };
+		return static_cast<unsigned int>(std::clamp(cell, 0.f, static_cast<float>(nbOfCells - 1)));
+	} };
+
+	return CellRange
+	{
+		toCell(bounds.position.x, m_origin.x, m_cellSize.x, m_nbOfCells.x),
+		toCell(bounds.position.y, m_origin.y, m_cellSize.y, m_nbOfCells.y),
+		toCell(bounds.position.x + bounds.size.x, m_origin.x, m_cellSize.x, m_nbOfCells.x),
+		toCell(bounds.position.y + bounds.size.y, m_origin.y, m_cellSize.y, m_nbOfCells.y)
+	};
+}
+
+void SpatialGrid::updateCells(std::uint32_t slot, bool add) noexcept
+{
+	const CellRange range{ computeCellRange(m_bounds[slot]) };
+
+	for (unsigned int y{ range.top }; y <= range.bottom; ++y)
+	{
+		for (unsigned int x{ range.left }; x <= range.right; ++x)
+		{
+			std::vector<std::uint32_t>& cell{ m_cells[static_cast<size_t>(y) * m_nbOfCells.x + x] };
+
+			if (add)
+				cell.push_back(slot);
+			else
+				std::erase(cell, slot);
+		}
+	}
+}
+
+void SpatialGrid::linkWrappers() noexcept
+{
+	for (std::uint32_t slot{ 0 }; slot < m_texts.size() + m_sprites.size(); ++slot)
+	{
+		TransformableWrapper& wrapper{ (slot < m_texts.size()) ? static_cast<TransformableWrapper&>(*m_texts[slot]) : *m_sprites[slot - m_texts.size()] };
+		wrapper.m_spatialLink.grid = this;
+		wrapper.m_spatialLink.slot = slot;
+	}
+}
+
+} // gui namespace
@@ -0,0 +1,184 @@
+/*******************************************************************
+ * \file   SpatialGrid.hpp, SpatialGrid.cpp
+ * \brief  Declare a uniform grid that finds the element under a point without scanning them all.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note These files depend on the SFML library.
+ *********************************************************************/
+
+#ifndef SPATIALGRID_HPP
+#define SPATIALGRID_HPP
+
+#include "GraphicalResources.hpp"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <optional>
+#include <cstdint>
+
+namespace gui
+{
+
+/**
+ * \brief Indexes the global bounds of texts and sprites into a uniform grid of cells.
+ *
+ * Each element is referenced by every cell its bounds overlap. A point query only tests the
+ * elements of the cell that contains the point, instead of every element.
+ *
+ * Elements are identified by a slot: texts come first, in order, then sprites. When several
+ * elements contain the point, the lowest slot is returned, which is the same element a linear
+ * scan of the texts, then the sprites, would have returned.
+ *
+ * The bounds are copied into a contiguous array, so a query only touches the cell it tests and the
+ * bounds and hide flags of its elements, never the `sf::Text` and `sf::Sprite` objects.
+ *
+ * Indexed wrappers notify the grid whenever they are modified (see `TransformableWrapper::markModified`);
+ * their bounds and cells are only updated during the next query. The `hide` flag is not tracked, its
+ * mirror is checked when querying.
+ *
+ * \note The grid keeps pointers to the wrappers: they must neither be moved nor destroyed while
+ *		 indexed, which is guaranteed by locked interfaces.
+ *
+ * \see `InteractiveInterface::eventUpdateHovered`.
+ */
+class SpatialGrid
+{
+public:
+
+	constexpr SpatialGrid() noexcept = default;
+	SpatialGrid(const SpatialGrid&) noexcept = delete;
+	SpatialGrid(SpatialGrid&& other) noexcept; /// \complexity O(N), relinks the wrappers.
+	SpatialGrid& operator=(const SpatialGrid&) noexcept = delete;
+	SpatialGrid& operator=(SpatialGrid&& other) noexcept; /// \complexity O(N), relinks the wrappers.
+	~SpatialGrid() noexcept; /// \complexity O(N), unlinks the wrappers.
+
+
+	/**
+	 * \brief Indexes the first texts and sprites of the collections, replacing the previous ones.
+	 * \complexity O(N * C), where N is the number of elements and C the number of cells they overlap.
+	 *
+	 * The grid covers the bounds of all elements, with about one cell per element. Elements that
+	 * later move outside of this area are stored in the border cells.
+	 *
+	 * \param[in,out] texts The texts, linked to the grid.
+	 * \param[in]	  nbOfTexts The number of texts (from the beginning) to index.
+	 * \param[in,out] sprites The sprites, linked to the grid.
+	 * \param[in]	  nbOfSprites The number of sprites (from the beginning) to index.
+	 * \param[in]	  hiddenTexts The mirrored hide flags of the texts (see `MirroredFlag`).
+	 * \param[in]	  hiddenSprites The mirrored hide flags of the sprites.
+	 */
+	void build(ArenaVector<TextWrapper>& texts, size_t nbOfTexts, ArenaVector<SpriteWrapper>& sprites, size_t nbOfSprites, const std::uint8_t* hiddenTexts, const std::uint8_t* hiddenSprites) noexcept;
+
+	/**
+	 * \brief Removes all elements, and unlinks them.
+	 * \complexity O(N).
+	 */
+	void clear() noexcept;
+
+	/**
+	 * \brief Finds the visible element with the lowest slot containing the point.
+	 * \complexity O(K), where K is the number of elements in the cell of the point; plus the update
+	 *			   of the elements modified since the last query.
+	 *
+	 * \param[in] point The point, in world coordinates.
+	 *
+	 * \return The slot of the element: an index within the texts if lower than the number of texts,
+	 *		   otherwise the index within the sprites plus the number of texts. `std::nullopt` if no
+	 *		   element contains the point.
+	 */
+	[[nodiscard]] std::optional<size_t> query(sf::Vector2f point) noexcept;
+
+	/**
+	 * \brief Schedules the update of an element, called by the wrappers when they are modified.
+	 * \complexity O(1).
+	 *
+	 * \param[in] slot The slot of the modified element.
+	 */
+	void markDirty(std::uint32_t slot) noexcept;
+
+	/**
+	 * \brief Returns the number of indexed elements.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t getElementCount() const noexcept
+	{
+		return m_bounds.size();
+	}
+
+private:
+
+	/**
+	 * \brief A range of cells, both ends included.
+	 */
+	struct CellRange
+	{
+		unsigned int left;
+		unsigned int top;
+		unsigned int right;
+		unsigned int bottom;
+	};
+
+
+	/**
+	 * \brief Recomputes the bounds of the modified elements and moves them to their new cells.
+	 * \complexity O(D * C), where D is the number of modified elements and C the number of cells they overlap.
+	 */
+	void refresh() noexcept;
+
+	/**
+	 * \brief Returns the current global bounds of an element.
+	 * \complexity O(1), they are cached by the wrapper.
+	 */
+	[[nodiscard]] sf::FloatRect computeBounds(std::uint32_t slot) const noexcept;
+
+	/**
+	 * \brief Returns the cells that a rectangle overlaps, clamped to the grid.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] CellRange computeCellRange(const sf::FloatRect& bounds) const noexcept;
+
+	/**
+	 * \brief Adds or removes (if `add` is false) an element from the cells its bounds overlap.
+	 * \complexity O(C * K), where C is the number of cells and K the number of elements per cell.
+	 */
+	void updateCells(std::uint32_t slot, bool add) noexcept;
+
+	/**
+	 * \brief Links every indexed wrapper to this grid.
+	 * \complexity O(N).
+	 */
+	void linkWrappers() noexcept;
+
+
+	/// The indexed texts.
+	std::vector<TextWrapper*> m_texts{};
+	/// The indexed sprites.
+	std::vector<SpriteWrapper*> m_sprites{};
+
+	/// The mirrored hide flags of the texts, read instead of the wrappers.
+	const std::uint8_t* m_hiddenTexts{ nullptr };
+	/// The mirrored hide flags of the sprites, read instead of the wrappers.
+	const std::uint8_t* m_hiddenSprites{ nullptr };
+
+	/// The global bounds of each element, as they were when last refreshed. Indexed by slot.
+	std::vector<sf::FloatRect> m_bounds{};
+	/// The slots of the elements overlapping each cell, row by row.
+	std::vector<std::vector<std::uint32_t>> m_cells{};
+
+	/// The top left corner of the grid.
+	sf::Vector2f m_origin{};
+	/// The size of a single cell.
+	sf::Vector2f m_cellSize{ 1.f, 1.f };
+	/// The number of cells on each axis.
+	sf::Vector2u m_nbOfCells{ 0, 0 };
+
+	/// The elements modified since the last refresh.
+	std::vector<std::uint32_t> m_dirtySlots{};
+	/// Whether each element is within `m_dirtySlots`, so that it is only added once.
+	std::vector<bool> m_isDirty{};
+};
+
+} // gui namespace
+
+#endif // SPATIALGRID_HPP
@@ -0,0 +1,222 @@
+#include "SpriteAnimator.hpp"
+#include <cmath>
+
+namespace gui
+{
+
+SpriteAnimator::ClipHandle SpriteAnimator::createClip(std::span<const AnimationFrame> frames, PlayMode mode)
+{
+	assert(!frames.empty() && "Precondition violated; the clip has no frame when the function createClip of SpriteAnimator was called");
+
+	Clip clip{ .frames = {}, .cycleDuration = 0.f, .mode = mode };
+	clip.frames.reserve(frames.size());
+
+	for (const AnimationFrame& frame : frames)
+	{
+		assert(frame.duration > sf::Time::Zero && "Precondition violated; a frame has no duration when the function createClip of SpriteAnimator was called");
+
+		clip.frames.push_back(Clip::Frame{ static_cast<std::uint32_t>(frame.textureIndex), frame.duration.asSeconds() });
+		clip.cycleDuration += frame.duration.asSeconds();
+	}
+
+	if (mode == PlayMode::PingPong && clip.frames.size() > 1) // The first and last frames are only displayed once per cycle.
+		clip.cycleDuration = 2.f * clip.cycleDuration - clip.frames.front().duration - clip.frames.back().duration;
+
+	return m_clips.emplace(std::move(clip));
+}
+
+void SpriteAnimator::removeClip(ClipHandle clip) noexcept
+{
+	const Clip* const removedClip{ m_clips.get(clip) };
+	if (removedClip == nullptr)
+		return;
+
+	for (size_t i{ m_animations.size() }; i > 0; --i) // Backward: the moved animations were already checked.
+		if (m_animations[i - 1].clip == removedClip)
+			removeAnimation(i - 1);
+
+	m_clips.erase(clip);
+}
+
+SpriteAnimator::AnimationHandle SpriteAnimator::play(MutableInterface& gui, MutableInterface::SpriteHandle sprite, ClipHandle clip, float speed)
+{
+	SpriteWrapper* const animatedSprite{ gui.getDynamicSprite(sprite) };
+	ENSURE_VALID_PTR(animatedSprite, "Precondition violated; the handle of the sprite is stale when the function play of SpriteAnimator was called");
+	const Clip* const playedClip{ m_clips.get(clip) };
+	ENSURE_VALID_PTR(playedClip, "Precondition violated; the clip does not exist when the function play of SpriteAnimator was called");
+	assert(speed >= 0.f && "Precondition violated; the speed is negative when the function play of SpriteAnimator was called");
+#ifndef NDEBUG
+	for (const Clip::Frame& frame : playedClip->frames)
+		ENSURE_NOT_OUT_OF_RANGE(frame.textureIndex, animatedSprite->getNbOfTextures(), "Precondition violated; a frame is out of range for the texture vector of the sprite when the function play of SpriteAnimator was called");
+#endif // NDEBUG
+
+	const AnimationHandle handle{ m_indexes.emplace(m_animations.size()) };
+	size_t nbOfPushes{ 0 };
+
+	try
+	{
+		m_timers.push_back(Timer{ .remaining = playedClip->frames.front().duration, .rate = speed });
+		++nbOfPushes;
+		m_animations.push_back(Animation{ .gui = &gui, .sprite = sprite, .clip = playedClip, .speed = speed, .frame = 0, .isBackward = false, .isPaused = false, .handle = handle });
+		++nbOfPushes;
+
+		animatedSprite->switchToTexture(playedClip->frames.front().textureIndex);
+	}
+	catch (...)
+	{
+		if (nbOfPushes > 0)
+			m_timers.pop_back();
+		if (nbOfPushes > 1)
+			m_animations.pop_back();
+
+		m_indexes.erase(handle);
+		throw;
+	}
+
+	return handle;
+}
+
+bool SpriteAnimator::stop(AnimationHandle animation) noexcept
+{
+	const size_t* const index{ m_indexes.get(animation) };
+	if (index == nullptr)
+		return false;
+
+	removeAnimation(*index);
+	return true;
+}
+
+void SpriteAnimator::stopAll() noexcept
+{
+	for (const Animation& animation : m_animations)
+		m_indexes.erase(animation.handle); // Unlike clearing, erasing makes the handles stale.
+
+	m_timers.clear();
+	m_animations.clear();
+}
+
+void SpriteAnimator::setPaused(AnimationHandle animation, bool paused) noexcept
+{
+	if (const size_t* const index{ m_indexes.get(animation) }; index != nullptr)
+	{
+		m_animations[*index].isPaused = paused;
+		m_timers[*index].rate = paused ? 0.f : m_animations[*index].speed;
+	}
+}
+
+void SpriteAnimator::setSpeed(AnimationHandle animation, float speed) noexcept
+{
+	assert(speed >= 0.f && "Precondition violated; the speed is negative when the function setSpeed of SpriteAnimator was called");
+
+	if (const size_t* const index{ m_indexes.get(animation) }; index != nullptr)
+	{
+		m_animations[*index].speed = speed;
+		m_timers[*index].rate = m_animations[*index].isPaused ? 0.f : speed;
+	}
+}
+
+size_t SpriteAnimator::update(sf::Time elapsed)
+{
+	const float seconds{ elapsed.asSeconds() };
+	size_t nbOfChanges{ 0 };
+
+	for (size_t i{ 0 }; i < m_timers.size(); )
+	{
+		Timer& timer{ m_timers[i] };
+		timer.remaining -= seconds * timer.rate; // Paused animations have a rate of 0.
+
+		if (timer.remaining > 0.f) [[likely]]
+		{	// Most animations stay on the same frame: neither the animation nor the sprite is touched.
+			++i;
+			continue;
+		}
+
+		Animation& animation{ m_animations[i] };
+		const Clip& clip{ *animation.clip };
+		float time{ clip.frames[animation.frame].duration - timer.remaining }; // The time spent on the current frame.
+
+		if (clip.mode != PlayMode::Once && time >= clip.cycleDuration) [[unlikely]]
+			time = std::fmod(time, clip.cycleDuration); // Whole cycles end on the same frame, in the same direction.
+
+		bool isFinished{ false };
+		while (time >= clip.frames[animation.frame].duration)
+		{
+			time -= clip.frames[animation.frame].duration;
+			if (!advance(animation))
+			{
+				isFinished = true;
+				break;
+			}
+		}
+		timer.remaining = clip.frames[animation.frame].duration - time;
+
+		SpriteWrapper* const sprite{ animation.gui->getDynamicSprite(animation.sprite) };
+		if (sprite == nullptr) [[unlikely]]
+		{	// The sprite was removed.
+			removeAnimation(i);
+			continue;
+		}
+
+		const size_t textureIndex{ clip.frames[animation.frame].textureIndex };
+		if (textureIndex != sprite->getCurrentTextureIndex())
+		{
+			sprite->switchToTexture(textureIndex);
+			++nbOfChanges;
+		}
+
+		if (isFinished)
+			removeAnimation(i); // The last animation is moved here, and updated next.
+		else
+			++i;
+	}
+
+	return nbOfChanges;
+}
+
+bool SpriteAnimator::advance(Animation& animation) noexcept
+{
+	const std::uint32_t lastFrame{ static_cast<std::uint32_t>(animation.clip->frames.size() - 1) };
+
+	switch (animation.clip->mode)
+	{
+	case PlayMode::Once:
+		if (animation.frame == lastFrame)
+			return false;
+
+		++animation.frame;
+		return true;
+
+	case PlayMode::Loop:
+		animation.frame = (animation.frame == lastFrame) ? 0 : animation.frame + 1;
+		return true;
+
+	case PlayMode::PingPong:
+		if (lastFrame == 0) [[unlikely]]
+			return true;
+
+		if (animation.frame == (animation.isBackward ? 0 : lastFrame))
+			animation.isBackward = !animation.isBackward;
+
+		animation.frame = animation.isBackward ? animation.frame - 1 : animation.frame + 1;
+		return true;
+	}
+
+	return true;
+}
+
+void SpriteAnimator::removeAnimation(size_t index) noexcept
+{
+	m_indexes.erase(m_animations[index].handle);
+
+	if (index + 1 != m_animations.size())
+	{
+		m_timers[index] = m_timers.back();
+		m_animations[index] = m_animations.back();
+		m_indexes[m_animations[index].handle] = index;
+	}
+
+	m_timers.pop_back();
+	m_animations.pop_back();
+}
+
+} // gui namespace
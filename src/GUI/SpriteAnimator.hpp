@@ -0,0 +1,287 @@
+/*******************************************************************
+ * \file   SpriteAnimator.hpp, SpriteAnimator.cpp
+ * \brief  Declare an engine that plays animation clips on sprites, all advanced by one call per frame.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note These files depend on the SFML library.
+ * \note All assertions are disabled in release mode. If broken, undefined behavior will occur.
+ *********************************************************************/
+
+#ifndef SPRITEANIMATOR_HPP
+#define SPRITEANIMATOR_HPP
+
+#include "MutableInterface.hpp"
+#include "SlotMap.hpp"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <span>
+#include <cstdint>
+
+namespace gui
+{
+
+/**
+ * \brief How a clip continues once its last frame is over.
+ */
+enum class PlayMode : std::uint8_t
+{
+	Once, // Stops on the last frame.
+	Loop, // Starts again from the first frame.
+	PingPong // Plays backward to the first frame, then forward again, and so on.
+};
+
+/**
+ * \brief A frame of a clip: an entry of the texture vector of the sprite, and how long it is displayed.
+ *
+ * \see `SpriteWrapper::addTexture`.
+ */
+struct AnimationFrame
+{
+	size_t textureIndex;
+	sf::Time duration;
+};
+
+
+/**
+ * \brief Plays clips on sprites, and advances all of them at once from the elapsed time.
+ *
+ * Animating a sprite by hand means calling `switchToNextTexture` every frame, whatever the frame rate.
+ * Instead, clips (frames with their durations, and a play mode) are created once and played on any
+ * number of sprites. `update` then advances every animation in a single loop over a contiguous array
+ * of timers: most animations only subtract the elapsed time from the time left on their frame, and
+ * only the sprites whose frame actually changed are touched.
+ *
+ * Frames are entries of the texture vector of the sprite, added with `SpriteWrapper::addTexture`:
+ * either sub-rectangles of a sprite sheet, or textures packed into the same atlas page (see
+ * `SpriteWrapper::enableAtlas`). In both cases, changing the frame only changes the displayed
+ * rectangle of the sprite: batched interfaces refill the vertices of its batch, without regrouping
+ * the elements by texture.
+ *
+ * \note Frames should be loaded before being played (`SpriteWrapper::prefetchTextures`), otherwise
+ *		 they are loaded synchronously by `update`.
+ * \note An animator playing the sprites of a single window can be updated by `FramePreparer` on a
+ *		 worker: sprites switch textures under a mutex of their `ResourceContext`.
+ * \note Animations refer to dynamic sprites by their handle, which is resolved each time the frame
+ *		 changes: sprites can be added, removed or swapped in the meantime. Once a sprite is removed,
+ *		 its animations are finished by their next change of frame.
+ *
+ * \code
+ * gui::SpriteAnimator animator{};
+ * const gui::AnimationFrame runFrames[]{ { 0, sf::milliseconds(80) }, { 1, sf::milliseconds(80) }, { 2, sf::milliseconds(120) } };
+ * const auto run{ animator.createClip(runFrames, gui::PlayMode::Loop) };
+ *
+ * const MGUI::SpriteHandle player{ myInterface.getSpriteHandle("player") };
+ * myInterface.getDynamicSprite(player)->addTexture("run", sf::IntRect{ { 0, 0 }, { 32, 32 } }, sf::IntRect{ { 32, 0 }, { 32, 32 } }, sf::IntRect{ { 64, 0 }, { 32, 32 } });
+ * animator.play(myInterface, player, run);
+ *
+ * sf::Clock clock{};
+ * while (window.isOpen())
+ * {
+ *		animator.update(clock.restart());
+ *		// ...
+ * }
+ * \endcode
+ *
+ * \see `SpriteWrapper`, `AnimationFrame`, `PlayMode`.
+ */
+class SpriteAnimator
+{
+private:
+
+	/**
+	 * \brief The frames of a clip, with their durations in seconds.
+	 */
+	struct Clip
+	{
+		struct Frame
+		{
+			std::uint32_t textureIndex;
+			float duration;
+		};
+
+		std::vector<Frame> frames;
+		float cycleDuration; // The duration after which a looping clip is back to the same frame.
+		PlayMode mode;
+	};
+
+public:
+
+	using ClipHandle = SlotMap<Clip>::Key;
+	using AnimationHandle = SlotMap<size_t>::Key;
+
+
+	inline SpriteAnimator() noexcept
+		: m_clips{}, m_timers{}, m_animations{}, m_indexes{}
+	{}
+
+	SpriteAnimator(const SpriteAnimator&) noexcept = delete;
+	SpriteAnimator(SpriteAnimator&&) noexcept = default;
+	SpriteAnimator& operator=(const SpriteAnimator&) noexcept = delete;
+	SpriteAnimator& operator=(SpriteAnimator&&) noexcept = default;
+	~SpriteAnimator() noexcept = default;
+
+
+	/**
+	 * \brief Creates a clip, which can then be played on any number of sprites.
+	 * \complexity O(N), where N is the number of frames.
+	 *
+	 * \param[in] frames The frames of the clip, in order.
+	 * \param[in] mode What happens once the last frame is over.
+	 *
+	 * \return The handle of the clip.
+	 *
+	 * \pre There must be at least one frame, and all durations must be strictly positive.
+	 * \warning The program will assert otherwise.
+	 * \throw std::bad_alloc. Strong exception guarantee.
+	 */
+	ClipHandle createClip(std::span<const AnimationFrame> frames, PlayMode mode);
+
+	/**
+	 * \brief Removes a clip, and stops the animations playing it. No effect if the handle is stale.
+	 * \complexity O(N), where N is the number of animations.
+	 */
+	void removeClip(ClipHandle clip) noexcept;
+
+	/**
+	 * \brief Plays a clip on a sprite, from its first frame, which is displayed immediately.
+	 * \complexity Amortized O(1).
+	 *
+	 * A sprite can play several clips, but the last one to change its frame wins.
+	 *
+	 * \param[in,out] gui The interface of the sprite. Must outlive the animation.
+	 * \param[in] sprite The handle of the sprite, whose texture vector holds the frames of the clip.
+	 * \param[in] clip The clip to play.
+	 * \param[in] speed A factor applied to the elapsed time: 2 plays the clip twice as fast.
+	 *
+	 * \return The handle of the animation, which becomes stale once it is stopped or finished: either
+	 *		   the clip is played once and is over, or the sprite was removed.
+	 *
+	 * \pre The handle of the sprite must not be stale, the clip must exist, every frame must be within
+	 *		the texture vector of the sprite, and the speed must not be negative.
+	 * \warning The program will assert otherwise.
+	 * \throw LoadingGraphicalResourceFailure if the first frame could not be loaded, or std::bad_alloc.
+	 *		  Strong exception guarantee.
+	 */
+	AnimationHandle play(MutableInterface& gui, MutableInterface::SpriteHandle sprite, ClipHandle clip, float speed = 1.f);
+
+	/**
+	 * \brief Stops an animation: the sprite keeps its current frame. No effect if the handle is stale.
+	 * \complexity O(1).
+	 *
+	 * \return `false` if the handle was stale.
+	 */
+	bool stop(AnimationHandle animation) noexcept;
+
+	/**
+	 * \brief Stops all animations, without removing the clips.
+	 * \complexity O(N), where N is the number of animations.
+	 */
+	void stopAll() noexcept;
+
+	/**
+	 * \brief Pauses or resumes an animation. No effect if the handle is stale.
+	 * \complexity O(1).
+	 */
+	void setPaused(AnimationHandle animation, bool paused) noexcept;
+
+	/**
+	 * \brief Changes the speed of an animation. No effect if the handle is stale.
+	 * \complexity O(1).
+	 *
+	 * \pre The speed must not be negative.
+	 * \warning The program will assert otherwise.
+	 */
+	void setSpeed(AnimationHandle animation, float speed) noexcept;
+
+	/**
+	 * \brief Returns true if the animation was neither stopped nor finished, even if paused.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline bool isPlaying(AnimationHandle animation) const noexcept
+	{
+		return m_indexes.get(animation) != nullptr;
+	}
+
+	/**
+	 * \brief Returns the number of animations being played, including paused ones.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t getNbOfAnimations() const noexcept
+	{
+		return m_animations.size();
+	}
+
+	/**
+	 * \brief Advances all animations, and displays the new frames of their sprites.
+	 * \complexity O(N + C), where N is the number of animations and C the number of sprites whose frame
+	 *			   changed.
+	 *
+	 * However long the elapsed time is, whole cycles of looping clips are skipped at once. Animations
+	 * of clips played once that reach the end of their last frame are finished, and removed. So are
+	 * the animations whose frame changes while their sprite was removed.
+	 *
+	 * \param[in] elapsed The time elapsed since the previous update, usually the duration of the frame.
+	 *
+	 * \return The number of sprites whose frame changed.
+	 *
+	 * \throw LoadingGraphicalResourceFailure if a frame could not be loaded. Basic exception guarantee:
+	 *		  the animations updated before keep their new frame.
+	 */
+	size_t update(sf::Time elapsed);
+
+private:
+
+	/**
+	 * \brief The only data of an animation read by `update` when its frame does not change.
+	 */
+	struct Timer
+	{
+		float remaining; // The time left before the next frame, in seconds. Always positive between updates.
+		float rate; // The speed, or 0 if paused.
+	};
+
+	/**
+	 * \brief A clip being played on a sprite, at the same index as its timer.
+	 */
+	struct Animation
+	{
+		MutableInterface* gui;
+		MutableInterface::SpriteHandle sprite; // Resolved each time the frame changes.
+		const Clip* clip; // Never moved: stored in a slot map.
+		float speed;
+		std::uint32_t frame;
+		bool isBackward; // For ping pong clips.
+		bool isPaused;
+		AnimationHandle handle; // To update the index of the animation when another one is removed.
+	};
+
+	/**
+	 * \brief Moves an animation to its next frame, according to the mode of its clip.
+	 * \complexity O(1).
+	 *
+	 * \return false if the clip is played once and its last frame is over.
+	 */
+	[[nodiscard]] static bool advance(Animation& animation) noexcept;
+
+	/**
+	 * \brief Removes an animation, by moving the last one in its place.
+	 * \complexity O(1).
+	 */
+	void removeAnimation(size_t index) noexcept;
+
+
+	/// All clips. They never move, so that animations can point to them.
+	SlotMap<Clip> m_clips;
+	/// The timer of each animation being played, apart so that `update` reads as little memory as possible.
+	std::vector<Timer> m_timers;
+	/// All animations being played.
+	std::vector<Animation> m_animations;
+	/// The index of each animation within `m_animations`, found with its handle.
+	SlotMap<size_t> m_indexes;
+};
+
+} // gui namespace
+
+#endif // SPRITEANIMATOR_HPP
@@ -0,0 +1,530 @@
+/*******************************************************************
+ * \file   StaticInterface.hpp
+ * \brief  Declare an interface whose elements and buttons are described at compile time.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note This file depends on the SFML library.
+ * \note All assertions are disabled in release mode. If broken, undefined behavior will occur.
+ *********************************************************************/
+
+#ifndef STATICINTERFACE_HPP
+#define STATICINTERFACE_HPP
+
+#include "BasicInterface.hpp"
+#include "SpatialGrid.hpp"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <string_view>
+#include <variant>
+#include <utility>
+#include <optional>
+#include <stdexcept>
+#include <cstddef>
+#include <cstdint>
+
+namespace gui
+{
+
+/**
+ * \brief A text of a static layout. The arguments are the ones of `BasicInterface::addText`.
+ */
+struct StaticText
+{
+	std::string_view identifier{}; // Refers to the text within the layout. Can be empty.
+	std::string_view content{};
+	sf::Vector2f pos{};
+	unsigned int characterSize{ 30u };
+	sf::Color color{ sf::Color::White };
+	std::string_view fontName{ "__default" };
+	Alignment alignment{ Alignment::Center };
+	std::uint32_t style{ 0 };
+	sf::Vector2f scale{ 1.f, 1.f };
+	sf::Angle rot{};
+};
+
+/**
+ * \brief A sprite of a static layout. The arguments are the ones of `BasicInterface::addSprite`.
+ */
+struct StaticSprite
+{
+	std::string_view identifier{}; // Refers to the sprite within the layout. Can be empty.
+	std::string_view textureName{};
+	sf::Vector2f pos{};
+	sf::Vector2f scale{ 1.f, 1.f };
+	sf::IntRect rect{};
+	sf::Angle rot{};
+	Alignment alignment{ Alignment::Center };
+	sf::Color color{ sf::Color::White };
+};
+
+/**
+ * \brief A button of a static layout: the text and the sprite with this identifier are interactive.
+ *
+ * \tparam Context What the functions of the buttons are given when pressed, e.g. the state of the
+ *		   application. The default one is empty.
+ */
+template<typename Context = std::monostate>
+struct StaticButton
+{
+	using ContextType = Context;
+
+	std::string_view identifier{}; // The identifier of a text, of a sprite, or of both. Must not be empty.
+	void (*function)(Context&){ nullptr }; // Captureless. Can be nullptr, like in `addInteractive`.
+};
+
+
+/**
+ * \brief An interactive interface fully described at compile time.
+ *
+ * Most screens are known when the program is compiled: fixed texts, fixed sprites, and a fixed set
+ * of buttons. With an `InteractiveInterface`, each element is still found by hashing its identifier,
+ * each button is a `std::function`, and the bookkeeping of removals is kept once locked. Here, the
+ * layout is a type, with constexpr arrays of elements and buttons:
+ *
+ * - The elements are added once by the constructor, which locks the interface.
+ * - Identifiers are resolved to indices at compile time: an unknown identifier does not compile.
+ * - The tables of the buttons are `std::array`s computed at compile time. Hovering queries a
+ *	 `SpatialGrid` of their elements, like a locked `InteractiveInterface`, and finds the button in a
+ *	 table. Pressing calls the function of the hovered button through a switch generated at compile
+ *	 time: the function is known, and can be inlined.
+ *
+ * Nothing is hashed at runtime, except the names of the fonts and textures, by the constructor.
+ *
+ * The layout is a type with up to three static constexpr arrays, each of them optional: `texts` of
+ * `StaticText`, `sprites` of `StaticSprite`, and `buttons` of `StaticButton`. Identifiers must be
+ * unique among the texts and among the sprites: a text and a sprite with the same identifier form
+ * the same button, like in `InteractiveInterface::addInteractive`.
+ *
+ * \note The wrappers can be modified with `getText` and `getSprite`, but nothing can be added nor
+ *		 removed. With the static layer caching, only the elements of the buttons are redrawn each
+ *		 frame: getting any other element renders the cache again during the next draw.
+ * \note Like with `addInteractive`, the elements of the buttons are moved before the others, in the
+ *		 order of the buttons: they are drawn first. `getTextIndex` and `getSpriteIndex` take it into
+ *		 account.
+ * \note If several elements are hovered, texts have the priority, then the first button.
+ *
+ * \code
+ * struct MainMenu
+ * {
+ *		static constexpr std::array texts
+ *		{
+ *			gui::StaticText{ .content = "Welcome to the GUI!", .pos = { 500, 200 }, .characterSize = 48 },
+ *			gui::StaticText{ .identifier = "play", .content = "play", .pos = { 500, 600 } },
+ *		};
+ *		static constexpr std::array sprites
+ *		{
+ *			gui::StaticSprite{ .identifier = "play", .textureName = "button", .pos = { 500, 600 } },
+ *		};
+ *		static constexpr std::array buttons
+ *		{
+ *			gui::StaticButton<AppState>{ "play", [](AppState& state) { state.isPlaying = true; } },
+ *		};
+ * };
+ *
+ * using Menu = gui::StaticInterface<MainMenu>;
+ * Menu menu{ &window };
+ * AppState state{};
+ *
+ * // In the event loop.
+ * const size_t button{ menu.eventUpdateHovered(cursorPos) };
+ * if (pressed)
+ *		menu.eventPressed(state);
+ * if (button == Menu::getButton("play")) // Both indices are constants.
+ *		menu.getText(Menu::getTextIndex("play")).setColor(sf::Color::Yellow);
+ * \endcode
+ *
+ * \see `InteractiveInterface`, `BasicInterface`.
+ */
+template<typename Layout>
+class StaticInterface final : public BasicInterface
+{
+private:
+
+	/// Each array of the layout, or an empty one if the layout does not declare it.
+	static constexpr auto s_texts{ []() { if constexpr (requires { Layout::texts; }) return Layout::texts; else return std::array<StaticText, 0>{}; }() };
+	static constexpr auto s_sprites{ []() { if constexpr (requires { Layout::sprites; }) return Layout::sprites; else return std::array<StaticSprite, 0>{}; }() };
+	static constexpr auto s_buttons{ []() { if constexpr (requires { Layout::buttons; }) return Layout::buttons; else return std::array<StaticButton<>, 0>{}; }() };
+
+public:
+
+	using Context = typename decltype(s_buttons)::value_type::ContextType;
+
+	/// The number of texts, sprites and buttons of the layout.
+	static constexpr size_t s_nbOfTexts{ s_texts.size() };
+	static constexpr size_t s_nbOfSprites{ s_sprites.size() };
+	static constexpr size_t s_nbOfButtons{ s_buttons.size() };
+
+	/// Returned instead of a button when none is hovered.
+	static constexpr size_t s_noButton{ s_nbOfButtons };
+
+
+	/**
+	 * \brief Constructs the interface, with all the elements of the layout, and locks it.
+	 * \complexity O(T + S), where T is the number of texts and S the number of sprites.
+	 *
+	 * \param[in,out] window A valid pointer to the SFML window where interface elements will be rendered.
+	 * \param[in] relativeScalingDefinition See `BasicInterface::BasicInterface`.
+	 * \param[in] batchedDrawing See `BasicInterface::lockInterface`.
+	 *
+	 * \pre The fonts and the textures of the layout must exist.
+	 * \throw LoadingGraphicalRessourceFailure, std::invalid_argument: see `addText` and `addSprite`.
+	 *
+	 * \pre `window` must be a valid.
+	 * \warning The program will assert otherwise.
+	 */
+	inline explicit StaticInterface(sf::RenderWindow* window, unsigned int relativeScalingDefinition = 1080, bool batchedDrawing = false)
+		: BasicInterface{ window, relativeScalingDefinition }, m_hoveredButton{ s_noButton }, m_hoverGrid{}
+	{
+		BasicInterface::reserve(s_nbOfTexts, s_nbOfSprites); // Allocated once.
+
+		for (const size_t i : s_tables.textOrder)
+		{
+			const StaticText& text{ s_texts[i] };
+			addText(text.content, text.pos, text.characterSize, text.color, text.fontName, text.alignment, text.style, text.scale, text.rot);
+		}
+		for (const size_t i : s_tables.spriteOrder)
+		{
+			const StaticSprite& sprite{ s_sprites[i] };
+			addSprite(sprite.textureName, sprite.pos, sprite.scale, sprite.rect, sprite.rot, sprite.alignment, sprite.color);
+		}
+
+		BasicInterface::lockInterface(false, batchedDrawing);
+		m_hoverGrid.build(m_texts, s_tables.nbOfButtonTexts, m_sprites, s_tables.nbOfButtonSprites, m_hiddenTexts.data(), m_hiddenSprites.data());
+	}
+
+	StaticInterface(const StaticInterface&) noexcept = delete;
+	StaticInterface(StaticInterface&&) noexcept = delete; // Locked interfaces can't be moved.
+	StaticInterface& operator=(const StaticInterface&) noexcept = delete;
+	StaticInterface& operator=(StaticInterface&&) noexcept = delete;
+	virtual ~StaticInterface() noexcept = default;
+
+
+	/**
+	 * \brief Returns the index of the text with this identifier, for `getText`.
+	 * \complexity O(T) at compile time, where T is the number of texts.
+	 *
+	 * \throw std::invalid_argument At compile time: the program does not compile.
+	 */
+	[[nodiscard]] static consteval size_t getTextIndex(std::string_view identifier)
+	{
+		for (size_t i{ 0 }; i < s_nbOfTexts; ++i)
+			if (s_texts[i].identifier == identifier)
+				return s_tables.textPositions[i];
+
+		throw std::invalid_argument{ "No text of the static layout has this identifier" };
+	}
+
+	/**
+	 * \brief Returns the index of the sprite with this identifier, for `getSprite`.
+	 * \complexity O(S) at compile time, where S is the number of sprites.
+	 *
+	 * \throw std::invalid_argument At compile time: the program does not compile.
+	 */
+	[[nodiscard]] static consteval size_t getSpriteIndex(std::string_view identifier)
+	{
+		for (size_t i{ 0 }; i < s_nbOfSprites; ++i)
+			if (s_sprites[i].identifier == identifier)
+				return s_tables.spritePositions[i];
+
+		throw std::invalid_argument{ "No sprite of the static layout has this identifier" };
+	}
+
+	/**
+	 * \brief Returns the index of the button with this identifier, to be compared with the hovered one.
+	 * \complexity O(B) at compile time, where B is the number of buttons.
+	 *
+	 * \throw std::invalid_argument At compile time: the program does not compile.
+	 */
+	[[nodiscard]] static consteval size_t getButton(std::string_view identifier)
+	{
+		for (size_t i{ 0 }; i < s_nbOfButtons; ++i)
+			if (s_buttons[i].identifier == identifier)
+				return i;
+
+		throw std::invalid_argument{ "No button of the static layout has this identifier" };
+	}
+
+	/**
+	 * \brief Returns a text of the layout.
+	 * \complexity O(1).
+	 *
+	 * If the text is not the element of a button and the static layer is cached, the cache is rendered
+	 * again during the next draw, since the text is about to be modified.
+	 *
+	 * \pre The index must be lower than the number of texts.
+	 * \warning The program will assert otherwise.
+	 * \warning Modify the text right away rather than keeping the reference: later modifications of a
+	 *			cached text are not displayed until the cache is rendered again.
+	 *
+	 * \see `getTextIndex`, `setStaticLayerCaching`.
+	 */
+	[[nodiscard]] inline TextWrapper& getText(size_t index) noexcept
+	{
+		assert(index < s_nbOfTexts && "Precondition violated; the index is out of range in the function getText of StaticInterface");
+
+		if (index >= s_tables.nbOfButtonTexts)
+			m_staticLayer.invalidate(); // The text is rendered into the cache.
+		return m_texts[index];
+	}
+
+	/**
+	 * \brief Returns a sprite of the layout.
+	 * \complexity O(1).
+	 *
+	 * If the sprite is not the element of a button and the static layer is cached, the cache is
+	 * rendered again during the next draw, since the sprite is about to be modified.
+	 *
+	 * \pre The index must be lower than the number of sprites.
+	 * \warning The program will assert otherwise.
+	 * \warning Modify the sprite right away rather than keeping the reference: later modifications of a
+	 *			cached sprite are not displayed until the cache is rendered again.
+	 *
+	 * \see `getSpriteIndex`, `setStaticLayerCaching`.
+	 */
+	[[nodiscard]] inline SpriteWrapper& getSprite(size_t index) noexcept
+	{
+		assert(index < s_nbOfSprites && "Precondition violated; the index is out of range in the function getSprite of StaticInterface");
+
+		if (index >= s_tables.nbOfButtonSprites)
+			m_staticLayer.invalidate(); // The sprite is rendered into the cache.
+		return m_sprites[index];
+	}
+
+	/**
+	 * \brief Updates the hovered button.
+	 * \complexity O(1) if the same button is hovered, the complexity of `SpatialGrid::query` otherwise.
+	 *
+	 * \param[in] cursorPos The position of the cursor, in world coordinates.
+	 *
+	 * \return The hovered button, or `s_noButton`.
+	 *
+	 * \see `InteractiveInterface::eventUpdateHovered`.
+	 */
+	inline size_t eventUpdateHovered(sf::Vector2f cursorPos) noexcept
+	{
+		applyPendingResize(); // Hit tests need the current bounds.
+
+		if (m_hoveredButton != s_noButton && isButtonHovered(m_hoveredButton, cursorPos)) [[likely]] // Most of the time, the same thing is hovered during the next frame.
+			return m_hoveredButton;
+
+		const std::optional<size_t> slot{ m_hoverGrid.query(cursorPos) };
+		m_hoveredButton = slot.has_value() ? s_tables.buttonOfSlots[slot.value()] : s_noButton;
+		return m_hoveredButton;
+	}
+
+	/**
+	 * \brief Calls the function of the hovered button, if any.
+	 * \complexity O(1), plus the function.
+	 *
+	 * \param[in,out] context Given to the function.
+	 *
+	 * \see `InteractiveInterface::eventPressed`.
+	 */
+	inline void eventPressed(Context& context) noexcept
+	{
+		eventPressed(m_hoveredButton, context);
+	}
+
+	/**
+	 * \brief Calls the function of a button, e.g. one that was hovered earlier. Does nothing with
+	 *		  `s_noButton`.
+	 * \complexity O(1), plus the function.
+	 */
+	inline void eventPressed(size_t button, Context& context) noexcept
+	{
+		pressButton(button, context, std::make_index_sequence<s_nbOfButtons>{});
+	}
+
+	/**
+	 * \brief Returns the hovered button, or `s_noButton`.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t getHoveredButton() const noexcept
+	{
+		return m_hoveredButton;
+	}
+
+	/**
+	 * \brief Returns the identifier of the hovered button, or an empty one.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline std::string_view getHoveredIdentifier() const noexcept
+	{
+		return (m_hoveredButton == s_noButton) ? std::string_view{} : s_buttons[m_hoveredButton].identifier;
+	}
+
+private:
+
+	/**
+	 * \brief Where the elements of the layout are stored, and which button each of them belongs to.
+	 *
+	 * The texts of the buttons come first, in the order of the buttons, then the other texts in the
+	 * order of the layout: the grid indexes the first ones. The same goes for sprites.
+	 * Without default member initializers, so that it can be used before the interface is complete.
+	 */
+	struct Tables
+	{
+		std::array<size_t, s_nbOfTexts> textOrder; // The text of the layout stored at each index.
+		std::array<size_t, s_nbOfTexts> textPositions; // The index of each text of the layout.
+		std::array<size_t, s_nbOfSprites> spriteOrder; // The sprite of the layout stored at each index.
+		std::array<size_t, s_nbOfSprites> spritePositions; // The index of each sprite of the layout.
+
+		std::array<size_t, s_nbOfButtons> textOfButtons; // The index of the text of each button, or the number of texts.
+		std::array<size_t, s_nbOfButtons> spriteOfButtons; // The index of the sprite of each button, or the number of sprites.
+
+		size_t nbOfButtonTexts;
+		size_t nbOfButtonSprites;
+		std::array<size_t, s_nbOfTexts + s_nbOfSprites> buttonOfSlots; // The button of each slot of the grid.
+	};
+
+	// Checks that the identifiers of the layout are unique, and that each button has a non-empty
+	// identifier with an element: an empty one would claim all the unnamed elements.
+	static_assert([]() consteval
+	{
+		for (size_t i{ 0 }; i < s_nbOfTexts; ++i)
+			for (size_t j{ i + 1 }; j < s_nbOfTexts; ++j)
+				if (!s_texts[i].identifier.empty() && s_texts[i].identifier == s_texts[j].identifier)
+					return false;
+
+		for (size_t i{ 0 }; i < s_nbOfSprites; ++i)
+			for (size_t j{ i + 1 }; j < s_nbOfSprites; ++j)
+				if (!s_sprites[i].identifier.empty() && s_sprites[i].identifier == s_sprites[j].identifier)
+					return false;
+
+		for (size_t i{ 0 }; i < s_nbOfButtons; ++i)
+		{
+			if (s_buttons[i].identifier.empty())
+				return false;
+
+			for (size_t j{ i + 1 }; j < s_nbOfButtons; ++j)
+				if (s_buttons[i].identifier == s_buttons[j].identifier)
+					return false;
+
+			bool hasElement{ false };
+			for (const StaticText& text : s_texts)
+				hasElement |= (text.identifier == s_buttons[i].identifier);
+			for (const StaticSprite& sprite : s_sprites)
+				hasElement |= (sprite.identifier == s_buttons[i].identifier);
+
+			if (!hasElement)
+				return false;
+		}
+
+		return true;
+	}(), "The identifiers of a static layout must be unique among its texts, among its sprites and among its buttons, and each button must have the non-empty identifier of a text or of a sprite");
+
+	/// Finds the elements of each button, and orders them. Computed at compile time.
+	static constexpr Tables s_tables{ []() consteval
+	{
+		Tables tables{};
+		std::array<bool, s_nbOfTexts> isTextPlaced{};
+		std::array<bool, s_nbOfSprites> isSpritePlaced{};
+
+		for (size_t i{ 0 }; i < s_nbOfButtons; ++i)
+		{
+			tables.textOfButtons[i] = s_nbOfTexts;
+			tables.spriteOfButtons[i] = s_nbOfSprites;
+
+			for (size_t j{ 0 }; j < s_nbOfTexts; ++j)
+			{
+				if (s_texts[j].identifier != s_buttons[i].identifier)
+					continue;
+
+				tables.buttonOfSlots[tables.nbOfButtonTexts] = i;
+				tables.textOfButtons[i] = tables.nbOfButtonTexts;
+				tables.textOrder[tables.nbOfButtonTexts++] = j;
+				isTextPlaced[j] = true;
+			}
+
+			for (size_t j{ 0 }; j < s_nbOfSprites; ++j)
+			{
+				if (s_sprites[j].identifier != s_buttons[i].identifier)
+					continue;
+
+				tables.spriteOfButtons[i] = tables.nbOfButtonSprites;
+				tables.spriteOrder[tables.nbOfButtonSprites++] = j;
+				isSpritePlaced[j] = true;
+			}
+		}
+
+		// Sprites come after the texts within the grid.
+		for (size_t i{ 0 }; i < s_nbOfButtons; ++i)
+			if (tables.spriteOfButtons[i] < s_nbOfSprites)
+				tables.buttonOfSlots[tables.nbOfButtonTexts + tables.spriteOfButtons[i]] = i;
+
+		for (size_t j{ 0 }, index{ tables.nbOfButtonTexts }; j < s_nbOfTexts; ++j)
+			if (!isTextPlaced[j])
+				tables.textOrder[index++] = j;
+		for (size_t j{ 0 }, index{ tables.nbOfButtonSprites }; j < s_nbOfSprites; ++j)
+			if (!isSpritePlaced[j])
+				tables.spriteOrder[index++] = j;
+
+		for (size_t i{ 0 }; i < s_nbOfTexts; ++i)
+			tables.textPositions[tables.textOrder[i]] = i;
+		for (size_t i{ 0 }; i < s_nbOfSprites; ++i)
+			tables.spritePositions[tables.spriteOrder[i]] = i;
+
+		return tables;
+	}() };
+
+	/**
+	 * \brief Returns true if the cursor is over a visible element of a button.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline bool isButtonHovered(size_t button, sf::Vector2f cursorPos) const noexcept
+	{
+		const size_t text{ s_tables.textOfButtons[button] };
+		const size_t sprite{ s_tables.spriteOfButtons[button] };
+
+		return (text < s_nbOfTexts && !m_hiddenTexts[text] && m_texts[text].getGlobalBounds().contains(cursorPos))
+			|| (sprite < s_nbOfSprites && !m_hiddenSprites[sprite] && m_sprites[sprite].getGlobalBounds().contains(cursorPos));
+	}
+
+	/**
+	 * \brief Calls the function of a button: a switch over the buttons, whose functions are constants.
+	 * \complexity O(1).
+	 */
+	template<size_t... Buttons>
+	static inline void pressButton(size_t button, Context& context, std::index_sequence<Buttons...>) noexcept
+	{
+		(void)(((button == Buttons) ? (callButton<Buttons>(context), true) : false) || ...);
+	}
+
+	/**
+	 * \brief Calls the function of a button, if it has one.
+	 * \complexity O(1).
+	 */
+	template<size_t Button>
+	static inline void callButton(Context& context) noexcept
+	{
+		if constexpr (s_buttons[Button].function != nullptr)
+			s_buttons[Button].function(context);
+	}
+
+	/**
+	 * \brief The elements of the buttons are dynamic, so that they can be highlighted when hovered.
+	 * \complexity O(B), where B is the number of buttons.
+	 *
+	 * \see `BasicInterface::flagDynamicElements`.
+	 */
+	inline virtual void flagDynamicElements(std::vector<bool>& dynamicSprites, std::vector<bool>& dynamicTexts) const noexcept override
+	{
+		for (size_t i{ 0 }; i < s_tables.nbOfButtonTexts; ++i)
+			dynamicTexts[i] = true;
+		for (size_t i{ 0 }; i < s_tables.nbOfButtonSprites; ++i)
+			dynamicSprites[i] = true;
+	}
+
+
+	/// The button that is hovered, or `s_noButton`.
+	size_t m_hoveredButton;
+
+	/// Indexes the elements of the buttons.
+	SpatialGrid m_hoverGrid;
+};
+
+} // gui namespace
+
+#endif // STATICINTERFACE_HPP
@@ -0,0 +1,129 @@
+#include "StaticLayer.hpp"
+
+namespace gui
+{
+
+void StaticLayer::build(const std::vector<bool>& dynamicSprites, const std::vector<bool>& dynamicTexts) noexcept
+{
+	m_staticSprites.clear();
+	m_staticTexts.clear();
+	m_dynamicSprites.clear();
+	m_dynamicTexts.clear();
+
+	for (std::uint32_t i{ 0 }; i < dynamicSprites.size(); ++i)
+		(dynamicSprites[i] ? m_dynamicSprites : m_staticSprites).push_back(i);
+	for (std::uint32_t i{ 0 }; i < dynamicTexts.size(); ++i)
+		(dynamicTexts[i] ? m_dynamicTexts : m_staticTexts).push_back(i);
+
+	m_isOutdated = true;
+	m_isEnabled = true;
+}
+
+void StaticLayer::clear() noexcept
+{
+	m_texture.reset();
+	m_staticSprites.clear();
+	m_staticTexts.clear();
+	m_dynamicSprites.clear();
+	m_dynamicTexts.clear();
+	m_isOutdated = true;
+	m_isEnabled = false;
+}
+
+bool StaticLayer::draw(sf::RenderTarget& target, const ArenaVector<SpriteWrapper>& sprites, const ArenaVector<TextWrapper>& texts, const ArenaVector<std::uint8_t>& hiddenSprites, const ArenaVector<std::uint8_t>& hiddenTexts) noexcept
+{
+	const sf::View view{ target.getView() };
+
+	const bool isTextureUploaded{ m_hasAwaitingSprites && m_textureUploads != SpriteWrapper::getTextureUploadCount() }; // Maybe the one a static sprite awaited.
+
+	if (m_isOutdated || isTextureUploaded || !m_texture.has_value() || m_texture->getSize() != target.getSize() || !isRenderedWith(view)) [[unlikely]]
+	{
+		if (!render(target, sprites, texts, hiddenSprites, hiddenTexts)) [[unlikely]]
+		{
+			clear();
+			return false;
+		}
+	}
+
+	// The texture covers the whole target, pixel by pixel.
+	const sf::Sprite layer{ m_texture->getTexture() };
+	const sf::BlendMode premultipliedAlpha{ sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha };
+
+	target.setView(target.getDefaultView());
+	target.draw(layer, sf::RenderStates{ premultipliedAlpha });
+	target.setView(view);
+	PROFILE_COUNT(drawCalls, 1);
+
+	for (const std::uint32_t index : m_dynamicSprites)
+	{
+		if (hiddenSprites[index]) [[unlikely]]
+		{
+			PROFILE_COUNT(hiddenElementsSkipped, 1);
+			continue;
+		}
+
+		target.draw(sprites[index].getSprite());
+		PROFILE_COUNT(drawCalls, 1);
+		PROFILE_COUNT(drawnElements, 1);
+	}
+
+	for (const std::uint32_t index : m_dynamicTexts)
+	{
+		if (hiddenTexts[index]) [[unlikely]]
+		{
+			PROFILE_COUNT(hiddenElementsSkipped, 1);
+			continue;
+		}
+
+		target.draw(texts[index].getText());
+		PROFILE_COUNT(drawCalls, 1);
+		PROFILE_COUNT(drawnElements, 1);
+	}
+
+	return true;
+}
+
+bool StaticLayer::render(const sf::RenderTarget& target, const ArenaVector<SpriteWrapper>& sprites, const ArenaVector<TextWrapper>& texts, const ArenaVector<std::uint8_t>& hiddenSprites, const ArenaVector<std::uint8_t>& hiddenTexts) noexcept
+{
+	if (!m_texture.has_value())
+		m_texture.emplace();
+
+	if (m_texture->getSize() != target.getSize() && !m_texture->resize(target.getSize())) [[unlikely]]
+		return false;
+
+	const sf::View& view{ target.getView() };
+	m_texture->setView(view);
+	m_texture->clear(sf::Color::Transparent);
+
+	// Drawn with the usual blending over a transparent texture, the colors end up premultiplied by
+	// their alpha.
+	for (const std::uint32_t index : m_staticSprites)
+		if (!hiddenSprites[index])
+			m_texture->draw(sprites[index].getSprite());
+
+	for (const std::uint32_t index : m_staticTexts)
+		if (!hiddenTexts[index])
+			m_texture->draw(texts[index].getText());
+
+	PROFILE_COUNT(drawCalls, m_staticSprites.size() + m_staticTexts.size()); // Rendered once in a while: an upper bound is enough.
+
+	// Sprites awaiting their texture are rendered with their previous one: rendered again once uploaded.
+	m_textureUploads = SpriteWrapper::getTextureUploadCount();
+	m_hasAwaitingSprites = std::any_of(m_staticSprites.begin(), m_staticSprites.end(), [&sprites](std::uint32_t index) { return sprites[index].isAwaitingTexture(); });
+
+	m_texture->display();
+
+	m_viewCenter = view.getCenter();
+	m_viewSize = view.getSize();
+	m_viewRotation = view.getRotation();
+	m_viewport = view.getViewport();
+	m_isOutdated = false;
+	return true;
+}
+
+bool StaticLayer::isRenderedWith(const sf::View& view) const noexcept
+{
+	return view.getCenter() == m_viewCenter && view.getSize() == m_viewSize && view.getRotation() == m_viewRotation && view.getViewport() == m_viewport;
+}
+
+} // gui namespace
@@ -0,0 +1,153 @@
+/*******************************************************************
+ * \file   StaticLayer.hpp, StaticLayer.cpp
+ * \brief  Declare a cache that renders the elements that never change into a single texture.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note These files depend on the SFML library.
+ *********************************************************************/
+
+#ifndef STATICLAYER_HPP
+#define STATICLAYER_HPP
+
+#include "GraphicalResources.hpp"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <cstdint>
+
+namespace gui
+{
+
+/**
+ * \brief Renders the static elements of a locked interface into a texture, drawn as a single quad.
+ *
+ * Static elements can't be modified once the interface is locked: they only need to be rendered
+ * again when the window is resized, or when the view changes. Every other frame, the whole static
+ * layer costs one textured quad. Dynamic elements are drawn on top of it, in their usual order.
+ *
+ * The texture has the size of the target, and is rendered with the current view of the target.
+ * It is stored with premultiplied alpha, so that semi-transparent elements are blended the same
+ * way as when they are drawn directly.
+ *
+ * \note Since dynamic elements are all drawn above the static layer, a dynamic sprite that was
+ *		 drawn below a static text is now drawn above it.
+ *
+ * \see `BasicInterface::setStaticLayerCaching`.
+ */
+class StaticLayer
+{
+public:
+
+	constexpr StaticLayer() noexcept = default;
+	StaticLayer(const StaticLayer&) noexcept = delete;
+	StaticLayer(StaticLayer&&) noexcept = default;
+	StaticLayer& operator=(const StaticLayer&) noexcept = delete;
+	StaticLayer& operator=(StaticLayer&&) noexcept = default;
+	~StaticLayer() noexcept = default;
+
+
+	/**
+	 * \brief Enables the cache, and chooses which elements are rendered into it.
+	 * \complexity O(N + M), where N is the number of sprites and M the number of texts.
+	 *
+	 * \param[in] dynamicSprites For each sprite, whether it can be modified. Those are not cached.
+	 * \param[in] dynamicTexts For each text, whether it can be modified. Those are not cached.
+	 */
+	void build(const std::vector<bool>& dynamicSprites, const std::vector<bool>& dynamicTexts) noexcept;
+
+	/**
+	 * \brief Disables the cache, and releases its texture.
+	 * \complexity O(1).
+	 */
+	void clear() noexcept;
+
+	/**
+	 * \brief Renders the static elements again during the next call of `draw`.
+	 * \complexity O(1).
+	 */
+	inline void invalidate() noexcept
+	{
+		m_isOutdated = true;
+	}
+
+	/**
+	 * \brief Tells if the cache is used.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline bool isEnabled() const noexcept
+	{
+		return m_isEnabled;
+	}
+
+	/**
+	 * \brief Draws the cached static elements, then the visible dynamic ones.
+	 * \complexity O(D), where D is the number of dynamic elements, if the cache is up to date.
+	 * \complexity O(N), where N is the number of elements, otherwise.
+	 *
+	 * The cache is rendered again if it was invalidated, if the size or the view of the target
+	 * changed since it was rendered, or if a texture was uploaded while static sprites awaited one.
+	 *
+	 * \param[out] target Where the elements are drawn.
+	 * \param[in]  sprites The sprites of the interface.
+	 * \param[in]  texts The texts of the interface.
+	 * \param[in]  hiddenSprites The mirrored hide flags of the sprites (see `MirroredFlag`).
+	 * \param[in]  hiddenTexts The mirrored hide flags of the texts.
+	 *
+	 * \return `false` if the texture could not be created. Nothing was drawn, and the cache is disabled.
+	 */
+	bool draw(sf::RenderTarget& target, const ArenaVector<SpriteWrapper>& sprites, const ArenaVector<TextWrapper>& texts, const ArenaVector<std::uint8_t>& hiddenSprites, const ArenaVector<std::uint8_t>& hiddenTexts) noexcept;
+
+private:
+
+	/**
+	 * \brief Renders the static elements into the texture, with the view of the target.
+	 * \complexity O(S), where S is the number of static elements.
+	 *
+	 * \return `false` if the texture could not be resized.
+	 */
+	bool render(const sf::RenderTarget& target, const ArenaVector<SpriteWrapper>& sprites, const ArenaVector<TextWrapper>& texts, const ArenaVector<std::uint8_t>& hiddenSprites, const ArenaVector<std::uint8_t>& hiddenTexts) noexcept;
+
+	/**
+	 * \brief Tells if a view is the one the texture was rendered with.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] bool isRenderedWith(const sf::View& view) const noexcept;
+
+
+	/// The rendered static elements. Only created once the cache is drawn.
+	std::optional<sf::RenderTexture> m_texture{};
+
+	/// Indexes of the sprites rendered into the texture, in drawing order.
+	std::vector<std::uint32_t> m_staticSprites{};
+	/// Indexes of the texts rendered into the texture, in drawing order.
+	std::vector<std::uint32_t> m_staticTexts{};
+	/// Indexes of the sprites drawn on top of the texture, in drawing order.
+	std::vector<std::uint32_t> m_dynamicSprites{};
+	/// Indexes of the texts drawn on top of the texture, in drawing order.
+	std::vector<std::uint32_t> m_dynamicTexts{};
+
+	/// The center of the view the texture was rendered with.
+	sf::Vector2f m_viewCenter{};
+	/// The size of the view the texture was rendered with.
+	sf::Vector2f m_viewSize{};
+	/// The rotation of the view the texture was rendered with.
+	sf::Angle m_viewRotation{};
+	/// The viewport of the view the texture was rendered with.
+	sf::FloatRect m_viewport{};
+
+	/// The texture uploads when the texture was rendered, see `SpriteWrapper::getTextureUploadCount`.
+	std::uint32_t m_textureUploads{ 0 };
+	/// If true, static sprites were awaiting their texture when the texture was rendered.
+	bool m_hasAwaitingSprites{ false };
+	/// If true, the texture must be rendered again.
+	bool m_isOutdated{ true };
+	/// If true, `draw` uses the texture.
+	bool m_isEnabled{ false };
+};
+
+} // gui namespace
+
+#endif // STATICLAYER_HPP
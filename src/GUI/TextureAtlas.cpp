@@ -0,0 +1,161 @@
+#include "TextureAtlas.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace gui
+{
+
+TextureAtlas::TextureAtlas(unsigned int pageSize, unsigned int padding) noexcept
+	: m_pages{}, m_pageSize{ pageSize }, m_padding{ padding }
+{}
+
+std::optional<TextureAtlas::Region> TextureAtlas::insert(const sf::Texture& texture) noexcept
+{
+	const sf::Vector2u textureSize{ texture.getSize() };
+	if (!canHold(textureSize)) [[unlikely]]
+		return std::nullopt;
+
+	// The padding is kept on the right and bottom sides: the left and top sides of a texture are
+	// either the edges of the page, or the padding of its neighbours.
+	const sf::Vector2u paddedSize{ textureSize.x + m_padding, textureSize.y + m_padding };
+
+	Page* chosenPage{ nullptr };
+	size_t nodeIndex{ 0 };
+	std::optional<sf::Vector2u> position{};
+
+	for (Page& page : m_pages)
+	{
+		position = findPosition(page, paddedSize, nodeIndex);
+		if (position.has_value())
+		{
+			chosenPage = &page;
+			break;
+		}
+	}
+
+	if (chosenPage == nullptr)
+	{	// No space left: creating a new page, cleared to transparent so the padding does not bleed.
+		const unsigned int pageSize{ std::min(m_pageSize, sf::Texture::getMaximumSize()) };
+
+		Page newPage{ sf::Texture{}, std::vector<SkylineNode>{ SkylineNode{ 0, 0, pageSize } }, pageSize, 0 };
+		if (!newPage.texture.loadFromImage(sf::Image{ sf::Vector2u{ pageSize, pageSize }, sf::Color::Transparent })) [[unlikely]]
+			return std::nullopt;
+		newPage.texture.setSmooth(true);
+
+		m_pages.push_back(std::move(newPage));
+		chosenPage = &m_pages.back();
+		position = findPosition(*chosenPage, paddedSize, nodeIndex);
+	}
+
+	chosenPage->texture.update(texture, position.value()); // GPU to GPU copy.
+	addSkylineLevel(*chosenPage, nodeIndex, position.value(), paddedSize);
+	++chosenPage->nbOfRegions;
+
+	return Region{ &chosenPage->texture, sf::IntRect{ static_cast<sf::Vector2i>(position.value()), static_cast<sf::Vector2i>(textureSize) } };
+}
+
+void TextureAtlas::release(const sf::Texture* page) noexcept
+{
+	const auto pageIterator{ std::find_if(m_pages.begin(), m_pages.end(), [page](const Page& x) { return &x.texture == page; }) };
+
+	if (pageIterator == m_pages.end())
+		return;
+
+	if (--pageIterator->nbOfRegions == 0)
+		m_pages.erase(pageIterator);
+}
+
+bool TextureAtlas::canHold(sf::Vector2u size) const noexcept
+{
+	const unsigned int maxSize{ std::min(m_pageSize, sf::Texture::getMaximumSize()) / 2 };
+
+	return size.x != 0 && size.y != 0
+		&& size.x + m_padding <= maxSize
+		&& size.y + m_padding <= maxSize;
+}
+
+void TextureAtlas::setPageLayout(unsigned int pageSize, unsigned int padding) noexcept
+{
+	m_pageSize = pageSize;
+	m_padding = padding;
+}
+
+std::optional<sf::Vector2u> TextureAtlas::findPosition(const Page& page, sf::Vector2u size, size_t& nodeIndex) noexcept
+{
+	std::optional<sf::Vector2u> bestPosition{};
+	unsigned int bestBottom{ std::numeric_limits<unsigned int>::max() };
+	unsigned int bestWidth{ std::numeric_limits<unsigned int>::max() };
+
+	for (size_t i{ 0 }; i < page.skyline.size(); ++i)
+	{
+		const unsigned int x{ page.skyline[i].x };
+		if (x + size.x > page.size)
+			break; // Segments are sorted by x, the next ones would not fit either.
+
+		// The area rests on the highest segment it covers.
+		unsigned int y{ 0 };
+		unsigned int widthLeft{ size.x };
+		bool fits{ true };
+		for (size_t j{ i }; widthLeft > 0; ++j)
+		{
+			y = std::max(y, page.skyline[j].y);
+			if (y + size.y > page.size)
+			{
+				fits = false;
+				break;
+			}
+
+			widthLeft -= std::min(widthLeft, page.skyline[j].width);
+		}
+
+		// Bottom-left heuristic: the lowest area first, then the narrowest segment to limit waste.
+		if (fits && (y + size.y < bestBottom || (y + size.y == bestBottom && page.skyline[i].width < bestWidth)))
+		{
+			bestPosition = sf::Vector2u{ x, y };
+			bestBottom = y + size.y;
+			bestWidth = page.skyline[i].width;
+			nodeIndex = i;
+		}
+	}
+
+	return bestPosition;
+}
+
+void TextureAtlas::addSkylineLevel(Page& page, size_t nodeIndex, sf::Vector2u position, sf::Vector2u size) noexcept
+{
+	std::vector<SkylineNode>& skyline{ page.skyline };
+	skyline.insert(skyline.begin() + nodeIndex, SkylineNode{ position.x, position.y + size.y, size.x });
+
+	// The segments covered by the new one are shrunk or removed.
+	for (size_t i{ nodeIndex + 1 }; i < skyline.size();)
+	{
+		const unsigned int previousEnd{ skyline[i - 1].x + skyline[i - 1].width };
+		if (skyline[i].x >= previousEnd)
+			break;
+
+		const unsigned int shrink{ previousEnd - skyline[i].x };
+		if (skyline[i].width <= shrink)
+		{
+			skyline.erase(skyline.begin() + i);
+			continue;
+		}
+
+		skyline[i].x += shrink;
+		skyline[i].width -= shrink;
+		break;
+	}
+
+	// Neighbours at the same height are merged.
+	for (size_t i{ 0 }; i + 1 < skyline.size();)
+	{
+		if (skyline[i].y == skyline[i + 1].y)
+		{
+			skyline[i].width += skyline[i + 1].width;
+			skyline.erase(skyline.begin() + i + 1);
+		}
+		else
+			++i;
+	}
+}
+
+} // gui namespace
@@ -0,0 +1,178 @@
+/*******************************************************************
+ * \file   TextureAtlas.hpp, TextureAtlas.cpp
+ * \brief  Declare a packer that gathers small textures into a few large pages.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note These files depend on the SFML library.
+ *********************************************************************/
+
+#ifndef TEXTUREATLAS_HPP
+#define TEXTUREATLAS_HPP
+
+#include <SFML/Graphics.hpp>
+#include <list>
+#include <vector>
+#include <optional>
+#include <cstdint>
+
+namespace gui
+{
+
+/**
+ * \brief Packs textures into large pages using the skyline bottom-left heuristic.
+ *
+ * Each page is a single `sf::Texture`. Inserting a texture copies it (on the GPU) into a free area of
+ * a page, surrounded by transparent padding to prevent bleeding between neighbours when the page
+ * is smoothed. Sprites using textures from the same page can be drawn with a single texture bind,
+ * and therefore batched together.
+ *
+ * Areas are never reused once released: a page is only destroyed when all its regions are released.
+ *
+ * \note Pages are smooth, not repeated and stored in a list, so their addresses remain stable.
+ *
+ * \see `SpriteWrapper::enableAtlas`.
+ */
+class TextureAtlas
+{
+public:
+
+	/**
+	 * \brief Represents where a texture was packed.
+	 */
+	struct Region
+	{
+		sf::Texture* page; // The page that contains the texture.
+		sf::IntRect rect; // The area of the texture within the page.
+	};
+
+
+	/**
+	 * \brief Initializes the atlas without creating any page.
+	 * \complexity O(1).
+	 *
+	 * \param[in] pageSize The width and height of each page. Clamped to the maximum size supported by
+	 *					   the graphic card when a page is created.
+	 * \param[in] padding The transparent space kept between two textures, in pixels.
+	 */
+	explicit TextureAtlas(unsigned int pageSize = 2048, unsigned int padding = 2) noexcept;
+
+	TextureAtlas(const TextureAtlas&) noexcept = delete;
+	TextureAtlas(TextureAtlas&&) noexcept = default;
+	TextureAtlas& operator=(const TextureAtlas&) noexcept = delete;
+	TextureAtlas& operator=(TextureAtlas&&) noexcept = default;
+	~TextureAtlas() noexcept = default;
+
+
+	/**
+	 * \brief Copies a texture into a page.
+	 * \complexity O(P * S), where P is the number of pages and S the number of skyline segments;
+	 *			   plus the GPU copy.
+	 *
+	 * A new page is created if no existing page has enough space.
+	 *
+	 * \param[in] texture The texture to copy. It can be destroyed afterwards.
+	 *
+	 * \return Where the texture was packed, or `std::nullopt` if it can't be packed (too large, or
+	 *		   the page could not be created).
+	 *
+	 * \see `canHold`, `release`.
+	 */
+	[[nodiscard]] std::optional<Region> insert(const sf::Texture& texture) noexcept;
+
+	/**
+	 * \brief Releases a region of a page. The page is destroyed once all its regions are released.
+	 * \complexity O(P), where P is the number of pages.
+	 *
+	 * \param[in] page The page returned by `insert`.
+	 *
+	 * \warning The page must not be used after its last region is released.
+	 */
+	void release(const sf::Texture* page) noexcept;
+
+	/**
+	 * \brief Tells whether a texture of the given size is small enough to be packed.
+	 * \complexity O(1).
+	 *
+	 * Textures larger than half a page are not worth packing, they would waste most of it.
+	 *
+	 * \param[in] size The size of the texture.
+	 *
+	 * \return `true` if the texture can be inserted.
+	 */
+	[[nodiscard]] bool canHold(sf::Vector2u size) const noexcept;
+
+	/**
+	 * \brief Changes the size and the padding of the pages that will be created from now on.
+	 * \complexity O(1).
+	 *
+	 * \param[in] pageSize The width and height of the new pages.
+	 * \param[in] padding The transparent space kept between two textures, in pixels.
+	 */
+	void setPageLayout(unsigned int pageSize, unsigned int padding) noexcept;
+
+	/**
+	 * \brief Returns the number of pages.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t getPageCount() const noexcept
+	{
+		return m_pages.size();
+	}
+
+private:
+
+	/**
+	 * \brief A horizontal segment of the skyline: everything below `y` is occupied.
+	 */
+	struct SkylineNode
+	{
+		unsigned int x;
+		unsigned int y;
+		unsigned int width;
+	};
+
+	/**
+	 * \brief A single texture, and everything needed to pack into it.
+	 */
+	struct Page
+	{
+		sf::Texture texture;
+		std::vector<SkylineNode> skyline;
+		unsigned int size;
+		size_t nbOfRegions;
+	};
+
+
+	/**
+	 * \brief Finds the lowest position where an area fits in a page.
+	 * \complexity O(S²), where S is the number of skyline segments.
+	 *
+	 * \param[in]  page The page in which the area is searched.
+	 * \param[in]  size The size of the area, padding included.
+	 * \param[out] nodeIndex The index of the segment where the area begins.
+	 *
+	 * \return The position of the area, or `std::nullopt` if it does not fit.
+	 */
+	[[nodiscard]] static std::optional<sf::Vector2u> findPosition(const Page& page, sf::Vector2u size, size_t& nodeIndex) noexcept;
+
+	/**
+	 * \brief Raises the skyline of a page after an area was placed.
+	 * \complexity O(S), where S is the number of skyline segments.
+	 */
+	static void addSkylineLevel(Page& page, size_t nodeIndex, sf::Vector2u position, sf::Vector2u size) noexcept;
+
+
+	/// All pages. A list so their addresses remain stable.
+	std::list<Page> m_pages;
+
+	/// The width and height of the pages that will be created.
+	unsigned int m_pageSize;
+	/// The transparent space kept between two textures.
+	unsigned int m_padding;
+};
+
+} // gui namespace
+
+#endif // TEXTUREATLAS_HPP
@@ -0,0 +1,53 @@
+#include "ThreadPool.hpp"
+
+namespace gui
+{
+
+ThreadPool::ThreadPool(unsigned int nbOfThreads) noexcept
+	: m_workers{}, m_tasks{}, m_mutex{}, m_condition{}, m_stopping{ false }
+{
+	m_workers.reserve(nbOfThreads);
+	for (unsigned int i{ 0 }; i < nbOfThreads; ++i)
+		m_workers.emplace_back(&ThreadPool::workerLoop, this);
+}
+
+ThreadPool::~ThreadPool() noexcept
+{
+	{
+		std::lock_guard lock{ m_mutex };
+		m_stopping = true;
+	}
+
+	m_condition.notify_all();
+	for (auto& worker : m_workers)
+		worker.join();
+}
+
+ThreadPool& ThreadPool::getShared() noexcept
+{
+	static ThreadPool sharedPool{};
+	return sharedPool;
+}
+
+void ThreadPool::workerLoop() noexcept
+{
+	while (true)
+	{
+		std::function<void()> task{};
+
+		{
+			std::unique_lock lock{ m_mutex };
+			m_condition.wait(lock, [this]() { return m_stopping || !m_tasks.empty(); });
+
+			if (m_tasks.empty()) // Stopping, and every task was executed.
+				return;
+
+			task = std::move(m_tasks.front());
+			m_tasks.pop();
+		}
+
+		task();
+	}
+}
+
+} // gui namespace
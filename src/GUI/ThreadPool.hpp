@@ -0,0 +1,126 @@
+/*******************************************************************
+ * \file   ThreadPool.hpp, ThreadPool.cpp
+ * \brief  Declare a fixed-size pool of worker threads for background tasks.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note These files only depend on the standard library.
+ *********************************************************************/
+
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <concepts>
+#include <algorithm>
+#include <utility>
+
+namespace gui
+{
+
+/**
+ * \brief Runs tasks on a fixed number of worker threads.
+ *
+ * Tasks are executed in the order they were submitted, by the first available worker. The destructor
+ * waits for all submitted tasks to be executed.
+ *
+ * \note No graphical resource (`sf::Texture`, `sf::RenderTexture`...) should be created within a task:
+ *		 OpenGL contexts are bound to the render thread. Decoding files into `sf::Image`s is fine.
+ *
+ * \see `getShared`.
+ */
+class ThreadPool
+{
+public:
+
+	/**
+	 * \brief Starts the worker threads.
+	 * \complexity O(N), where N is the number of threads.
+	 *
+	 * \param[in] nbOfThreads The number of workers. By default, all hardware threads but one, which is
+	 *						  left for the render thread.
+	 */
+	explicit ThreadPool(unsigned int nbOfThreads = std::max(2u, std::thread::hardware_concurrency()) - 1) noexcept;
+
+	ThreadPool(const ThreadPool&) noexcept = delete;
+	ThreadPool(ThreadPool&&) noexcept = delete;
+	ThreadPool& operator=(const ThreadPool&) noexcept = delete;
+	ThreadPool& operator=(ThreadPool&&) noexcept = delete;
+	~ThreadPool() noexcept; /// \complexity Waits for all submitted tasks.
+
+
+	/**
+	 * \brief Queues a task to be executed by a worker thread.
+	 * \complexity O(1).
+	 *
+	 * \param[in] task The callable to execute. It must not take any argument.
+	 *
+	 * \return A future holding the result of the task. It can be discarded.
+	 */
+	template<typename F> requires std::invocable<F>
+	inline std::future<std::invoke_result_t<F>> submit(F&& task) noexcept
+	{
+		auto packagedTask{ std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::forward<F>(task)) };
+		auto future{ packagedTask->get_future() };
+
+		{
+			std::lock_guard lock{ m_mutex };
+			m_tasks.emplace([packagedTask]() { (*packagedTask)(); });
+		}
+
+		m_condition.notify_one();
+		return future;
+	}
+
+	/**
+	 * \brief Returns the number of worker threads.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t getThreadCount() const noexcept
+	{
+		return m_workers.size();
+	}
+
+	/**
+	 * \brief Returns the pool shared by the whole library.
+	 * \complexity O(1).
+	 *
+	 * The pool is created the first time this function is called.
+	 *
+	 * \return The shared pool.
+	 */
+	[[nodiscard]] static ThreadPool& getShared() noexcept;
+
+private:
+
+	/**
+	 * \brief Executes tasks until the pool is destroyed.
+	 */
+	void workerLoop() noexcept;
+
+
+	/// The worker threads.
+	std::vector<std::thread> m_workers;
+	/// Tasks not executed yet.
+	std::queue<std::function<void()>> m_tasks;
+
+	/// Protects the tasks and the stopping flag.
+	std::mutex m_mutex;
+	/// Wakes up the workers when a task is queued.
+	std::condition_variable m_condition;
+	/// If true, the workers exit once there are no tasks left.
+	bool m_stopping;
+};
+
+} // gui namespace
+
+#endif // THREADPOOL_HPP
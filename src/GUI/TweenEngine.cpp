@@ -0,0 +1,270 @@
+#include "TweenEngine.hpp"
+#include <algorithm>
+#include <numbers>
+#include <cmath>
+
+namespace gui
+{
+
+float computeEasing(Easing easing, float progress) noexcept
+{
+	const float t{ progress };
+	const float u{ 1.f - progress };
+
+	switch (easing)
+	{
+	case Easing::Linear:
+		return t;
+
+	case Easing::QuadIn:
+		return t * t;
+
+	case Easing::QuadOut:
+		return 1.f - u * u;
+
+	case Easing::QuadInOut:
+		return (t < 0.5f) ? 2.f * t * t : 1.f - 2.f * u * u;
+
+	case Easing::CubicIn:
+		return t * t * t;
+
+	case Easing::CubicOut:
+		return 1.f - u * u * u;
+
+	case Easing::CubicInOut:
+		return (t < 0.5f) ? 4.f * t * t * t : 1.f - 4.f * u * u * u;
+
+	case Easing::SineInOut:
+		return 0.5f - 0.5f * std::cos(std::numbers::pi_v<float> * t);
+
+	case Easing::BackOut:
+	{
+		constexpr float overshoot{ 1.70158f };
+		return 1.f - (overshoot + 1.f) * u * u * u + overshoot * u * u;
+	}
+	}
+
+	return t;
+}
+
+bool TweenEngine::stop(TweenHandle tween) noexcept
+{
+	const size_t* const index{ m_indexes.get(tween) };
+	if (index == nullptr)
+		return false;
+
+	removeTween(*index);
+	return true;
+}
+
+size_t TweenEngine::stop(const Element& target) noexcept
+{
+	size_t nbOfStops{ 0 };
+
+	for (size_t i{ m_tweens.size() }; i > 0; --i) // Backward: the moved tweens were already checked.
+	{
+		if (m_tweens[i - 1].target == target)
+		{
+			removeTween(i - 1);
+			++nbOfStops;
+		}
+	}
+
+	return nbOfStops;
+}
+
+void TweenEngine::stopAll() noexcept
+{
+	for (const Tween& tween : m_tweens)
+		m_indexes.erase(tween.handle); // Unlike clearing, erasing makes the handles stale.
+
+	m_times.clear();
+	m_invDurations.clear();
+	m_progresses.clear();
+	m_tweens.clear();
+	m_callbacks.clear();
+}
+
+size_t TweenEngine::update(sf::Time elapsed)
+{
+	const float seconds{ elapsed.asSeconds() };
+	const size_t nbOfTweens{ m_tweens.size() };
+	float* const times{ m_times.data() };
+	const float* const invDurations{ m_invDurations.data() };
+	float* const progresses{ m_progresses.data() };
+
+	for (size_t i{ 0 }; i < nbOfTweens; ++i)
+	{	// Neither branch nor call: optimized builds vectorize this loop.
+		times[i] += seconds;
+		progresses[i] = std::min(times[i] * invDurations[i], 1.f);
+	}
+
+	size_t nbOfWrites{ 0 };
+
+	for (size_t i{ 0 }; i < m_tweens.size(); )
+	{
+		const float progress{ m_progresses[i] };
+		if (progress < 0.f) [[unlikely]]
+		{	// Still delayed: the element is not touched.
+			++i;
+			continue;
+		}
+
+		Tween& tween{ m_tweens[i] };
+		TransformableWrapper* const target{ resolve(tween.target) };
+		if (target == nullptr) [[unlikely]]
+		{	// The element was removed: the tween is dropped without its callback.
+			removeTween(i);
+			continue;
+		}
+
+		if (!tween.isStarted) [[unlikely]]
+		{
+			tween.start = read(*target, tween.property);
+			for (size_t j{ 0 }; j < tween.delta.size(); ++j)
+				tween.delta[j] -= tween.start[j]; // Held the end until then.
+
+			tween.isStarted = true;
+		}
+
+		write(*target, tween, (progress < 1.f) ? computeEasing(tween.easing, progress) : 1.f);
+		++nbOfWrites;
+
+		if (progress < 1.f) [[likely]]
+		{
+			++i;
+			continue;
+		}
+
+		if (m_callbacks[i])
+			m_pendingCallbacks.push_back(std::move(m_callbacks[i]));
+
+		removeTween(i); // The last tween is moved here, and updated next.
+	}
+
+	// Callbacks may start, stop or update tweens: the finished ones were already removed.
+	std::vector<std::function<void()>> callbacks{ std::move(m_pendingCallbacks) };
+	m_pendingCallbacks.clear();
+
+	for (std::function<void()>& callback : callbacks)
+		callback();
+
+	if (m_pendingCallbacks.capacity() < callbacks.capacity())
+	{
+		callbacks.clear();
+		m_pendingCallbacks = std::move(callbacks); // Keeps the capacity for the next updates.
+	}
+
+	return nbOfWrites;
+}
+
+TransformableWrapper* TweenEngine::resolve(const Element& element) noexcept
+{
+	if (!element.text.isNull())
+		return element.gui->getDynamicText(element.text);
+
+	return element.gui->getDynamicSprite(element.sprite);
+}
+
+TweenEngine::TweenHandle TweenEngine::add(Element target, Property property, std::array<float, 4> end, sf::Time duration, Easing easing, sf::Time delay, std::function<void()>&& onCompletion)
+{
+	assert(duration > sf::Time::Zero && "Precondition violated; the duration is not strictly positive when a tween of TweenEngine was added");
+	assert(delay >= sf::Time::Zero && "Precondition violated; the delay is negative when a tween of TweenEngine was added");
+
+	const TweenHandle handle{ m_indexes.emplace(m_tweens.size()) };
+
+	try
+	{	// Reserving first makes the pushes below unable to throw.
+		m_times.reserve(m_times.size() + 1);
+		m_invDurations.reserve(m_invDurations.size() + 1);
+		m_progresses.reserve(m_progresses.size() + 1);
+		m_tweens.reserve(m_tweens.size() + 1);
+		m_callbacks.reserve(m_callbacks.size() + 1);
+	}
+	catch (...)
+	{
+		m_indexes.erase(handle);
+		throw;
+	}
+
+	m_times.push_back(-delay.asSeconds());
+	m_invDurations.push_back(1.f / duration.asSeconds());
+	m_progresses.push_back(-1.f);
+	m_tweens.push_back(Tween{ .target = target, .start = {}, .delta = end, .property = property, .easing = easing, .isStarted = false, .handle = handle });
+	m_callbacks.push_back(std::move(onCompletion));
+
+	return handle;
+}
+
+std::array<float, 4> TweenEngine::read(const TransformableWrapper& target, Property property) noexcept
+{
+	switch (property)
+	{
+	case Property::Position:
+		return { target.getPosition().x, target.getPosition().y, 0.f, 0.f };
+
+	case Property::Scale:
+		return { target.getScale().x, target.getScale().y, 0.f, 0.f };
+
+	case Property::Rotation:
+		return { target.getRotation().asDegrees(), 0.f, 0.f, 0.f };
+
+	case Property::Color:
+	{
+		const sf::Color color{ target.getColor() };
+		return { static_cast<float>(color.r), static_cast<float>(color.g), static_cast<float>(color.b), static_cast<float>(color.a) };
+	}
+	}
+
+	return {};
+}
+
+void TweenEngine::write(TransformableWrapper& target, const Tween& tween, float easedProgress) noexcept
+{
+	const auto at{ [&tween, easedProgress](size_t component) { return tween.start[component] + tween.delta[component] * easedProgress; } };
+
+	switch (tween.property)
+	{
+	case Property::Position:
+		target.setPosition(sf::Vector2f{ at(0), at(1) });
+		break;
+
+	case Property::Scale:
+		target.setScale(sf::Vector2f{ at(0), at(1) });
+		break;
+
+	case Property::Rotation:
+		target.setRotation(sf::degrees(at(0)));
+		break;
+
+	case Property::Color:
+	{
+		const auto toComponent{ [&at](size_t component) { return static_cast<std::uint8_t>(std::clamp(at(component), 0.f, 255.f) + 0.5f); } }; // BackOut overshoots.
+		target.setColor(sf::Color{ toComponent(0), toComponent(1), toComponent(2), toComponent(3) });
+		break;
+	}
+	}
+}
+
+void TweenEngine::removeTween(size_t index) noexcept
+{
+	m_indexes.erase(m_tweens[index].handle);
+
+	if (index + 1 != m_tweens.size())
+	{
+		m_times[index] = m_times.back();
+		m_invDurations[index] = m_invDurations.back();
+		m_progresses[index] = m_progresses.back();
+		m_tweens[index] = m_tweens.back();
+		m_callbacks[index] = std::move(m_callbacks.back());
+		m_indexes[m_tweens[index].handle] = index;
+	}
+
+	m_times.pop_back();
+	m_invDurations.pop_back();
+	m_progresses.pop_back();
+	m_tweens.pop_back();
+	m_callbacks.pop_back();
+}
+
+} // gui namespace
@@ -0,0 +1,360 @@
+/*******************************************************************
+ * \file   TweenEngine.hpp, TweenEngine.cpp
+ * \brief  Declare an engine that interpolates the position, scale, rotation and color of elements
+ *		   over time, all advanced by one call per frame.
+ *
+ * \author OmegaDIL.
+ * \date   July 2025.
+ *
+ * \note These files depend on the SFML library.
+ * \note All assertions are disabled in release mode. If broken, undefined behavior will occur.
+ *********************************************************************/
+
+#ifndef TWEENENGINE_HPP
+#define TWEENENGINE_HPP
+
+#include "MutableInterface.hpp"
+#include "SlotMap.hpp"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <array>
+#include <functional>
+#include <cstdint>
+#include <concepts>
+
+namespace gui
+{
+
+/**
+ * \brief How the progress of a tween is distributed over its duration.
+ *
+ * `In` curves start slowly, `Out` curves end slowly, and `InOut` curves do both. `BackOut` slightly
+ * overshoots the target before settling on it.
+ */
+enum class Easing : std::uint8_t
+{
+	Linear,
+	QuadIn,
+	QuadOut,
+	QuadInOut,
+	CubicIn,
+	CubicOut,
+	CubicInOut,
+	SineInOut,
+	BackOut
+};
+
+/**
+ * \brief Applies an easing curve to a linear progress.
+ * \complexity O(1).
+ *
+ * \param[in] easing The curve.
+ * \param[in] progress The linear progress, between 0 and 1.
+ *
+ * \return The eased progress: 0 for 0 and 1 for 1. In between, it may exceed 1 for `BackOut`.
+ */
+[[nodiscard]] float computeEasing(Easing easing, float progress) noexcept;
+
+
+/**
+ * \brief Interpolates properties of elements toward target values, and advances all of them at once
+ *		  from the elapsed time.
+ *
+ * Transitions, such as sliding an interface in or fading a button, are usually written as mutation
+ * loops run every frame. Instead, a tween is described once: which property of which element, the
+ * value to reach, the duration, the easing curve, an optional delay and an optional callback called
+ * once the value is reached. `update` then advances every tween at once: the progress of all tweens
+ * is computed in a single loop over contiguous arrays, which the compiler can vectorize, and only the
+ * tweens past their delay write to their element.
+ *
+ * Tweens write through the setters of `TransformableWrapper`, which increment the revision of the
+ * element: batched interfaces only refill the vertices of the elements that were actually tweened.
+ * Elements without a tween are never touched: the engine stores nothing for them.
+ *
+ * The start value is read from the element once the delay is over, so that tweens can be chained
+ * with delays or from completion callbacks.
+ *
+ * \note A property can be tweened several times at once, but the last tween to be updated wins.
+ * \note Rotations are interpolated in degrees, without taking the shortest path: tweening from 0 to
+ *		 270 degrees turns by 270 degrees.
+ * \note Scales are absolute: resizing the window in the middle of a scale tween replaces the scaling
+ *		 applied by the interface until the tween is over.
+ * \note Tweens refer to dynamic elements by their handle, which is resolved at each update: elements
+ *		 can be added, removed or swapped in the meantime. Once an element is removed, its tweens are
+ *		 dropped without calling their callbacks, as soon as they are past their delay.
+ *
+ * \code
+ * gui::TweenEngine tweens{};
+ *
+ * const MGUI::TextHandle title{ myInterface.getTextHandle("title") };
+ * tweens.moveTo(myInterface, title, sf::Vector2f{ 500, 150 }, sf::milliseconds(400), gui::Easing::BackOut);
+ * tweens.colorTo(myInterface, title, sf::Color::Transparent, sf::milliseconds(300), gui::Easing::QuadIn, sf::seconds(2), [&cur, settings]() { cur = settings; });
+ *
+ * sf::Clock clock{};
+ * while (window.isOpen())
+ * {
+ *		tweens.update(clock.restart());
+ *		// ...
+ * }
+ * \endcode
+ *
+ * \see `TransformableWrapper`, `Easing`, `SpriteAnimator`.
+ */
+class TweenEngine
+{
+public:
+
+	using TweenHandle = SlotMap<size_t>::Key;
+
+
+	inline TweenEngine() noexcept
+		: m_times{}, m_invDurations{}, m_progresses{}, m_tweens{}, m_callbacks{}, m_indexes{}, m_pendingCallbacks{}
+	{}
+
+	TweenEngine(const TweenEngine&) noexcept = delete;
+	TweenEngine(TweenEngine&&) noexcept = default;
+	TweenEngine& operator=(const TweenEngine&) noexcept = delete;
+	TweenEngine& operator=(TweenEngine&&) noexcept = default;
+	~TweenEngine() noexcept = default;
+
+
+	/**
+	 * \brief Moves a dynamic element to a position.
+	 * \complexity Amortized O(1).
+	 *
+	 * \param[in,out] gui The interface of the element. Must outlive its tweens.
+	 * \param[in] target The handle of the element to tween.
+	 * \param[in] position The position to reach.
+	 * \param[in] duration How long the tween lasts, once the delay is over.
+	 * \param[in] easing The curve of the tween.
+	 * \param[in] delay How long the tween waits before starting.
+	 * \param[in] onCompletion Called by `update` once the position is reached. Can be empty.
+	 *
+	 * \return The handle of the tween, which becomes stale once it is stopped or finished.
+	 *
+	 * \pre The duration must be strictly positive, and the delay must not be negative.
+	 * \warning The program will assert otherwise.
+	 * \throw std::bad_alloc. Strong exception guarantee.
+	 */
+	template<typename T>
+	inline TweenHandle moveTo(MutableInterface& gui, MutableInterface::Handle<T> target, sf::Vector2f position, sf::Time duration, Easing easing = Easing::Linear, sf::Time delay = sf::Time::Zero, std::function<void()> onCompletion = {})
+	{
+		return add(toElement(gui, target), Property::Position, { position.x, position.y, 0.f, 0.f }, duration, easing, delay, std::move(onCompletion));
+	}
+
+	/**
+	 * \brief Scales a dynamic element to a scale.
+	 * \complexity Amortized O(1).
+	 *
+	 * \see `moveTo`, for the other parameters.
+	 */
+	template<typename T>
+	inline TweenHandle scaleTo(MutableInterface& gui, MutableInterface::Handle<T> target, sf::Vector2f scale, sf::Time duration, Easing easing = Easing::Linear, sf::Time delay = sf::Time::Zero, std::function<void()> onCompletion = {})
+	{
+		return add(toElement(gui, target), Property::Scale, { scale.x, scale.y, 0.f, 0.f }, duration, easing, delay, std::move(onCompletion));
+	}
+
+	/**
+	 * \brief Rotates a dynamic element to an angle.
+	 * \complexity Amortized O(1).
+	 *
+	 * \see `moveTo`, for the other parameters.
+	 */
+	template<typename T>
+	inline TweenHandle rotateTo(MutableInterface& gui, MutableInterface::Handle<T> target, sf::Angle angle, sf::Time duration, Easing easing = Easing::Linear, sf::Time delay = sf::Time::Zero, std::function<void()> onCompletion = {})
+	{
+		return add(toElement(gui, target), Property::Rotation, { angle.asDegrees(), 0.f, 0.f, 0.f }, duration, easing, delay, std::move(onCompletion));
+	}
+
+	/**
+	 * \brief Changes the color of a dynamic element to another one, transparency included.
+	 * \complexity Amortized O(1).
+	 *
+	 * \see `moveTo`, for the other parameters.
+	 */
+	template<typename T>
+	inline TweenHandle colorTo(MutableInterface& gui, MutableInterface::Handle<T> target, sf::Color color, sf::Time duration, Easing easing = Easing::Linear, sf::Time delay = sf::Time::Zero, std::function<void()> onCompletion = {})
+	{
+		return add(toElement(gui, target), Property::Color, { static_cast<float>(color.r), static_cast<float>(color.g), static_cast<float>(color.b), static_cast<float>(color.a) }, duration, easing, delay, std::move(onCompletion));
+	}
+
+	/**
+	 * \brief Stops a tween: the element keeps its current value, and the callback is not called. No
+	 *		  effect if the handle is stale.
+	 * \complexity O(1).
+	 *
+	 * \return `false` if the handle was stale.
+	 */
+	bool stop(TweenHandle tween) noexcept;
+
+	/**
+	 * \brief Stops all tweens of a dynamic element.
+	 * \complexity O(N), where N is the number of tweens.
+	 *
+	 * \param[in] gui The interface of the element.
+	 * \param[in] target The handle of the element.
+	 *
+	 * \return The number of tweens stopped.
+	 */
+	template<typename T>
+	inline size_t stop(MutableInterface& gui, MutableInterface::Handle<T> target) noexcept
+	{
+		return stop(toElement(gui, target));
+	}
+
+	/**
+	 * \brief Stops all tweens, without calling their callbacks.
+	 * \complexity O(N), where N is the number of tweens.
+	 */
+	void stopAll() noexcept;
+
+	/**
+	 * \brief Returns true if the tween was neither stopped nor finished, even if still delayed.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline bool isPlaying(TweenHandle tween) const noexcept
+	{
+		return m_indexes.get(tween) != nullptr;
+	}
+
+	/**
+	 * \brief Returns the number of tweens being played, including delayed ones.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] inline size_t getNbOfTweens() const noexcept
+	{
+		return m_tweens.size();
+	}
+
+	/**
+	 * \brief Advances all tweens, writes the new values to their elements, and calls the callbacks of
+	 *		  the finished ones.
+	 * \complexity O(N + C), where N is the number of tweens and C the complexity of the callbacks.
+	 *
+	 * Finished tweens are removed before their callbacks are called: callbacks can start, or stop,
+	 * any tween, and even update the engine. Tweens past their delay whose element was removed are dropped.
+	 *
+	 * \param[in] elapsed The time elapsed since the previous update, usually the duration of the frame.
+	 *
+	 * \return The number of elements written to.
+	 *
+	 * \throw std::bad_alloc, or what the callbacks throw. Basic exception guarantee: the values written
+	 *		  before are kept, and the callbacks not called yet are lost.
+	 */
+	size_t update(sf::Time elapsed);
+
+private:
+
+	/**
+	 * \brief The property of the element a tween writes to.
+	 */
+	enum class Property : std::uint8_t
+	{
+		Position,
+		Scale,
+		Rotation,
+		Color
+	};
+
+	/**
+	 * \brief A dynamic element, resolved each time it is tweened.
+	 */
+	struct Element
+	{
+		MutableInterface* gui;
+		MutableInterface::TextHandle text; // Null if the element is a sprite.
+		MutableInterface::SpriteHandle sprite; // Null if the element is a text.
+
+		[[nodiscard]] constexpr bool operator==(const Element&) const noexcept = default;
+	};
+
+	/**
+	 * \brief A tween, at the same index as its time, its duration and its progress.
+	 *
+	 * Values are stored as up to 4 floats, whatever the property: 2 for positions and scales, 1 for
+	 * rotations and 4 for colors.
+	 */
+	struct Tween
+	{
+		Element target;
+		std::array<float, 4> start; // Read from the element once the delay is over.
+		std::array<float, 4> delta; // From the start to the end. Holds the end until the start is read.
+		Property property;
+		Easing easing;
+		bool isStarted;
+		TweenHandle handle; // To update the index of the tween when another one is removed.
+	};
+
+	/**
+	 * \brief Returns the element a handle refers to.
+	 * \complexity O(1).
+	 */
+	template<typename T>
+	[[nodiscard]] inline static Element toElement(MutableInterface& gui, MutableInterface::Handle<T> handle) noexcept
+	{
+		if constexpr (std::same_as<T, TextWrapper>)
+			return Element{ &gui, handle, {} };
+		else
+			return Element{ &gui, {}, handle };
+	}
+
+	/**
+	 * \brief Returns the wrapper of an element, or nullptr if it was removed.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] static TransformableWrapper* resolve(const Element& element) noexcept;
+
+	/**
+	 * \brief Adds a tween.
+	 * \complexity Amortized O(1).
+	 *
+	 * \throw std::bad_alloc. Strong exception guarantee.
+	 */
+	TweenHandle add(Element target, Property property, std::array<float, 4> end, sf::Time duration, Easing easing, sf::Time delay, std::function<void()>&& onCompletion);
+
+	/**
+	 * \brief Stops all tweens of an element.
+	 * \complexity O(N), where N is the number of tweens.
+	 *
+	 * \return The number of tweens stopped.
+	 */
+	size_t stop(const Element& target) noexcept;
+
+	/**
+	 * \brief Reads the current value of the property from the element.
+	 * \complexity O(1).
+	 */
+	[[nodiscard]] static std::array<float, 4> read(const TransformableWrapper& target, Property property) noexcept;
+
+	/**
+	 * \brief Writes the value of a tween for an eased progress to its element.
+	 * \complexity O(1).
+	 */
+	static void write(TransformableWrapper& target, const Tween& tween, float easedProgress) noexcept;
+
+	/**
+	 * \brief Removes a tween, by moving the last one in its place.
+	 * \complexity O(1).
+	 */
+	void removeTween(size_t index) noexcept;
+
+
+	/// The time elapsed since the start of each tween, in seconds. Negative while it is delayed.
+	std::vector<float> m_times;
+	/// The inverse of the duration of each tween, in seconds.
+	std::vector<float> m_invDurations;
+	/// The linear progress of each tween, computed by `update`. At most 1, and negative while delayed.
+	std::vector<float> m_progresses;
+	/// All tweens being played.
+	std::vector<Tween> m_tweens;
+	/// The completion callback of each tween, apart since they are only read once.
+	std::vector<std::function<void()>> m_callbacks;
+	/// The index of each tween within `m_tweens`, found with its handle.
+	SlotMap<size_t> m_indexes;
+	/// The callbacks of the tweens finished during the current update, kept to reuse their capacity.
+	std::vector<std::function<void()>> m_pendingCallbacks;
+};
+
+} // gui namespace
+
+#endif // TWEENENGINE_HPP
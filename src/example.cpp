@@ -30,6 +30,7 @@ int main()
 	overlayInterface.lockInterface();
 
 	unsigned int targetAliasing{ conSettings.antiAliasingLevel };
+	gui::InputDispatcher input{ &window }; // Coalesces the mouse moves of each frame into one hover query.
 
 	while (window.isOpen()) [[likely]]
 	{
@@ -41,21 +42,20 @@ int main()
 			else if (event->is<sf::Event::Resized>()) [[unlikely]]
 				BGUI::windowResized(&window, currentView); // Resizes the window and the interfaces.
 
-			else if (curGUI.gInteractive != nullptr && event->is<sf::Event::MouseButtonPressed>() && sf::Mouse::isButtonPressed(sf::Mouse::Button::Left))
-				curGUI.gInteractive->eventPressed(); // Handles button pressing (only for IGUI).
-
-			else if (curGUI.gInteractive != nullptr && event->is<sf::Event::MouseMoved>() && !sf::Mouse::isButtonPressed(sf::Mouse::Button::Left)) [[likely]]
-			{
-				curGUI.mainItem = curGUI.gInteractive->eventUpdateHovered(window.mapPixelToCoords(event->getIf<sf::Event::MouseMoved>()->position)); // Updates the hovered item (only for IGUI). The argument is the mouse position (see SFML doc).
-				overlayInterface.getDynamicSprite("overlay")->setPosition(window.mapPixelToCoords(event->getIf<sf::Event::MouseMoved>()->position)); // Moves the overlay sprite to follow the mouse.
-			}
-
-			if (targetAliasing != conSettings.antiAliasingLevel && curGUI.mainItem.identifier != "aliasing")
-			{	// checking the identifier avoids multiple recreations while sliding.
-				conSettings.antiAliasingLevel = targetAliasing;
-				window.create(sf::VideoMode::getDesktopMode(), "Template sfml 3", currentState, conSettings);
-				BGUI::windowResized(&window, currentView); // create would not trigger a resize event.
-			}
+			else
+				input.handleEvent(*event); // Mouse and touch events are replayed after the loop.
+		}
+
+		if (const std::optional<sf::Vector2f> cursorPos{ input.getCursorMove() }; cursorPos.has_value() && curGUI.gInteractive != nullptr && !sf::Mouse::isButtonPressed(sf::Mouse::Button::Left))
+			overlayInterface.getDynamicSprite("overlay")->setPosition(cursorPos.value()); // Moves the overlay sprite to follow the mouse.
+
+		curGUI.mainItem = input.dispatch(curGUI.gInteractive); // Updates the hovered item, then presses the buttons (only for IGUI).
+
+		if (targetAliasing != conSettings.antiAliasingLevel && curGUI.mainItem.identifier != "aliasing")
+		{	// checking the identifier avoids multiple recreations while sliding.
+			conSettings.antiAliasingLevel = targetAliasing;
+			window.create(sf::VideoMode::getDesktopMode(), "Template sfml 3", currentState, conSettings);
+			BGUI::windowResized(&window, currentView); // create would not trigger a resize event.
 		}
 
 		// First check if we are in the right interface, then check the identifier.
@@ -0,0 +1,95 @@
+#include <SFML/Graphics.hpp>
+#include <cstdio>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "GUI/AssetPack.hpp"
+
+// Packs textures and fonts into one asset pack, to be opened with `gui::AssetPack::open`.
+//
+// Usage: SIFL3_packer output.siflpack [--rgba | --encoded] files or folders...
+// Entries are named after the paths given, with forward slashes: run it from the assets folder so
+// that they match the file names given to `createTexture` and `createFont`. Folders are added
+// recursively. Textures that follow `--rgba` are decoded now, so that they are uploaded without any
+// decoding at runtime; `--encoded`, the default, stores the files as they are. Fonts are always
+// stored as they are.
+
+namespace
+{
+
+bool isFont(const std::filesystem::path& file) noexcept
+{
+	const std::string extension{ file.extension().string() };
+	for (const std::string_view fontExtension : { ".ttf", ".otf", ".ttc", ".pfb", ".pfm", ".woff" })
+		if (extension == fontExtension)
+			return true;
+
+	return false;
+}
+
+bool addSource(std::vector<gui::AssetPack::Source>& sources, const std::filesystem::path& file, gui::AssetPack::Format textureFormat)
+{
+	const gui::AssetPack::Kind kind{ isFont(file) ? gui::AssetPack::Kind::Font : gui::AssetPack::Kind::Texture };
+	const gui::AssetPack::Format format{ (kind == gui::AssetPack::Kind::Font) ? gui::AssetPack::Format::Encoded : textureFormat };
+
+	std::ostringstream errorMessage{};
+	auto source{ gui::AssetPack::readSource(errorMessage, file.lexically_normal().generic_string(), file, kind, format) };
+	if (!source.has_value())
+	{
+		std::fprintf(stderr, "%s", errorMessage.str().c_str());
+		return false;
+	}
+
+	std::printf("%s %s (%zu bytes)\n", (format == gui::AssetPack::Format::Rgba) ? "rgba   " : "encoded", source->name.c_str(), source->data.size());
+	sources.push_back(std::move(source.value()));
+	return true;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		std::fprintf(stderr, "Usage: %s output.siflpack [--rgba | --encoded] files or folders...\n", argv[0]);
+		return 1;
+	}
+
+	std::vector<gui::AssetPack::Source> sources{};
+	gui::AssetPack::Format textureFormat{ gui::AssetPack::Format::Encoded };
+
+	for (int i{ 2 }; i < argc; ++i)
+	{
+		const std::string_view argument{ argv[i] };
+		if (argument == "--rgba" || argument == "--encoded")
+		{
+			textureFormat = (argument == "--rgba") ? gui::AssetPack::Format::Rgba : gui::AssetPack::Format::Encoded;
+			continue;
+		}
+
+		const std::filesystem::path path{ argument };
+		if (!std::filesystem::is_directory(path))
+		{
+			if (!addSource(sources, path, textureFormat))
+				return 1;
+			continue;
+		}
+
+		for (const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator{ path })
+			if (entry.is_regular_file() && !addSource(sources, entry.path(), textureFormat))
+				return 1;
+	}
+
+	const size_t nbOfEntries{ sources.size() };
+	std::ostringstream errorMessage{};
+	if (!gui::AssetPack::save(errorMessage, argv[1], std::move(sources)))
+	{
+		std::fprintf(stderr, "%s", errorMessage.str().c_str());
+		return 1;
+	}
+
+	std::printf("%zu entries written to %s\n", nbOfEntries, argv[1]);
+	return 0;
+}